@@ -15,6 +15,7 @@
 #ifndef _FASTCDR_CDR_H_
 #define _FASTCDR_CDR_H_
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <cassert>
@@ -24,18 +25,34 @@
 #include <map>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "fastcdr_dll.h"
 
+#if FASTCDR_HAVE_PMR
+#include <memory_resource>
+#endif // if FASTCDR_HAVE_PMR
+
+#if FASTCDR_HAVE_STRING_VIEW
+#include <string_view>
+#endif // if FASTCDR_HAVE_STRING_VIEW
+
 #include "CdrEncoding.hpp"
+#include "Compression.hpp"
+#include "Crc32c.hpp"
+#include "cdr/default_init_allocator.hpp"
 #include "cdr/fixed_size_string.hpp"
+#include "cdr/fixed_vector.hpp"
+#include "cdr/flat_map.hpp"
 #include "detail/container_recursive_inspector.hpp"
+#include "dynamic/TypeDescription.hpp"
 #include "exceptions/BadParamException.h"
 #include "exceptions/Exception.h"
 #include "exceptions/NotEnoughMemoryException.h"
 #include "FastBuffer.h"
+#include "SerializationPlan.hpp"
 #include "xcdr/external.hpp"
 #include "xcdr/MemberId.hpp"
 #include "xcdr/optional.hpp"
@@ -83,6 +100,9 @@ public:
     //! Default endianess in the system.
     Cdr_DllAPI static const Endianness DEFAULT_ENDIAN;
 
+    //! Default maximum number of nested values walked using a runtime description.
+    Cdr_DllAPI static const uint32_t DEFAULT_MAX_NESTING_DEPTH;
+
     /*!
      * Used to decide, in encoding algorithms where member headers support a short header version and a long header
      * version, which one will be used.
@@ -99,6 +119,35 @@ public:
         AUTO_WITH_LONG_HEADER_BY_DEFAULT
     } XCdrHeaderSelection;
 
+    /*!
+     * @brief This enumeration represents the errors the encoder/decoder can report.
+     */
+    typedef enum : uint8_t
+    {
+        //! @brief No error was produced.
+        CDR_ERROR_NONE = 0,
+        //! @brief Tried to encode/decode a position that exceeds the internal memory size.
+        CDR_ERROR_NOT_ENOUGH_MEMORY,
+        //! @brief Tried to encode/decode an invalid value.
+        CDR_ERROR_BAD_PARAM
+    } ErrorCode;
+
+    /*!
+     * @brief This enumeration represents the ways the encoder/decoder reports an error.
+     */
+    typedef enum : uint8_t
+    {
+        //! @brief Errors are reported throwing the related exception::Exception. Default mode.
+        THROW_EXCEPTIONS,
+        /*!
+         * @brief Errors are reported storing them in the object, which has to be checked using @ref get_error.
+         * Only the first error is stored until @ref clear_error or @ref reset is called, and the data encoded or
+         * decoded after it is not valid. This mode never throws, so it can be used by applications built without
+         * exception support.
+         */
+        STICKY_ERROR
+    } ErrorMode;
+
     /*!
      * @brief This class stores the current state of a CDR serialization.
      */
@@ -167,6 +216,49 @@ public:
             const Endianness endianness = DEFAULT_ENDIAN,
             const CdrVersion cdr_version = XCDRv2);
 
+#if FASTCDR_HAVE_PMR
+    /*!
+     * @brief This constructor creates an eprosima::fastcdr::Cdr object that can serialize/deserialize
+     * the assigned buffer, allocating the decoded objects from a memory resource.
+     * @param cdr_buffer A reference to the buffer that contains (or will contain) the CDR representation.
+     * @param endianness The initial endianness that will be used.
+     * @param cdr_version Represents the type of encoding algorithm that will be used for the encoding.
+     * @param memory_resource Memory resource used to allocate the decoded objects. See @ref set_memory_resource.
+     */
+    Cdr(
+            FastBuffer& cdr_buffer,
+            const Endianness endianness,
+            const CdrVersion cdr_version,
+            std::pmr::memory_resource* memory_resource)
+        : Cdr(cdr_buffer, endianness, cdr_version)
+    {
+        set_memory_resource(memory_resource);
+    }
+
+    /*!
+     * @brief Sets the memory resource used to allocate the objects created while decoding, as the
+     * eprosima::fastcdr::external members. Decoded std::pmr containers allocate their elements from the memory
+     * resource of the container, so they should be constructed with this same memory resource to allocate the whole
+     * decoded object graph from it.
+     * @param[in] memory_resource Memory resource. nullptr to use the global heap.
+     */
+    void set_memory_resource(
+            std::pmr::memory_resource* memory_resource)
+    {
+        memory_resource_ = memory_resource;
+    }
+
+    /*!
+     * @brief Returns the memory resource used to allocate the objects created while decoding.
+     * @return The memory resource. nullptr if the global heap is used.
+     */
+    std::pmr::memory_resource* get_memory_resource() const
+    {
+        return static_cast<std::pmr::memory_resource*>(memory_resource_);
+    }
+
+#endif // if FASTCDR_HAVE_PMR
+
     /*!
      * @brief This function reads the encapsulation of the CDR stream.
      *        If the CDR stream contains an encapsulation, then this function should be called before starting to deserialize.
@@ -209,6 +301,20 @@ public:
     Cdr_DllAPI bool set_encoding_flag(
             EncodingAlgorithmFlag encoding_flag);
 
+    /*!
+     * @brief Returns the EncodingAlgorithmFlag of the type being encoded or decoded.
+     * @return The encoding algorithm of the current type.
+     */
+    Cdr_DllAPI EncodingAlgorithmFlag get_current_encoding_flag() const;
+
+    /*!
+     * @brief Sets the EncodingAlgorithmFlag of the type being decoded, when its members are decoded without
+     * @ref deserialize_type. The previous value has to be set back when the type ends.
+     * @param[in] encoding_flag The encoding algorithm of the current type.
+     */
+    Cdr_DllAPI void set_current_encoding_flag(
+            EncodingAlgorithmFlag encoding_flag);
+
     /*!
      * @brief This function returns the option flags when the CDR type is eprosima::fastcdr::DDS_CDR.
      * @return The option flags.
@@ -266,6 +372,12 @@ public:
      */
     Cdr_DllAPI size_t get_serialized_data_length() const;
 
+    /*!
+     * @brief Returns the number of bytes between the current position and the end of the buffer.
+     * @return The number of remaining bytes.
+     */
+    Cdr_DllAPI size_t get_remaining_length() const;
+
     /*!
      * @brief Returns the number of bytes needed to align a position to certain data size.
      * @param current_alignment Position to be aligned.
@@ -300,6 +412,105 @@ public:
     Cdr_DllAPI bool move_alignment_forward(
             size_t num_bytes);
 
+    /*!
+     * @brief Sets how the errors produced while encoding/decoding are reported.
+     * @param[in] error_mode Mode used to report the errors.
+     */
+    Cdr_DllAPI void set_error_mode(
+            ErrorMode error_mode);
+
+    /*!
+     * @brief Returns how the errors produced while encoding/decoding are reported.
+     * @return Mode used to report the errors.
+     */
+    Cdr_DllAPI ErrorMode get_error_mode() const;
+
+    /*!
+     * @brief Returns the first error stored while working in ErrorMode::STICKY_ERROR.
+     * @return The stored error. ErrorCode::CDR_ERROR_NONE if no error was produced.
+     */
+    Cdr_DllAPI ErrorCode get_error() const;
+
+    /*!
+     * @brief Returns the message describing the first error stored while working in ErrorMode::STICKY_ERROR.
+     * @return The message of the stored error. Empty string if no error was produced.
+     */
+    Cdr_DllAPI const char* get_error_message() const;
+
+    /*!
+     * @brief Removes the stored error.
+     */
+    Cdr_DllAPI void clear_error();
+
+    /*!
+     * @brief Reports an error following the configured ErrorMode.
+     * In ErrorMode::THROW_EXCEPTIONS the related exception is thrown. In ErrorMode::STICKY_ERROR the error is stored
+     * if there was no previous one.
+     * @param[in] error Code of the error.
+     * @param[in] message Message describing the error. If null, a default message is used.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     */
+    Cdr_DllAPI Cdr& report_error(
+            ErrorCode error,
+            const char* message = nullptr);
+
+    /*!
+     * @brief Sets the maximum number of nested values walked using a runtime description, as done by @ref skip and
+     * @ref transcode_endianness. Deeper values are reported as ErrorCode::CDR_ERROR_BAD_PARAM, so a recursive type
+     * can't exhaust the stack.
+     * @param[in] max_nesting_depth Maximum number of nested values.
+     */
+    Cdr_DllAPI void set_max_nesting_depth(
+            uint32_t max_nesting_depth);
+
+    /*!
+     * @brief Returns the maximum number of nested values walked using a runtime description.
+     * @return Maximum number of nested values.
+     */
+    Cdr_DllAPI uint32_t get_max_nesting_depth() const;
+
+    /*!
+     * @brief Attaches a checksum accumulator, which is updated with the bytes encoded or decoded from now on.
+     *
+     * The bytes are added to the checksum in chunks while the stream advances. Bytes which will be patched later, as
+     * the DHEADERs and member headers of the types being encoded, are added after patching them, when the outermost
+     * type being encoded ends. The encapsulation options are patched when the encoding ends, so the checksum should be
+     * attached after the encapsulation was encoded or decoded. The checksum is not valid when the encoding failed or
+     * the state was set back, nor when the data is encoded without eprosima::fastcdr::Cdr (like through
+     * @ref get_current_position).
+     * @param[in] checksum Checksum accumulator, which must outlive its use by this object. nullptr detaches it.
+     */
+    Cdr_DllAPI void set_checksum(
+            Crc32c* checksum);
+
+    /*!
+     * @brief Adds to the attached checksum the bytes encoded or decoded so far and returns its value.
+     * @return The value of the checksum. 0 if there is no checksum attached.
+     */
+    Cdr_DllAPI uint32_t get_checksum();
+
+    /*!
+     * @brief Attaches a compressor, which is given the bytes encoded from now on as @ref set_checksum describes, so
+     * the payload is compressed while it is encoded instead of after it.
+     *
+     * The compressor should be attached after the encapsulation was encoded, and the compressed payload is completed
+     * by @ref end_compression.
+     * @param[in] compressor Compressor, which must outlive its use by this object. nullptr detaches it.
+     */
+    Cdr_DllAPI void set_compressor(
+            PayloadCompressor* compressor);
+
+    /*!
+     * @brief Gives the attached compressor the bytes encoded so far and completes the compressed payload, with the
+     * encapsulation as it is at the beginning of the buffer. The compressor is detached.
+     * @return Size of the compressed payload, including its encapsulation. 0 if there is no compressor attached.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the destination of the compressor
+     * can't hold the compressed payload.
+     * @exception exception::BadParamException This exception is thrown when no encapsulation was encoded, or the
+     * payload is too big.
+     */
+    Cdr_DllAPI size_t end_compression();
+
     /*!
      * @brief This function resets the alignment to the current position in the buffer.
      */
@@ -402,15 +613,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             serialize(value);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -678,6 +889,24 @@ public:
     Cdr_DllAPI Cdr& serialize(
             const wchar_t* string_t);
 
+    /*!
+     * @brief This function serializes a string whose length is known.
+     * The characters are copied once, without scanning for the null terminator, and the null terminator is appended.
+     * @param string_t Pointer to the characters that will be serialized in the buffer. It doesn't need to be
+     * null-terminated.
+     * @param length Number of characters, not including a null terminator.
+     * @param check_null_characters When `true`, the characters are checked not to contain a null character. The
+     * check can be skipped when the caller already guarantees it.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when trying to serialize a string with null
+     * characters or whose length with the null terminator doesn't fit in 32 bits.
+     */
+    Cdr_DllAPI Cdr& serialize_string(
+            const char* string_t,
+            size_t length,
+            bool check_null_characters = true);
+
     /*!
      * @brief This function serializes a std::string.
      * @param string_t The string that will be serialized in the buffer.
@@ -689,15 +918,7 @@ public:
     Cdr& serialize(
             const std::string& string_t)
     {
-        // Check there are no null characters in the string.
-        const char* c_str = string_t.c_str();
-        const auto str_len = strlen(c_str);
-        if (string_t.size() > str_len)
-        {
-            throw exception::BadParamException("The string contains null characters");
-        }
-
-        return serialize_sequence(c_str, str_len + 1);
+        return serialize_string(string_t.data(), string_t.size());
     }
 
     /*!
@@ -710,21 +931,83 @@ public:
     Cdr& serialize(
             const std::wstring& string_t)
     {
-        return serialize(string_t.c_str());
+        return serialize_wide_string(string_t.data(), string_t.size());
+    }
+
+    /*!
+     * @brief This function serializes a std::u16string.
+     * It has the same encoding as a std::wstring, but the characters are copied without conversion when the
+     * endianness matches.
+     * @param string_t The string that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& serialize(
+            const std::u16string& string_t)
+    {
+        return serialize_wide_string(string_t.data(), string_t.size());
+    }
+
+#if FASTCDR_HAVE_PMR
+    /*!
+     * @brief This function serializes a std::pmr::string.
+     * @param string_t The string that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when trying to serialize a string with null characters.
+     */
+    TEMPLATE_SPEC
+    Cdr& serialize(
+            const std::pmr::string& string_t)
+    {
+        return serialize_string(string_t.data(), string_t.size());
+    }
+
+    /*!
+     * @brief This function serializes a std::pmr::wstring.
+     * @param string_t The wstring that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& serialize(
+            const std::pmr::wstring& string_t)
+    {
+        return serialize_wide_string(string_t.data(), string_t.size());
+    }
+
+#endif // if FASTCDR_HAVE_PMR
+#if FASTCDR_HAVE_STRING_VIEW
+    /*!
+     * @brief This function serializes a std::string_view.
+     * @param string_t The string that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when trying to serialize a string with null characters.
+     */
+    TEMPLATE_SPEC
+    Cdr& serialize(
+            const std::string_view& string_t)
+    {
+        return serialize_string(string_t.data(), string_t.size());
     }
 
+#endif // if FASTCDR_HAVE_STRING_VIEW
     /*!
      * @brief Encodes a eprosima::fastcdr::fixed_string in the buffer.
      * @param[in] value A reference to the fixed string which will be encoded in the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to encode into a buffer
      * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when trying to encode a string with null
+     * characters.
      */
     template <size_t MAX_CHARS>
     Cdr& serialize(
             const fixed_string<MAX_CHARS>& value)
     {
-        return serialize(value.c_str());
+        return serialize_string(value.c_str(), value.size());
     }
 
     /*!
@@ -759,23 +1042,23 @@ public:
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
      */
-    template<class _T, typename std::enable_if<!std::is_enum<_T>::value &&
+    template<class _T, class _Alloc, typename std::enable_if<!std::is_enum<_T>::value &&
             !std::is_arithmetic<_T>::value>::type* = nullptr>
     Cdr& serialize(
-            const std::vector<_T>& vector_t)
+            const std::vector<_T, _Alloc>& vector_t)
     {
         Cdr::state dheader_state {allocate_xcdrv2_dheader()};
 
         serialize(static_cast<int32_t>(vector_t.size()));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(vector_t.data(), vector_t.size());
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             set_state(dheader_state);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         set_xcdrv2_dheader(dheader_state);
@@ -789,23 +1072,23 @@ public:
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
      */
-    template<class _T, typename std::enable_if<std::is_enum<_T>::value ||
-            std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _T, class _Alloc, typename std::enable_if<(std::is_enum<_T>::value ||
+            std::is_arithmetic<_T>::value) && !std::is_same<_T, bool>::value>::type* = nullptr>
     Cdr& serialize(
-            const std::vector<_T>& vector_t)
+            const std::vector<_T, _Alloc>& vector_t)
     {
         state state_before_error(*this);
 
         serialize(static_cast<int32_t>(vector_t.size()));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(vector_t.data(), vector_t.size());
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         if (CdrVersion::XCDRv2 == cdr_version_)
@@ -830,69 +1113,91 @@ public:
     }
 
     /*!
-     * @brief This function template serializes a map of non-primitive.
-     * @param map_t The map that will be serialized in the buffer.
+     * @brief This function template serializes a sequence of booleans which uses a custom allocator, like
+     * std::pmr::vector<bool>.
+     * @param vector_t The sequence that will be serialized in the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
      */
-    template<class _K, class _T, typename std::enable_if<!std::is_enum<_T>::value &&
-            !std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _Alloc>
     Cdr& serialize(
-            const std::map<_K, _T>& map_t)
+            const std::vector<bool, _Alloc>& vector_t)
     {
-        Cdr::state dheader_state {allocate_xcdrv2_dheader()};
+        state state_before_error(*this);
 
-        serialize(static_cast<int32_t>(map_t.size()));
+        serialize(static_cast<int32_t>(vector_t.size()));
 
-        try
+        FASTCDR_TRY
         {
-            for (auto it_pair = map_t.begin(); it_pair != map_t.end(); ++it_pair)
+            for (auto it = vector_t.begin(); CDR_ERROR_NONE == error_ && it != vector_t.end(); ++it)
             {
-                serialize(it_pair->first);
-                serialize(it_pair->second);
+                serialize(static_cast<bool>(*it));
             }
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
-            set_state(dheader_state);
-            ex.raise();
+            set_state(state_before_error);
+            FASTCDR_RETHROW;
         }
 
-        set_xcdrv2_dheader(dheader_state);
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+        }
 
         return *this;
     }
 
     /*!
-     * @brief This function template serializes a map of primitive.
-     * @param map_t The map that will be serialized in the buffer.
+     * @brief This function template serializes a bounded sequence stored in a eprosima::fastcdr::fixed_vector.
+     * @param vector_t The sequence that will be serialized in the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
      */
-    template<class _K, class _T, typename std::enable_if<std::is_enum<_T>::value ||
-            std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _T, size_t MAX_ELEMENTS>
     Cdr& serialize(
-            const std::map<_K, _T>& map_t)
+            const fixed_vector<_T, MAX_ELEMENTS>& vector_t)
     {
-        state state_(*this);
+        return serialize_sequence(vector_t.data(), vector_t.size());
+    }
 
-        serialize(static_cast<int32_t>(map_t.size()));
+    /*!
+     * @brief This function template serializes a map.
+     * @param map_t The map that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Compare, class _Alloc>
+    Cdr& serialize(
+            const std::map<_K, _T, _Compare, _Alloc>& map_t)
+    {
+        return serialize_map(map_t);
+    }
 
-        try
-        {
-            for (auto it_pair = map_t.begin(); it_pair != map_t.end(); ++it_pair)
-            {
-                serialize(it_pair->first);
-                serialize(it_pair->second);
-            }
-        }
-        catch (exception::Exception& ex)
-        {
-            set_state(state_);
-            ex.raise();
-        }
+    /*!
+     * @brief This function template serializes an unordered map.
+     * @param map_t The map that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Hash, class _Pred, class _Alloc>
+    Cdr& serialize(
+            const std::unordered_map<_K, _T, _Hash, _Pred, _Alloc>& map_t)
+    {
+        return serialize_map(map_t);
+    }
 
-        return *this;
+    /*!
+     * @brief This function template serializes a flat map.
+     * @param map_t The map that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Compare, class _Alloc>
+    Cdr& serialize(
+            const flat_map<_K, _T, _Compare, _Alloc>& map_t)
+    {
+        return serialize_map(map_t);
     }
 
     /*!
@@ -947,7 +1252,7 @@ public:
             const _T* value,
             size_t num_elements)
     {
-        for (size_t count = 0; count < num_elements; ++count)
+        for (size_t count = 0; CDR_ERROR_NONE == error_ && count < num_elements; ++count)
         {
             serialize(value[count]);
         }
@@ -972,15 +1277,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(type_t, num_elements);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -1042,6 +1347,21 @@ public:
         return serialize_array(reinterpret_cast<const int16_t*>(ushort_t), num_elements);
     }
 
+    /*!
+     * @brief This function serializes an array of UTF-16 characters.
+     * @param char16_t_ The array of UTF-16 characters that will be serialized in the buffer.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& serialize_array(
+            const char16_t* char16_t_,
+            size_t num_elements)
+    {
+        return serialize_array(reinterpret_cast<const int16_t*>(char16_t_), num_elements);
+    }
+
     /*!
      * @brief This function serializes an array of shorts.
      * @param short_t The array of shorts that will be serialized in the buffer.
@@ -1173,7 +1493,7 @@ public:
             const std::string* string_t,
             size_t num_elements)
     {
-        for (size_t count = 0; count < num_elements; ++count)
+        for (size_t count = 0; CDR_ERROR_NONE == error_ && count < num_elements; ++count)
         {
             serialize(string_t[count].c_str());
         }
@@ -1192,7 +1512,7 @@ public:
             const std::wstring* string_t,
             size_t num_elements)
     {
-        for (size_t count = 0; count < num_elements; ++count)
+        for (size_t count = 0; CDR_ERROR_NONE == error_ && count < num_elements; ++count)
         {
             serialize(string_t[count].c_str());
         }
@@ -1212,7 +1532,7 @@ public:
             const fixed_string<MAX_CHARS>* value,
             size_t num_elements)
     {
-        for (size_t count = 0; count < num_elements; ++count)
+        for (size_t count = 0; CDR_ERROR_NONE == error_ && count < num_elements; ++count)
         {
             serialize(value[count].c_str());
         }
@@ -1274,15 +1594,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(value);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -1321,14 +1641,14 @@ public:
 
         serialize(static_cast<int32_t>(num_elements));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(sequence_t, num_elements);
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             set_state(dheader_state);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         set_xcdrv2_dheader(dheader_state);
@@ -1353,14 +1673,14 @@ public:
 
         serialize(static_cast<int32_t>(num_elements));
 
-        try
+        FASTCDR_TRY
         {
             serialize_array(sequence_t, num_elements);
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         if (CdrVersion::XCDRv2 == cdr_version_)
@@ -1389,15 +1709,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             serialize_sequence(sequence_t, num_elements);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -1438,15 +1758,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             deserialize(value);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -1774,12 +2094,56 @@ public:
     TEMPLATE_SPEC
     Cdr& deserialize(
             std::wstring& string_t)
+    {
+        return deserialize_wide_string(string_t);
+    }
+
+    /*!
+     * @brief This function deserializes a std::u16string.
+     * It has the same encoding as a std::wstring, but the characters are copied without conversion when the
+     * endianness matches.
+     * @param string_t The variable that will store the string read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& deserialize(
+            std::u16string& string_t)
+    {
+        return deserialize_wide_string(string_t);
+    }
+
+#if FASTCDR_HAVE_PMR
+    /*!
+     * @brief This function deserializes a std::pmr::string.
+     * @param string_t The variable that will store the string read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& deserialize(
+            std::pmr::string& string_t)
     {
         uint32_t length = 0;
-        string_t = read_wstring(length);
+        const char* str = read_string(length);
+        string_t.assign(str, length);
         return *this;
     }
 
+    /*!
+     * @brief This function deserializes a std::pmr::wstring.
+     * @param string_t The variable that will store the string read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& deserialize(
+            std::pmr::wstring& string_t)
+    {
+        return deserialize_wide_string(string_t);
+    }
+
+#endif // if FASTCDR_HAVE_PMR
     /*!
      * @brief Decodes a fixed string.
      * @param[out] value Reference to the variable where the fixed string will be stored after decoding from the buffer.
@@ -1814,7 +2178,7 @@ public:
 
             uint32_t count {0};
             auto offset = offset_;
-            while (offset_ - offset < dheader && count < _Size)
+            while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < _Size)
             {
                 deserialize_array(&array_t.data()[count], 1);
                 ++count;
@@ -1822,7 +2186,7 @@ public:
 
             if (offset_ - offset != dheader)
             {
-                throw exception::BadParamException("Member size greater than size specified by DHEADER");
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
             }
         }
         else
@@ -1839,10 +2203,10 @@ public:
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
      */
-    template<class _T, typename std::enable_if<!std::is_enum<_T>::value &&
+    template<class _T, class _Alloc, typename std::enable_if<!std::is_enum<_T>::value &&
             !std::is_arithmetic<_T>::value>::type* = nullptr>
     Cdr& deserialize(
-            std::vector<_T>& vector_t)
+            std::vector<_T, _Alloc>& vector_t)
     {
         uint32_t sequence_length {0};
 
@@ -1866,7 +2230,7 @@ public:
             }
 
             uint32_t count {0};
-            while (offset_ - offset < dheader && count < sequence_length)
+            while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < sequence_length)
             {
                 deserialize(vector_t.data()[count]);
                 ++count;
@@ -1874,7 +2238,7 @@ public:
 
             if (offset_ - offset != dheader)
             {
-                throw exception::BadParamException("Member size differs from the size specified by DHEADER");
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size differs from the size specified by DHEADER");
             }
         }
         else
@@ -1892,19 +2256,18 @@ public:
             if ((end_ - offset_) < sequence_length)
             {
                 set_state(state_before_error);
-                throw exception::NotEnoughMemoryException(
-                          exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+                return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
             }
 
-            try
+            FASTCDR_TRY
             {
                 vector_t.resize(sequence_length);
                 return deserialize_array(vector_t.data(), vector_t.size());
             }
-            catch (exception::Exception& ex)
+            FASTCDR_CATCH(exception::Exception&)
             {
                 set_state(state_before_error);
-                ex.raise();
+                FASTCDR_RETHROW;
             }
         }
 
@@ -1913,14 +2276,16 @@ public:
 
     /*!
      * @brief This function template deserializes a sequence of primitive.
+     * The capacity of the sequence is reused. If it uses eprosima::fastcdr::default_init_allocator, the new elements
+     * are not zero-filled before being decoded.
      * @param vector_t The variable that will store the sequence read from the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
      */
-    template<class _T, typename std::enable_if<std::is_enum<_T>::value ||
-            std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _T, class _Alloc, typename std::enable_if<(std::is_enum<_T>::value ||
+            std::is_arithmetic<_T>::value) && !std::is_same<_T, bool>::value>::type* = nullptr>
     Cdr& deserialize(
-            std::vector<_T>& vector_t)
+            std::vector<_T, _Alloc>& vector_t)
     {
         uint32_t sequence_length = 0;
         state state_before_error(*this);
@@ -1936,19 +2301,18 @@ public:
         if ((end_ - offset_) < sequence_length)
         {
             set_state(state_before_error);
-            throw exception::NotEnoughMemoryException(
-                      exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
         }
 
-        try
+        FASTCDR_TRY
         {
             vector_t.resize(sequence_length);
             return deserialize_array(vector_t.data(), vector_t.size());
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -1968,68 +2332,111 @@ public:
     }
 
     /*!
-     * @brief This function template deserializes a map of non-primitive.
-     * @param map_t The variable that will store the map read from the buffer.
+     * @brief This function template deserializes a sequence of booleans which uses a custom allocator, like
+     * std::pmr::vector<bool>.
+     * @param vector_t The variable that will store the sequence read from the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when a decoded byte is neither 0 nor 1.
      */
-    template<class _K, class _T, typename std::enable_if<!std::is_enum<_T>::value &&
-            !std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _Alloc>
     Cdr& deserialize(
-            std::map<_K, _T>& map_t)
+            std::vector<bool, _Alloc>& vector_t)
     {
-        if (CdrVersion::XCDRv2 == cdr_version_)
-        {
-            uint32_t dheader {0};
-            deserialize(dheader);
+        uint32_t sequence_length {0};
+        state state_before_error(*this);
 
-            auto offset = offset_;
+        deserialize(sequence_length);
 
-            uint32_t map_length {0};
-            deserialize(map_length);
+        if ((end_ - offset_) < sequence_length)
+        {
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        }
 
-            map_t.clear();
+        FASTCDR_TRY
+        {
+            vector_t.resize(sequence_length);
+            for (auto it = vector_t.begin(); CDR_ERROR_NONE == error_ && it != vector_t.end(); ++it)
+            {
+                bool value {false};
+                deserialize(value);
+                *it = value;
+            }
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(state_before_error);
+            FASTCDR_RETHROW;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief This function template deserializes a bounded sequence of non-primitive into a
+     * eprosima::fastcdr::fixed_vector.
+     * @param vector_t The variable that will store the sequence read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the length of the sequence exceeds the bound.
+     */
+    template<class _T, size_t MAX_ELEMENTS, typename std::enable_if<!std::is_enum<_T>::value &&
+            !std::is_arithmetic<_T>::value>::type* = nullptr>
+    Cdr& deserialize(
+            fixed_vector<_T, MAX_ELEMENTS>& vector_t)
+    {
+        uint32_t sequence_length {0};
+        state state_before_error(*this);
+
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            uint32_t dheader {0};
+            deserialize(dheader);
+
+            auto offset = offset_;
+
+            deserialize(sequence_length);
+
+            if (MAX_ELEMENTS < sequence_length)
+            {
+                set_state(state_before_error);
+                return report_error(CDR_ERROR_BAD_PARAM, "Sequence length exceeds the bound of the fixed_vector");
+            }
+
+            vector_t.resize(sequence_length);
 
             uint32_t count {0};
-            while (offset_ - offset < dheader && count < map_length)
+            while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < sequence_length)
             {
-                _K key;
-                _T val;
-                deserialize(key);
-                deserialize(val);
-                map_t.emplace(std::pair<_K, _T>(std::move(key), std::move(val)));
+                deserialize(vector_t.data()[count]);
                 ++count;
             }
 
             if (offset_ - offset != dheader)
             {
-                throw exception::BadParamException("Member size greater than size specified by DHEADER");
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size differs from the size specified by DHEADER");
             }
         }
         else
         {
-            uint32_t sequence_length = 0;
-            state state_(*this);
-
             deserialize(sequence_length);
 
-            map_t.clear();
+            if (MAX_ELEMENTS < sequence_length)
+            {
+                set_state(state_before_error);
+                return report_error(CDR_ERROR_BAD_PARAM, "Sequence length exceeds the bound of the fixed_vector");
+            }
 
-            try
+            FASTCDR_TRY
             {
-                for (uint32_t i = 0; i < sequence_length; ++i)
-                {
-                    _K key;
-                    _T value;
-                    deserialize(key);
-                    deserialize(value);
-                    map_t.emplace(std::pair<_K, _T>(std::move(key), std::move(value)));
-                }
+                vector_t.resize(sequence_length);
+                return deserialize_array(vector_t.data(), vector_t.size());
             }
-            catch (exception::Exception& ex)
+            FASTCDR_CATCH(exception::Exception&)
             {
-                set_state(state_);
-                ex.raise();
+                set_state(state_before_error);
+                FASTCDR_RETHROW;
             }
         }
 
@@ -2037,41 +2444,93 @@ public:
     }
 
     /*!
-     * @brief This function template deserializes a map of primitive.
-     * @param map_t The variable that will store the map read from the buffer.
+     * @brief This function template deserializes a bounded sequence of primitive into a
+     * eprosima::fastcdr::fixed_vector.
+     * @param vector_t The variable that will store the sequence read from the buffer.
      * @return Reference to the eprosima::fastcdr::Cdr object.
      * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the length of the sequence exceeds the bound.
      */
-    template<class _K, class _T, typename std::enable_if<std::is_enum<_T>::value ||
+    template<class _T, size_t MAX_ELEMENTS, typename std::enable_if<std::is_enum<_T>::value ||
             std::is_arithmetic<_T>::value>::type* = nullptr>
     Cdr& deserialize(
-            std::map<_K, _T>& map_t)
+            fixed_vector<_T, MAX_ELEMENTS>& vector_t)
     {
-        uint32_t sequence_length = 0;
-        state state_(*this);
+        uint32_t sequence_length {0};
+        state state_before_error(*this);
 
         deserialize(sequence_length);
 
-        try
+        if (MAX_ELEMENTS < sequence_length)
         {
-            for (uint32_t i = 0; i < sequence_length; ++i)
-            {
-                _K key;
-                _T value;
-                deserialize(key);
-                deserialize(value);
-                map_t.emplace(std::pair<_K, _T>(std::move(key), std::move(value)));
-            }
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_BAD_PARAM, "Sequence length exceeds the bound of the fixed_vector");
         }
-        catch (exception::Exception& ex)
+
+        if ((end_ - offset_) < sequence_length)
         {
-            set_state(state_);
-            ex.raise();
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        }
+
+        FASTCDR_TRY
+        {
+            vector_t.resize(sequence_length);
+            return deserialize_array(vector_t.data(), vector_t.size());
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(state_before_error);
+            FASTCDR_RETHROW;
         }
 
         return *this;
     }
 
+    /*!
+     * @brief This function template deserializes a map.
+     * The decoded elements are inserted at the end using a hint, so decoding a map whose keys were encoded in order
+     * doesn't search the tree.
+     * @param map_t The variable that will store the map read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Compare, class _Alloc>
+    Cdr& deserialize(
+            std::map<_K, _T, _Compare, _Alloc>& map_t)
+    {
+        return deserialize_map(map_t);
+    }
+
+    /*!
+     * @brief This function template deserializes an unordered map.
+     * Buckets for the encoded number of elements are reserved before decoding them.
+     * @param map_t The variable that will store the map read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Hash, class _Pred, class _Alloc>
+    Cdr& deserialize(
+            std::unordered_map<_K, _T, _Hash, _Pred, _Alloc>& map_t)
+    {
+        return deserialize_map(map_t);
+    }
+
+    /*!
+     * @brief This function template deserializes a flat map.
+     * Storage for the encoded number of elements is reserved before decoding them. Elements encoded in key order are
+     * appended without searching.
+     * @param map_t The variable that will store the map read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _K, class _T, class _Compare, class _Alloc>
+    Cdr& deserialize(
+            flat_map<_K, _T, _Compare, _Alloc>& map_t)
+    {
+        return deserialize_map(map_t);
+    }
+
     /*!
      * @brief Decodes a bitset from the buffer.
      * @param[out] value Reference to the variable where the bitset will be stored after decoding from the buffer.
@@ -2135,7 +2594,7 @@ public:
             _T* value,
             size_t num_elements)
     {
-        for (size_t count = 0; count < num_elements; ++count)
+        for (size_t count = 0; CDR_ERROR_NONE == error_ && count < num_elements; ++count)
         {
             deserialize(value[count]);
         }
@@ -2160,15 +2619,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             deserialize_array(type_t, num_elements);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -2230,6 +2689,21 @@ public:
         return deserialize_array(reinterpret_cast<int16_t*>(ushort_t), num_elements);
     }
 
+    /*!
+     * @brief This function deserializes an array of UTF-16 characters.
+     * @param char16_t_ The variable that will store the array of UTF-16 characters read from the buffer.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    TEMPLATE_SPEC
+    Cdr& deserialize_array(
+            char16_t* char16_t_,
+            size_t num_elements)
+    {
+        return deserialize_array(reinterpret_cast<int16_t*>(char16_t_), num_elements);
+    }
+
     /*!
      * @brief This function deserializes an array of shorts.
      * @param short_t The variable that will store the array of shorts read from the buffer.
@@ -2391,7 +2865,7 @@ public:
 
             uint32_t count {0};
             auto offset = offset_;
-            while (offset_ - offset < dheader && count < value.size())
+            while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < value.size())
             {
                 deserialize_array(&value.data()[count], 1);
                 ++count;
@@ -2399,7 +2873,7 @@ public:
 
             if (offset_ - offset != dheader)
             {
-                throw exception::BadParamException("Member size greater than size specified by DHEADER");
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
             }
         }
         else
@@ -2430,15 +2904,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             deserialize_array(value);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -2489,12 +2963,12 @@ public:
 
             deserialize(sequence_length);
 
-            try
+            FASTCDR_TRY
             {
                 sequence_t = reinterpret_cast<_T*>(calloc(sequence_length, sizeof(_T)));
 
                 uint32_t count {0};
-                while (offset_ - offset < dheader && count < sequence_length)
+                while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < sequence_length)
                 {
                     deserialize(sequence_t[count]);
                     ++count;
@@ -2502,14 +2976,16 @@ public:
 
                 if (offset_ - offset != dheader)
                 {
-                    throw exception::BadParamException("Member size greater than size specified by DHEADER");
+                    free(sequence_t);
+                    sequence_t = NULL;
+                    return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
                 }
             }
-            catch (exception::Exception& ex)
+            FASTCDR_CATCH(exception::Exception&)
             {
                 free(sequence_t);
                 sequence_t = NULL;
-                ex.raise();
+                FASTCDR_RETHROW;
             }
         }
         else
@@ -2521,21 +2997,20 @@ public:
             if ((end_ - offset_) < sequence_length)
             {
                 set_state(state_before_error);
-                throw exception::NotEnoughMemoryException(
-                          exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+                return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
             }
 
-            try
+            FASTCDR_TRY
             {
                 sequence_t = reinterpret_cast<_T*>(calloc(sequence_length, sizeof(_T)));
                 deserialize_array(sequence_t, sequence_length);
             }
-            catch (exception::Exception& ex)
+            FASTCDR_CATCH(exception::Exception&)
             {
                 free(sequence_t);
                 sequence_t = NULL;
                 set_state(state_before_error);
-                ex.raise();
+                FASTCDR_RETHROW;
             }
         }
 
@@ -2563,17 +3038,17 @@ public:
 
         deserialize(sequence_length);
 
-        try
+        FASTCDR_TRY
         {
             sequence_t = reinterpret_cast<_T*>(calloc(sequence_length, sizeof(_T)));
             deserialize_array(sequence_t, sequence_length);
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             free(sequence_t);
             sequence_t = NULL;
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         num_elements = sequence_length;
@@ -2600,15 +3075,15 @@ public:
         swap_bytes_ = (swap_bytes_ && (static_cast<Endianness>(endianness_) == endianness)) ||
                 (!swap_bytes_ && (static_cast<Endianness>(endianness_) != endianness));
 
-        try
+        FASTCDR_TRY
         {
             deserialize_sequence(sequence_t, num_elements);
             swap_bytes_ = aux_swap;
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             swap_bytes_ = aux_swap;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
 
         return *this;
@@ -2735,7 +3210,7 @@ public:
             size_t diff {offset_ - prev_offset};
             if (member_size < diff)
             {
-                throw exception::BadParamException(
+                return report_error(CDR_ERROR_BAD_PARAM,
                           "Member size provided by member header is lower than real decoded member size");
             }
 
@@ -2783,6 +3258,54 @@ public:
             EncodingAlgorithmFlag type_encoding,
             std::function<bool (Cdr&, const MemberId&)> functor);
 
+    /*!
+     * @brief Decodes only the selected members of a type, skipping the rest.
+     *
+     * In EncodingAlgorithmFlag::PL_CDR and EncodingAlgorithmFlag::PL_CDR2 the functor is only called for the selected
+     * members, and the rest are skipped using the size in their member headers. In EncodingAlgorithmFlag::PL_CDR2 and
+     * EncodingAlgorithmFlag::DELIMIT_CDR2, the members after the last selected one are skipped using the DHEADER.
+     * Members without a member header have to be decoded by the functor to reach the next one, so it is called for
+     * them as @ref deserialize_type does.
+     * A member path is selected by calling this function from the functor of the enclosing type.
+     * @param[in] type_encoding The encoding algorithm used to decode the type and its members.
+     * @param[in] member_ids Identifiers of the selected members.
+     * @param[in] functor Functor called each time a member has to be decoded.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to decode from a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the decoded size of a selected member
+     * doesn't match the size in its member header.
+     */
+    Cdr_DllAPI Cdr& deserialize_type(
+            EncodingAlgorithmFlag type_encoding,
+            const std::vector<uint32_t>& member_ids,
+            std::function<bool (Cdr&, const MemberId&)> functor);
+
+    /*!
+     * @brief Decodes a member header, for decoders which walk the members of a type without @ref deserialize_type.
+     * The header is decoded according to XCDRv2 when the current encoding algorithm is EncodingAlgorithmFlag::PL_CDR2,
+     * and according to XCDRv1 otherwise, as the header encoded before optional members in
+     * EncodingAlgorithmFlag::PLAIN_CDR.
+     * @param[out] member_id Member identifier.
+     * @param[out] member_size Size of the member value, as given by its member header.
+     * @return false if the XCDRv1 sentinel was found or the header could not be decoded.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to decode from a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the member header is not valid.
+     */
+    Cdr_DllAPI bool deserialize_member_header(
+            MemberId& member_id,
+            uint32_t& member_size);
+
+    /*!
+     * @brief Tells the encoder the last encoded value is a sequence of primitives which was encoded element by element.
+     * In XCDRv2 the member header of the enclosing member reuses the length of the sequence, as when the sequence is
+     * encoded at once.
+     * @param[in] element_size Size in bytes of the elements of the sequence.
+     */
+    Cdr_DllAPI void set_encoded_primitive_sequence(
+            size_t element_size);
+
     /*!
      * @brief Encodes an optional in the buffer.
      * @param[in] value A reference to the optional which will be encoded in the buffer.
@@ -2820,7 +3343,7 @@ public:
     {
         if (!value)
         {
-            throw exception::BadParamException("External member is null");
+            return report_error(CDR_ERROR_BAD_PARAM, "External member is null");
         }
 
         serialize(*value);
@@ -2875,12 +3398,23 @@ public:
     {
         if (value.is_locked())
         {
-            throw exception::BadParamException("External member is locked");
+            return report_error(CDR_ERROR_BAD_PARAM, "External member is locked");
         }
 
         if (!value)
         {
-            value = external<_T>{new typename external<_T>::type()};
+#if FASTCDR_HAVE_PMR
+            if (nullptr != memory_resource_)
+            {
+                value = external<_T>{std::allocate_shared<typename external<_T>::type>(
+                                         std::pmr::polymorphic_allocator<typename external<_T>::type>(
+                                             get_memory_resource()))};
+            }
+            else
+#endif // if FASTCDR_HAVE_PMR
+            {
+                value = external<_T>{new typename external<_T>::type()};
+            }
         }
 
         deserialize(*value);
@@ -2901,7 +3435,7 @@ public:
     {
         if (value.has_value() && value.value().is_locked())
         {
-            throw exception::BadParamException("External member is locked");
+            return report_error(CDR_ERROR_BAD_PARAM, "External member is locked");
         }
 
         bool is_present = true;
@@ -2933,116 +3467,700 @@ public:
     Cdr_DllAPI void set_xcdrv2_dheader(
             const state& state);
 
-private:
-
-    Cdr(
-            const Cdr&) = delete;
-
-    Cdr& operator =(
-            const Cdr&) = delete;
-
-    Cdr_DllAPI Cdr& serialize_bool_array(
-            const std::vector<bool>& vector_t);
-
-    Cdr_DllAPI Cdr& serialize_bool_sequence(
-            const std::vector<bool>& vector_t);
-
-    Cdr_DllAPI Cdr& deserialize_bool_array(
-            std::vector<bool>& vector_t);
-
-    Cdr_DllAPI Cdr& deserialize_bool_sequence(
-            std::vector<bool>& vector_t);
-
-    Cdr_DllAPI Cdr& deserialize_string_sequence(
-            std::string*& sequence_t,
-            size_t& num_elements);
-
-    Cdr_DllAPI Cdr& deserialize_wstring_sequence(
-            std::wstring*& sequence_t,
-            size_t& num_elements);
-
     /*!
-     * @brief This function template detects the content type of the STD container array and serializes the array.
-     * @param array_t The array that will be serialized in the buffer.
-     * @param num_elements Number of the elements in the array.
-     * @return Reference to the eprosima::fastcdr::Cdr object.
-     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
-     */
-    template<class _T, size_t _Size>
-    Cdr& serialize_array(
-            const std::array<_T, _Size>* array_t,
-            size_t num_elements)
-    {
-        return serialize_array(array_t->data(), num_elements * array_t->size());
-    }
+     * @brief Skips an encoded value using its runtime description, without decoding it nor allocating memory.
+     *
+     * When not validating, the DHEADER of XCDRv2 types and sequences, and the member headers of XCDRv1 mutable types,
+     * are used to jump over the encoded value. When validating, the whole value is walked checking the lengths
+     * against the remaining bytes, the bounds, the DHEADERs and member headers against the decoded sizes, the string
+     * terminators and the boolean values.
+     * @param[in] description Description of the data model.
+     * @param[in] type Index of the type of the encoded value.
+     * @param[in] validate Whether the encoded value is validated.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the
+     * whole value.
+     * @exception exception::BadParamException This exception is thrown when the encoded value is not valid.
+     */
+    Cdr_DllAPI Cdr& skip(
+            const TypeDescription& description,
+            TypeDescription::TypeIndex type,
+            bool validate = false);
+
+    /*!
+     * @brief Changes in place the endianness of an encoded value using its runtime description, without decoding it
+     * nor allocating memory.
+     *
+     * The value is walked as eprosima::fastcdr::Cdr::skip does when validating, using the current endianness, and the
+     * bytes of every multi-byte primitive, length, DHEADER and member header are reversed in place. The endianness of
+     * the eprosima::fastcdr::Cdr object is not changed. Members not found in the description can't be swapped, so
+     * they are reported as an error.
+     * @param[in] description Description of the data model.
+     * @param[in] type Index of the type of the encoded value.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the
+     * whole value.
+     * @exception exception::BadParamException This exception is thrown when the encoded value is not valid. The
+     * value is left partially swapped.
+     */
+    Cdr_DllAPI Cdr& transcode_endianness(
+            const TypeDescription& description,
+            TypeDescription::TypeIndex type);
+
+    /*!
+     * @brief Jumps over primitive values, aligning to the first one, without decoding them.
+     * @param[in] kind Kind of the primitive values.
+     * @param[in] num_elements Number of values.
+     * @return false if the buffer doesn't contain the values.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the
+     * values.
+     */
+    Cdr_DllAPI bool jump_primitives(
+            TypeKind kind,
+            size_t num_elements);
 
     /*!
-     * @brief This function template detects the content type of the STD container array and deserializes the array.
-     * @param array_t The variable that will store the array read from the buffer.
-     * @param num_elements Number of the elements in the array.
+     * @brief Encodes a fixed-layout object using a precomputed plan, checking the bounds of the buffer once.
+     * The result is the same as encoding the members of the plan one by one.
+     * @param[in] plan Plan of the type of the object. Its CDR version and initial alignment have to match the
+     * current state of the encoder.
+     * @param[in] data Pointer to the object.
      * @return Reference to the eprosima::fastcdr::Cdr object.
-     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to encode into a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the plan doesn't match the current
+     * CDR version or alignment.
      */
-    template<class _T, size_t _Size>
-    Cdr& deserialize_array(
-            std::array<_T, _Size>* array_t,
-            size_t num_elements)
-    {
-        return deserialize_array(array_t->data(), num_elements * array_t->size());
-    }
+    Cdr_DllAPI Cdr& serialize_with_plan(
+            const SerializationPlan& plan,
+            const void* data);
 
     /*!
-     * @brief This function template detects the content type of STD container array and deserializes the array with a different endianness.
-     * @param array_t The variable that will store the array read from the buffer.
-     * @param num_elements Number of the elements in the array.
-     * @param endianness Endianness that will be used in the deserialization of this value.
+     * @brief Decodes a fixed-layout object using a precomputed plan, checking the bounds of the buffer once.
+     * The result is the same as decoding the members of the plan one by one.
+     * @param[in] plan Plan of the type of the object. Its CDR version and initial alignment have to match the
+     * current state of the decoder.
+     * @param[out] data Pointer to the object.
      * @return Reference to the eprosima::fastcdr::Cdr object.
-     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to decode from a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the plan doesn't match the current
+     * CDR version or alignment, or when a decoded boolean is neither 0 nor 1.
      */
-    template<class _T, size_t _Size>
-    Cdr& deserialize_array(
-            std::array<_T, _Size>* array_t,
-            size_t num_elements,
-            Endianness endianness)
-    {
-        return deserialize_array(array_t->data(), num_elements * array_t->size(), endianness);
-    }
+    Cdr_DllAPI Cdr& deserialize_with_plan(
+            const SerializationPlan& plan,
+            void* data);
 
     /*!
-     * @brief Returns the number of bytes needed to align the current position (having as reference the origin) to
-     * certain data size.
-     * @param data_size The size of the data that will be serialized.
-     * @return The size needed for the alignment.
+     * @brief This class encodes primitive values into a region of the buffer which was reserved once, without
+     * checking the bounds of the buffer nor trying to resize it on each operation.
+     *
+     * The region is reserved on construction. The number of bytes to be reserved has to include the alignment
+     * bytes, so it should be calculated using eprosima::fastcdr::CdrSizeCalculator with the current alignment.
+     * Values are aligned and their endianness is swapped as eprosima::fastcdr::Cdr does, so both APIs can be
+     * interleaved while the encoded values fit in the region. Nothing is encoded if the region could not be reserved.
      */
-    inline size_t alignment(
-            size_t data_size) const
+    class unchecked_writer
     {
-        return data_size > last_data_size_ ? (data_size - ((offset_ - origin_) % data_size)) & (data_size - 1) : 0;
-    }
+    public:
 
-    /*!
-     * @brief This function jumps the number of bytes of the alignment. These bytes should be calculated with the function eprosima::fastcdr::Cdr::alignment.
-     * @param align The number of bytes to be skipped.
-     */
-    inline void make_alignment(
-            size_t align)
-    {
-        offset_ += align;
-        last_data_size_ = 0;
-    }
+        /*!
+         * @brief Reserves a region of the buffer.
+         * @param[in] cdr Encoder used to reserve the region.
+         * @param[in] num_bytes Number of bytes to be reserved, including alignment bytes.
+         * @exception exception::NotEnoughMemoryException This exception is thrown when the region cannot be
+         * reserved. In ErrorMode::STICKY_ERROR the error is stored and the region is not valid.
+         */
+        unchecked_writer(
+                Cdr& cdr,
+                size_t num_bytes)
+            : cdr_(cdr)
+        {
+            if (((cdr_.end_ - cdr_.offset_) >= num_bytes) || cdr_.resize(num_bytes))
+            {
+                valid_ = true;
+                region_end_ = (cdr_.offset_ - cdr_.cdr_buffer_.begin()) + num_bytes;
+            }
+            else
+            {
+                cdr_.report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+            }
+        }
 
-    /*!
-     * @brief This function resizes the internal buffer. It only applies if the FastBuffer object was created with the default constructor.
-     * @param min_size_inc Minimun size increase for the internal buffer
-     * @return True if the resize was succesful, false if it was not
-     */
-    bool resize(
-            size_t min_size_inc);
+        /*!
+         * @brief Returns whether the region was reserved.
+         * @return true if the region is valid.
+         */
+        explicit operator bool() const
+        {
+            return valid_;
+        }
 
-    Cdr_DllAPI const char* read_string(
-            uint32_t& length);
-    Cdr_DllAPI const std::wstring read_wstring(
-            uint32_t& length);
+        /*!
+         * @brief Encodes a primitive value or an enumerator into the region.
+         * @param[in] value Value to be encoded.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_writer& serialize(
+                const _T& value)
+        {
+            if (valid_)
+            {
+                cdr_.unchecked_serialize(value, region_end_);
+            }
+            return *this;
+        }
+
+        /*!
+         * @brief Encodes an array of primitive values or enumerators into the region.
+         * @param[in] values Pointer to the first value.
+         * @param[in] num_elements Number of values to be encoded.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_writer& serialize_array(
+                const _T* values,
+                size_t num_elements)
+        {
+            for (size_t count {0}; valid_ && count < num_elements; ++count)
+            {
+                cdr_.unchecked_serialize(values[count], region_end_);
+            }
+            return *this;
+        }
+
+        /*!
+         * @brief Encodes a primitive value or an enumerator into the region.
+         * @param[in] value Value to be encoded.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_writer& operator <<(
+                const _T& value)
+        {
+            return serialize(value);
+        }
+
+    private:
+
+        Cdr& cdr_;
+
+        bool valid_ {false};
+
+        size_t region_end_ {0};
+    };
+
+    /*!
+     * @brief This class decodes primitive values from a region of the buffer which was checked once, without
+     * checking the bounds of the buffer on each operation.
+     *
+     * The region is checked on construction. The number of bytes to be checked has to include the alignment bytes,
+     * so it should be calculated using eprosima::fastcdr::CdrSizeCalculator with the current alignment.
+     * Values are aligned and their endianness is swapped as eprosima::fastcdr::Cdr does, so both APIs can be
+     * interleaved while the decoded values fit in the region. Nothing is decoded if the region could not be checked.
+     */
+    class unchecked_reader
+    {
+    public:
+
+        /*!
+         * @brief Checks a region of the buffer.
+         * @param[in] cdr Decoder used to check the region.
+         * @param[in] num_bytes Number of bytes to be checked, including alignment bytes.
+         * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain
+         * the region. In ErrorMode::STICKY_ERROR the error is stored and the region is not valid.
+         */
+        unchecked_reader(
+                Cdr& cdr,
+                size_t num_bytes)
+            : cdr_(cdr)
+        {
+            if ((cdr_.end_ - cdr_.offset_) >= num_bytes)
+            {
+                valid_ = true;
+                region_end_ = (cdr_.offset_ - cdr_.cdr_buffer_.begin()) + num_bytes;
+            }
+            else
+            {
+                cdr_.report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+            }
+        }
+
+        /*!
+         * @brief Returns whether the region was checked successfully.
+         * @return true if the region is valid.
+         */
+        explicit operator bool() const
+        {
+            return valid_;
+        }
+
+        /*!
+         * @brief Decodes a primitive value or an enumerator from the region.
+         * @param[out] value Reference to the variable where the value will be stored.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_reader& deserialize(
+                _T& value)
+        {
+            if (valid_)
+            {
+                cdr_.unchecked_deserialize(value, region_end_);
+            }
+            return *this;
+        }
+
+        /*!
+         * @brief Decodes an array of primitive values or enumerators from the region.
+         * @param[out] values Pointer to the first variable where the values will be stored.
+         * @param[in] num_elements Number of values to be decoded.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_reader& deserialize_array(
+                _T* values,
+                size_t num_elements)
+        {
+            for (size_t count {0}; valid_ && count < num_elements; ++count)
+            {
+                cdr_.unchecked_deserialize(values[count], region_end_);
+            }
+            return *this;
+        }
+
+        /*!
+         * @brief Decodes a primitive value or an enumerator from the region.
+         * @param[out] value Reference to the variable where the value will be stored.
+         * @return Reference to this object.
+         */
+        template<class _T>
+        unchecked_reader& operator >>(
+                _T& value)
+        {
+            return deserialize(value);
+        }
+
+    private:
+
+        Cdr& cdr_;
+
+        bool valid_ {false};
+
+        size_t region_end_ {0};
+    };
+
+    /*!
+     * @brief This class gives access on demand to the members of a mutable type (EncodingAlgorithmFlag::PL_CDR or
+     * EncodingAlgorithmFlag::PL_CDR2) encoded in the buffer.
+     *
+     * On construction the decoder is moved past the encoded type, as @ref deserialize_type would do. The member
+     * headers are scanned once, on the first lookup, building an index from member identifier to the position and
+     * size of the member. Members are then decoded on demand, without decoding the rest of members.
+     * In XCDRv1 there is no DHEADER, so the member headers are scanned on construction to find the end of the type.
+     *
+     * The buffer must not be modified while the index is in use.
+     */
+    class member_index
+    {
+    public:
+
+        /*!
+         * @brief Skips the mutable type which starts at the current position of the decoder.
+         * @param[in] cdr Decoder positioned at the beginning of the mutable type.
+         * @param[in] type_encoding Encoding algorithm of the type. It has to be EncodingAlgorithmFlag::PL_CDR in
+         * XCDRv1 and EncodingAlgorithmFlag::PL_CDR2 in XCDRv2.
+         * @exception exception::BadParamException This exception is thrown when the encoding algorithm is not
+         * supported or a member header is not valid.
+         * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain
+         * the whole type.
+         * In ErrorMode::STICKY_ERROR the error is stored and the index is not valid.
+         */
+        Cdr_DllAPI member_index(
+                Cdr& cdr,
+                EncodingAlgorithmFlag type_encoding);
+
+        /*!
+         * @brief Returns whether the mutable type was skipped successfully.
+         * @return true if the index is valid.
+         */
+        explicit operator bool() const
+        {
+            return valid_;
+        }
+
+        /*!
+         * @brief Returns whether a member is present in the encoded type.
+         * @param[in] member_id Identifier of the member.
+         * @return true if the member is present.
+         */
+        Cdr_DllAPI bool contains(
+                const MemberId& member_id);
+
+        /*!
+         * @brief Returns the number of members present in the encoded type.
+         * @return Number of members.
+         */
+        Cdr_DllAPI size_t size();
+
+        /*!
+         * @brief Decodes a member. The position of the decoder is kept.
+         * @param[in] member_id Identifier of the member.
+         * @param[out] value Reference to the variable where the member will be stored.
+         * @return false if the member is not present or could not be decoded.
+         * @exception exception::BadParamException This exception is thrown when the decoded size of the member
+         * doesn't match the size in its member header.
+         */
+        template<class _T>
+        bool deserialize_member(
+                const MemberId& member_id,
+                _T& value)
+        {
+            const location* member {find(member_id)};
+
+            if (nullptr == member)
+            {
+                return false;
+            }
+
+            Cdr::state previous_state(cdr_);
+            move_to(member_id, *member);
+
+            FASTCDR_TRY
+            {
+                cdr_.deserialize(value);
+            }
+            FASTCDR_CATCH(exception::Exception&)
+            {
+                restore(previous_state);
+                FASTCDR_RETHROW;
+            }
+
+            return check_and_restore(*member, previous_state);
+        }
+
+    private:
+
+        //! Position and size of an encoded member.
+        struct location
+        {
+            //! Position of the member value, relative to the beginning of the buffer.
+            size_t offset {0};
+
+            //! Size of the member value, as given by its member header.
+            uint32_t size {0};
+        };
+
+        //! Scans the member headers from the current position of the decoder.
+        Cdr_DllAPI bool build();
+
+        //! Scans the member headers the first time it is called.
+        Cdr_DllAPI bool ensure_index();
+
+        //! Returns the location of a member, or nullptr if it is not present.
+        Cdr_DllAPI const location* find(
+                const MemberId& member_id);
+
+        //! Positions the decoder at the beginning of a member value.
+        Cdr_DllAPI void move_to(
+                const MemberId& member_id,
+                const location& member);
+
+        //! Restores the decoder to a previous state.
+        Cdr_DllAPI void restore(
+                const Cdr::state& previous_state);
+
+        //! Checks the decoded size of a member and restores the decoder to a previous state.
+        Cdr_DllAPI bool check_and_restore(
+                const location& member,
+                const Cdr::state& previous_state);
+
+        Cdr& cdr_;
+
+        EncodingAlgorithmFlag type_encoding_ {EncodingAlgorithmFlag::PL_CDR2};
+
+        bool valid_ {false};
+
+        bool built_ {false};
+
+        //! Position of the first member header, relative to the beginning of the buffer.
+        size_t begin_ {0};
+
+        //! Position where the members end, relative to the beginning of the buffer.
+        size_t end_ {0};
+
+        //! Position from which XCDRv2 alignment is calculated, relative to the beginning of the buffer.
+        size_t origin_ {0};
+
+        flat_map<uint32_t, location> members_;
+    };
+
+    /*!
+     * @brief This class accounts one more nested value while walking an encoded value using a runtime description.
+     *
+     * The nesting depth is increased on construction and decreased on destruction. When the maximum set through
+     * @ref set_max_nesting_depth would be exceeded, the depth is not increased and the error is reported.
+     */
+    class nesting_scope
+    {
+    public:
+
+        /*!
+         * @brief Enters a nested value.
+         * @param[in] cdr Encoder or decoder walking the value.
+         * @exception exception::BadParamException This exception is thrown when the maximum nesting depth is
+         * exceeded. In ErrorMode::STICKY_ERROR the error is stored and the scope is not valid.
+         */
+        explicit nesting_scope(
+                Cdr& cdr)
+            : cdr_(cdr)
+        {
+            if (cdr_.nesting_depth_ < cdr_.max_nesting_depth_)
+            {
+                ++cdr_.nesting_depth_;
+                valid_ = true;
+            }
+            else
+            {
+                cdr_.report_error(CDR_ERROR_BAD_PARAM, "Maximum nesting depth exceeded");
+            }
+        }
+
+        //! Leaves the nested value.
+        ~nesting_scope()
+        {
+            if (valid_)
+            {
+                --cdr_.nesting_depth_;
+            }
+        }
+
+        nesting_scope(
+                const nesting_scope&) = delete;
+
+        nesting_scope& operator =(
+                const nesting_scope&) = delete;
+
+        /*!
+         * @brief Returns whether the nested value was entered.
+         * @return true if the maximum nesting depth was not exceeded.
+         */
+        explicit operator bool() const
+        {
+            return valid_;
+        }
+
+    private:
+
+        Cdr& cdr_;
+
+        bool valid_ {false};
+    };
+
+private:
+
+    Cdr(
+            const Cdr&) = delete;
+
+    Cdr& operator =(
+            const Cdr&) = delete;
+
+    /*!
+     * @brief Gives the attached checksum and compressor the bytes which won't be patched anymore.
+     */
+    Cdr_DllAPI void update_stable_bytes();
+
+    /*!
+     * @brief Marks the current position as the beginning of a region with a header pending to be patched, so its bytes
+     * are not given to the checksum and compressor until the region ends.
+     */
+    void begin_patched_region();
+
+    /*!
+     * @brief Marks the end of the innermost region with a header pending to be patched.
+     */
+    void end_patched_region();
+
+    Cdr_DllAPI Cdr& serialize_bool_array(
+            const std::vector<bool>& vector_t);
+
+    Cdr_DllAPI Cdr& serialize_bool_sequence(
+            const std::vector<bool>& vector_t);
+
+    Cdr_DllAPI Cdr& deserialize_bool_array(
+            std::vector<bool>& vector_t);
+
+    Cdr_DllAPI Cdr& deserialize_bool_sequence(
+            std::vector<bool>& vector_t);
+
+    Cdr_DllAPI Cdr& deserialize_string_sequence(
+            std::string*& sequence_t,
+            size_t& num_elements);
+
+    Cdr_DllAPI Cdr& deserialize_wstring_sequence(
+            std::wstring*& sequence_t,
+            size_t& num_elements);
+
+    /*!
+     * @brief This function template detects the content type of the STD container array and serializes the array.
+     * @param array_t The array that will be serialized in the buffer.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _T, size_t _Size>
+    Cdr& serialize_array(
+            const std::array<_T, _Size>* array_t,
+            size_t num_elements)
+    {
+        return serialize_array(array_t->data(), num_elements * array_t->size());
+    }
+
+    /*!
+     * @brief This function template detects the content type of the STD container array and deserializes the array.
+     * @param array_t The variable that will store the array read from the buffer.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _T, size_t _Size>
+    Cdr& deserialize_array(
+            std::array<_T, _Size>* array_t,
+            size_t num_elements)
+    {
+        return deserialize_array(array_t->data(), num_elements * array_t->size());
+    }
+
+    /*!
+     * @brief This function template detects the content type of STD container array and deserializes the array with a different endianness.
+     * @param array_t The variable that will store the array read from the buffer.
+     * @param num_elements Number of the elements in the array.
+     * @param endianness Endianness that will be used in the deserialization of this value.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _T, size_t _Size>
+    Cdr& deserialize_array(
+            std::array<_T, _Size>* array_t,
+            size_t num_elements,
+            Endianness endianness)
+    {
+        return deserialize_array(array_t->data(), num_elements * array_t->size(), endianness);
+    }
+
+    /*!
+     * @brief Returns the number of bytes needed to align the current position (having as reference the origin) to
+     * certain data size.
+     * @param data_size The size of the data that will be serialized.
+     * @return The size needed for the alignment.
+     */
+    inline size_t alignment(
+            size_t data_size) const
+    {
+        return data_size > last_data_size_ ? (data_size - ((offset_ - origin_) % data_size)) & (data_size - 1) : 0;
+    }
+
+    /*!
+     * @brief This function jumps the number of bytes of the alignment. These bytes should be calculated with the function eprosima::fastcdr::Cdr::alignment.
+     * @param align The number of bytes to be skipped.
+     */
+    inline void make_alignment(
+            size_t align)
+    {
+        offset_ += align;
+        last_data_size_ = 0;
+    }
+
+    //! Whether a type can be encoded by an unchecked_writer or decoded by an unchecked_reader.
+    template<class _T>
+    struct is_unchecked_primitive : public std::integral_constant<bool,
+                (std::is_arithmetic<_T>::value || std::is_enum<_T>::value) &&
+                !std::is_same<_T, bool>::value && !std::is_same<_T, wchar_t>::value &&
+                (1 == sizeof(_T) || 2 == sizeof(_T) || 4 == sizeof(_T) || 8 == sizeof(_T))>
+    {
+    };
+
+    /*!
+     * @brief Encodes a primitive value without checking the bounds of the buffer.
+     * @param[in] value Value to be encoded.
+     * @param[in] region_end Position where the reserved region ends. Only used in debug builds.
+     */
+    template<class _T>
+    inline void unchecked_serialize(
+            const _T& value,
+            size_t region_end)
+    {
+        static_assert(is_unchecked_primitive<_T>::value, "Type not supported by unchecked regions");
+        static_cast<void>(region_end);
+
+        const size_t data_size {8 == sizeof(_T) ? align64_ : sizeof(_T)};
+        make_alignment(alignment(data_size));
+        assert(region_end >= (offset_ - cdr_buffer_.begin()) + sizeof(_T));
+        last_data_size_ = data_size;
+
+        if (swap_bytes_ && 1 < sizeof(_T))
+        {
+            const char* src = reinterpret_cast<const char*>(&value);
+
+            for (size_t count {sizeof(_T)}; 0 < count; --count)
+            {
+                offset_++ << src[count - 1];
+            }
+        }
+        else
+        {
+            offset_ << value;
+            offset_ += sizeof(_T);
+        }
+    }
+
+    /*!
+     * @brief Decodes a primitive value without checking the bounds of the buffer.
+     * @param[out] value Reference to the variable where the value will be stored.
+     * @param[in] region_end Position where the checked region ends. Only used in debug builds.
+     */
+    template<class _T>
+    inline void unchecked_deserialize(
+            _T& value,
+            size_t region_end)
+    {
+        static_assert(is_unchecked_primitive<_T>::value, "Type not supported by unchecked regions");
+        static_cast<void>(region_end);
+
+        const size_t data_size {8 == sizeof(_T) ? align64_ : sizeof(_T)};
+        make_alignment(alignment(data_size));
+        assert(region_end >= (offset_ - cdr_buffer_.begin()) + sizeof(_T));
+        last_data_size_ = data_size;
+
+        if (swap_bytes_ && 1 < sizeof(_T))
+        {
+            char* dst = reinterpret_cast<char*>(&value);
+
+            for (size_t count {sizeof(_T)}; 0 < count; --count)
+            {
+                offset_++ >> dst[count - 1];
+            }
+        }
+        else
+        {
+            offset_ >> value;
+            offset_ += sizeof(_T);
+        }
+    }
+
+    /*!
+     * @brief This function resizes the internal buffer. It only applies if the FastBuffer object was created with the default constructor.
+     * @param min_size_inc Minimun size increase for the internal buffer
+     * @return True if the resize was succesful, false if it was not
+     */
+    bool resize(
+            size_t min_size_inc);
+
+    Cdr_DllAPI const char* read_string(
+            uint32_t& length);
+    Cdr_DllAPI const std::wstring read_wstring(
+            uint32_t& length);
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// XCDR extensions
@@ -3114,6 +4232,58 @@ private:
             const MemberId& member_id,
             size_t member_serialized_size);
 
+    //! How Cdr::skip walks an encoded value.
+    enum class SkipMode : uint8_t
+    {
+        //! Values with a DHEADER or member header are jumped over.
+        JUMP,
+        //! The whole value is walked and validated.
+        VALIDATE,
+        //! The whole value is walked and validated, reversing in place the bytes of every multi-byte value.
+        SWAP
+    };
+
+    //! Skips primitive values, validating booleans if requested.
+    bool skip_primitives(
+            TypeKind kind,
+            size_t num_elements,
+            SkipMode mode);
+
+    //! Decodes a DHEADER checking it doesn't exceed the buffer.
+    bool skip_dheader(
+            uint32_t& dheader,
+            SkipMode mode);
+
+    //! Decodes a length checking the bound, if any.
+    bool skip_length(
+            uint32_t& length,
+            uint32_t bound,
+            SkipMode mode);
+
+    //! Decodes a member header according to XCDRv1, reversing its bytes if requested.
+    bool skip_xcdr1_member_header(
+            MemberId& member_id,
+            Cdr::state& current_state,
+            SkipMode mode);
+
+    //! Skips a member of a structure without member headers.
+    bool skip_plain_member(
+            const TypeDescription& description,
+            const TypeDescription::Member& member,
+            SkipMode mode);
+
+    //! Skips a structure.
+    bool skip_structure(
+            const TypeDescription& description,
+            const TypeDescription::Type& type,
+            SkipMode mode);
+
+    //! Skips a value of any type.
+    bool skip_value(
+            const TypeDescription& description,
+            TypeDescription::TypeIndex type,
+            SkipMode mode);
+
     /*!
      * @brief Decodes a member header according to XCDRv1.
      * @param[out] member_id Member identifier.
@@ -3530,6 +4700,42 @@ private:
     //! Whether the encapsulation was serialized.
     bool encapsulation_serialized_ {false};
 
+    //! Memory resource used to allocate the decoded objects. Stored opaquely to keep the layout in any C++ standard.
+    void* memory_resource_ {nullptr};
+
+    //! How the errors are reported.
+    ErrorMode error_mode_ {ErrorMode::THROW_EXCEPTIONS};
+
+    //! First error stored in ErrorMode::STICKY_ERROR.
+    ErrorCode error_ {ErrorCode::CDR_ERROR_NONE};
+
+    //! Maximum number of nested values walked using a runtime description.
+    uint32_t max_nesting_depth_ {DEFAULT_MAX_NESTING_DEPTH};
+
+    //! Number of nested values being walked using a runtime description.
+    uint32_t nesting_depth_ {0};
+
+    //! Message of the first error stored in ErrorMode::STICKY_ERROR.
+    const char* error_message_ {nullptr};
+
+    //! Checksum accumulator updated with the encoded and decoded bytes.
+    Crc32c* checksum_ {nullptr};
+
+    //! Position of the first byte not added yet to the checksum.
+    size_t checksum_position_ {0};
+
+    //! Compressor given the encoded bytes.
+    PayloadCompressor* compressor_ {nullptr};
+
+    //! Position of the first byte not given yet to the compressor.
+    size_t compressor_position_ {0};
+
+    //! Number of nested regions with headers pending to be patched.
+    size_t patched_regions_ {0};
+
+    //! Position where the outermost region with headers pending to be patched begins.
+    size_t patched_region_begin_ {0};
+
 
     uint32_t get_long_lc(
             SerializedMemberSizeForNextInt serialized_member_size);
@@ -3537,6 +4743,329 @@ private:
     uint32_t get_short_lc(
             size_t member_serialized_size);
 
+    /*!
+     * @brief This function template serializes a map-like container of non-primitive.
+     * @param map_t The map that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _Map, typename std::enable_if<!std::is_enum<typename _Map::mapped_type>::value &&
+            !std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    Cdr& serialize_map(
+            const _Map& map_t)
+    {
+        Cdr::state dheader_state {allocate_xcdrv2_dheader()};
+
+        serialize(static_cast<int32_t>(map_t.size()));
+
+        FASTCDR_TRY
+        {
+            for (auto it_pair = map_t.begin(); it_pair != map_t.end(); ++it_pair)
+            {
+                serialize(it_pair->first);
+                serialize(it_pair->second);
+            }
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(dheader_state);
+            FASTCDR_RETHROW;
+        }
+
+        set_xcdrv2_dheader(dheader_state);
+
+        return *this;
+    }
+
+    /*!
+     * @brief This function template serializes a map-like container of primitive.
+     * @param map_t The map that will be serialized in the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize a position that exceeds the internal memory size.
+     */
+    template<class _Map, typename std::enable_if<std::is_enum<typename _Map::mapped_type>::value ||
+            std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    Cdr& serialize_map(
+            const _Map& map_t)
+    {
+        state state_(*this);
+
+        serialize(static_cast<int32_t>(map_t.size()));
+
+        FASTCDR_TRY
+        {
+            for (auto it_pair = map_t.begin(); it_pair != map_t.end(); ++it_pair)
+            {
+                serialize(it_pair->first);
+                serialize(it_pair->second);
+            }
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(state_);
+            FASTCDR_RETHROW;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief This function template deserializes a map-like container of non-primitive.
+     * @param map_t The variable that will store the map read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _Map, typename std::enable_if<!std::is_enum<typename _Map::mapped_type>::value &&
+            !std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    Cdr& deserialize_map(
+            _Map& map_t)
+    {
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            uint32_t dheader {0};
+            deserialize(dheader);
+
+            auto offset = offset_;
+
+            uint32_t map_length {0};
+            deserialize(map_length);
+
+            map_t.clear();
+            reserve_map(map_t, map_length);
+
+            uint32_t count {0};
+            while (CDR_ERROR_NONE == error_ && offset_ - offset < dheader && count < map_length)
+            {
+                typename _Map::key_type key = make_element<typename _Map::key_type>(map_t.get_allocator());
+                typename _Map::mapped_type val = make_element<typename _Map::mapped_type>(map_t.get_allocator());
+                deserialize(key);
+                deserialize(val);
+                map_t.emplace_hint(map_t.end(), std::move(key), std::move(val));
+                ++count;
+            }
+
+            if (offset_ - offset != dheader)
+            {
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+            }
+        }
+        else
+        {
+            uint32_t sequence_length = 0;
+            state state_(*this);
+
+            deserialize(sequence_length);
+
+            map_t.clear();
+            reserve_map(map_t, sequence_length);
+
+            FASTCDR_TRY
+            {
+                for (uint32_t i = 0; CDR_ERROR_NONE == error_ && i < sequence_length; ++i)
+                {
+                    typename _Map::key_type key = make_element<typename _Map::key_type>(map_t.get_allocator());
+                    typename _Map::mapped_type value = make_element<typename _Map::mapped_type>(map_t.get_allocator());
+                    deserialize(key);
+                    deserialize(value);
+                    map_t.emplace_hint(map_t.end(), std::move(key), std::move(value));
+                }
+            }
+            FASTCDR_CATCH(exception::Exception&)
+            {
+                set_state(state_);
+                FASTCDR_RETHROW;
+            }
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief This function template deserializes a map-like container of primitive.
+     * @param map_t The variable that will store the map read from the buffer.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize a position that exceeds the internal memory size.
+     */
+    template<class _Map, typename std::enable_if<std::is_enum<typename _Map::mapped_type>::value ||
+            std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    Cdr& deserialize_map(
+            _Map& map_t)
+    {
+        uint32_t sequence_length = 0;
+        state state_(*this);
+
+        deserialize(sequence_length);
+
+        map_t.clear();
+        reserve_map(map_t, sequence_length);
+
+        FASTCDR_TRY
+        {
+            for (uint32_t i = 0; CDR_ERROR_NONE == error_ && i < sequence_length; ++i)
+            {
+                typename _Map::key_type key = make_element<typename _Map::key_type>(map_t.get_allocator());
+                typename _Map::mapped_type value = make_element<typename _Map::mapped_type>(map_t.get_allocator());
+                deserialize(key);
+                deserialize(value);
+                map_t.emplace_hint(map_t.end(), std::move(key), std::move(value));
+            }
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(state_);
+            FASTCDR_RETHROW;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief Encodes the characters of a wide string, whose length is known.
+     * @param[in] chars Characters of the string.
+     * @param[in] length Number of characters.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     * @exception exception::BadParamException This exception is thrown when the length doesn't fit in 32 bits.
+     */
+    template<class _CharT>
+    Cdr& serialize_wide_string(
+            const _CharT* chars,
+            size_t length)
+    {
+        const uint32_t encoded_length {size_to_uint32(length)};
+
+        if (encoded_length != length)
+        {
+            return report_error(CDR_ERROR_BAD_PARAM, "The string is too long to be encoded");
+        }
+
+        state state_before_error(*this);
+
+        serialize(encoded_length);
+
+        FASTCDR_TRY
+        {
+            serialize_array(chars, length);
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            set_state(state_before_error);
+            FASTCDR_RETHROW;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief Decodes a wide string directly into the given string, reusing its capacity.
+     * A terminating zero sent by some implementations is not decoded.
+     * @param[out] string_t String where the characters are decoded.
+     * @return Reference to the eprosima::fastcdr::Cdr object.
+     */
+    template<class _String>
+    Cdr& deserialize_wide_string(
+            _String& string_t)
+    {
+        uint32_t length {0};
+        state state_before_error(*this);
+
+        deserialize(length);
+
+        const size_t bytes_length {static_cast<size_t>(length) * 2};
+        if ((end_ - offset_) < bytes_length)
+        {
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        }
+
+        size_t terminator_length {0};
+        if (0 < length)
+        {
+            const char* last_char {&offset_ + bytes_length - 2};
+            if (0 == last_char[0] && 0 == last_char[1])
+            {
+                --length;
+                terminator_length = 2;
+            }
+        }
+
+        string_t.resize(length);
+        if (0 < length)
+        {
+            deserialize_array(&string_t[0], length);
+        }
+        if (0 < terminator_length)
+        {
+            last_data_size_ = sizeof(uint16_t);
+            offset_ += terminator_length;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * @brief Containers without storage to reserve, like std::map, are not touched.
+     */
+    template<class _Map>
+    void reserve_map(
+            _Map&,
+            uint32_t)
+    {
+    }
+
+    /*!
+     * @brief Reserves storage for the decoded elements of an unordered map.
+     * The number of elements is bounded by the remaining bytes, so a corrupted length cannot trigger a huge
+     * allocation.
+     * @param[in,out] map_t Map being decoded.
+     * @param[in] length Encoded number of elements.
+     */
+    template<class _K, class _T, class _Hash, class _Pred, class _Alloc>
+    void reserve_map(
+            std::unordered_map<_K, _T, _Hash, _Pred, _Alloc>& map_t,
+            uint32_t length)
+    {
+        map_t.reserve(std::min(static_cast<size_t>(length), end_ - offset_));
+    }
+
+    /*!
+     * @brief Reserves storage for the decoded elements of a flat map.
+     * The number of elements is bounded by the remaining bytes, so a corrupted length cannot trigger a huge
+     * allocation.
+     * @param[in,out] map_t Map being decoded.
+     * @param[in] length Encoded number of elements.
+     */
+    template<class _K, class _T, class _Compare, class _Alloc>
+    void reserve_map(
+            flat_map<_K, _T, _Compare, _Alloc>& map_t,
+            uint32_t length)
+    {
+        map_t.reserve(std::min(static_cast<size_t>(length), end_ - offset_));
+    }
+
+    /*!
+     * @brief Constructs a container element which will use the allocator of the container.
+     * Used to avoid decoding an element using a different memory resource than the container's one.
+     * @param[in] allocator Allocator of the container.
+     * @return The constructed element.
+     */
+    template<class _T, class _Alloc, typename std::enable_if<std::uses_allocator<_T, _Alloc>::value>::type* = nullptr>
+    static _T make_element(
+            const _Alloc& allocator)
+    {
+        return _T(allocator);
+    }
+
+    /*!
+     * @brief Constructs a container element which doesn't use allocators.
+     * @return The constructed element.
+     */
+    template<class _T, class _Alloc, typename std::enable_if<!std::uses_allocator<_T, _Alloc>::value>::type* = nullptr>
+    static _T make_element(
+            const _Alloc&)
+    {
+        return _T();
+    }
+
     template<class _T, typename std::enable_if<std::is_enum<_T>::value ||
             std::is_arithmetic<_T>::value>::type* = nullptr>
     constexpr SerializedMemberSizeForNextInt get_serialized_member_size() const
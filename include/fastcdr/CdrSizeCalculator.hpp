@@ -20,12 +20,19 @@
 #include <cstdint>
 #include <limits>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "fastcdr_dll.h"
 
+#if FASTCDR_HAVE_STRING_VIEW
+#include <string_view>
+#endif // if FASTCDR_HAVE_STRING_VIEW
+
 #include "CdrEncoding.hpp"
 #include "cdr/fixed_size_string.hpp"
+#include "cdr/fixed_vector.hpp"
+#include "cdr/flat_map.hpp"
 #include "detail/container_recursive_inspector.hpp"
 #include "exceptions/BadParamException.h"
 #include "xcdr/external.hpp"
@@ -474,6 +481,80 @@ public:
         return calculated_size;
     }
 
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a std::u16string.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    TEMPLATE_SPEC
+    size_t calculate_serialized_size(
+            const std::u16string& data,
+            size_t& current_alignment)
+    {
+        size_t calculated_size {4 + alignment(current_alignment, 4) + data.size() * 2};
+        current_alignment += calculated_size;
+
+        return calculated_size;
+    }
+
+#if FASTCDR_HAVE_PMR
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a std::pmr::string.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    TEMPLATE_SPEC
+    size_t calculate_serialized_size(
+            const std::pmr::string& data,
+            size_t& current_alignment)
+    {
+        size_t calculated_size {4 + alignment(current_alignment, 4) + data.size() + 1};
+        current_alignment += calculated_size;
+        serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+
+        return calculated_size;
+    }
+
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a std::pmr::wstring.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    TEMPLATE_SPEC
+    size_t calculate_serialized_size(
+            const std::pmr::wstring& data,
+            size_t& current_alignment)
+    {
+        size_t calculated_size {4 + alignment(current_alignment, 4) + data.size() * 2};
+        current_alignment += calculated_size;
+
+        return calculated_size;
+    }
+
+#endif // if FASTCDR_HAVE_PMR
+#if FASTCDR_HAVE_STRING_VIEW
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a std::string_view.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    TEMPLATE_SPEC
+    size_t calculate_serialized_size(
+            const std::string_view& data,
+            size_t& current_alignment)
+    {
+        size_t calculated_size {4 + alignment(current_alignment, 4) + data.size() + 1};
+        current_alignment += calculated_size;
+        serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+
+        return calculated_size;
+    }
+
+#endif // if FASTCDR_HAVE_STRING_VIEW
     /*!
      * @brief Specific template which calculates the encoded size of an instance of a fixed_string.
      * @param[in] data Reference to the instance.
@@ -498,10 +579,10 @@ public:
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    template<class _T, typename std::enable_if<!std::is_enum<_T>::value &&
+    template<class _T, class _Alloc, typename std::enable_if<!std::is_enum<_T>::value &&
             !std::is_arithmetic<_T>::value>::type* = nullptr>
     size_t calculate_serialized_size(
-            const std::vector<_T>& data,
+            const std::vector<_T, _Alloc>& data,
             size_t& current_alignment)
     {
         size_t initial_alignment {current_alignment};
@@ -532,10 +613,10 @@ public:
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    template<class _T, typename std::enable_if<std::is_enum<_T>::value ||
-            std::is_arithmetic<_T>::value>::type* = nullptr>
+    template<class _T, class _Alloc, typename std::enable_if<(std::is_enum<_T>::value ||
+            std::is_arithmetic<_T>::value) && !std::is_same<_T, bool>::value>::type* = nullptr>
     size_t calculate_serialized_size(
-            const std::vector<_T>& data,
+            const std::vector<_T, _Alloc>& data,
             size_t& current_alignment)
     {
         size_t initial_alignment {current_alignment};
@@ -559,9 +640,9 @@ public:
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    TEMPLATE_SPEC
+    template<class _Alloc>
     size_t calculate_serialized_size(
-            const std::vector<bool>& data,
+            const std::vector<bool, _Alloc>& data,
             size_t& current_alignment)
     {
         size_t calculated_size {data.size() + 4 + alignment(current_alignment, 4)};
@@ -571,30 +652,31 @@ public:
     }
 
     /*!
-     * @brief Specific template which calculates the encoded size of an instance of an array.
+     * @brief Specific template which calculates the encoded size of an instance of a fixed_vector of non-primitives.
      * @param[in] data Reference to the instance.
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    template<class _T, size_t _Size>
+    template<class _T, size_t MAX_ELEMENTS, typename std::enable_if<!std::is_enum<_T>::value &&
+            !std::is_arithmetic<_T>::value>::type* = nullptr>
     size_t calculate_serialized_size(
-            const std::array<_T, _Size>& data,
+            const fixed_vector<_T, MAX_ELEMENTS>& data,
             size_t& current_alignment)
     {
         size_t initial_alignment {current_alignment};
 
-        if (CdrVersion::XCDRv2 == cdr_version_ &&
-                !is_multi_array_primitive(&data))
+        if (CdrVersion::XCDRv2 == cdr_version_)
         {
             // DHEADER
             current_alignment += 4 + alignment(current_alignment, 4);
         }
 
+        current_alignment += 4 + alignment(current_alignment, 4);
+
         size_t calculated_size {current_alignment - initial_alignment};
         calculated_size += calculate_array_serialized_size(data.data(), data.size(), current_alignment);
 
-        if (CdrVersion::XCDRv2 == cdr_version_ &&
-                !is_multi_array_primitive(&data))
+        if (CdrVersion::XCDRv2 == cdr_version_)
         {
             // Inform DHEADER can be joined with NEXTINT
             serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
@@ -604,69 +686,107 @@ public:
     }
 
     /*!
-     * @brief Specific template which calculates the encoded size of an instance of a map of non-primitives.
+     * @brief Specific template which calculates the encoded size of an instance of a fixed_vector of primitives.
      * @param[in] data Reference to the instance.
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    template<class _K, class _V, typename std::enable_if<!std::is_enum<_V>::value &&
-            !std::is_arithmetic<_V>::value>::type* = nullptr>
+    template<class _T, size_t MAX_ELEMENTS, typename std::enable_if<std::is_enum<_T>::value ||
+            std::is_arithmetic<_T>::value>::type* = nullptr>
     size_t calculate_serialized_size(
-            const std::map<_K, _V>& data,
+            const fixed_vector<_T, MAX_ELEMENTS>& data,
             size_t& current_alignment)
     {
         size_t initial_alignment {current_alignment};
 
-        if (CdrVersion::XCDRv2 == cdr_version_)
-        {
-            // DHEADER
-            current_alignment += 4 + alignment(current_alignment, 4);
-        }
-
         current_alignment += 4 + alignment(current_alignment, 4);
 
         size_t calculated_size {current_alignment - initial_alignment};
-        for (auto it = data.begin(); it != data.end(); ++it)
-        {
-            calculated_size += calculate_serialized_size(it->first, current_alignment);
-            calculated_size += calculate_serialized_size(it->second, current_alignment);
-        }
+        calculated_size += calculate_array_serialized_size(data.data(), data.size(), current_alignment);
 
         if (CdrVersion::XCDRv2 == cdr_version_)
         {
-            // Inform DHEADER can be joined with NEXTINT
-            serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+            serialized_member_size_ = get_serialized_member_size<_T>();
         }
 
         return calculated_size;
     }
 
     /*!
-     * @brief Specific template which calculates the encoded size of an instance of a map of primitives.
+     * @brief Specific template which calculates the encoded size of an instance of an array.
      * @param[in] data Reference to the instance.
      * @param[inout] current_alignment Current alignment in the encoding.
      * @return Encoded size of the instance.
      */
-    template<class _K, class _V, typename std::enable_if<std::is_enum<_V>::value ||
-            std::is_arithmetic<_V>::value>::type* = nullptr>
+    template<class _T, size_t _Size>
     size_t calculate_serialized_size(
-            const std::map<_K, _V>& data,
+            const std::array<_T, _Size>& data,
             size_t& current_alignment)
     {
         size_t initial_alignment {current_alignment};
 
-        current_alignment += 4 + alignment(current_alignment, 4);
+        if (CdrVersion::XCDRv2 == cdr_version_ &&
+                !is_multi_array_primitive(&data))
+        {
+            // DHEADER
+            current_alignment += 4 + alignment(current_alignment, 4);
+        }
 
         size_t calculated_size {current_alignment - initial_alignment};
-        for (auto it = data.begin(); it != data.end(); ++it)
+        calculated_size += calculate_array_serialized_size(data.data(), data.size(), current_alignment);
+
+        if (CdrVersion::XCDRv2 == cdr_version_ &&
+                !is_multi_array_primitive(&data))
         {
-            calculated_size += calculate_serialized_size(it->first, current_alignment);
-            calculated_size += calculate_serialized_size(it->second, current_alignment);
+            // Inform DHEADER can be joined with NEXTINT
+            serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
         }
 
         return calculated_size;
     }
 
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a map.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    template<class _K, class _V, class _Compare, class _Alloc>
+    size_t calculate_serialized_size(
+            const std::map<_K, _V, _Compare, _Alloc>& data,
+            size_t& current_alignment)
+    {
+        return calculate_map_serialized_size(data, current_alignment);
+    }
+
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of an unordered map.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    template<class _K, class _V, class _Hash, class _Pred, class _Alloc>
+    size_t calculate_serialized_size(
+            const std::unordered_map<_K, _V, _Hash, _Pred, _Alloc>& data,
+            size_t& current_alignment)
+    {
+        return calculate_map_serialized_size(data, current_alignment);
+    }
+
+    /*!
+     * @brief Specific template which calculates the encoded size of an instance of a flat map.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    template<class _K, class _V, class _Compare, class _Alloc>
+    size_t calculate_serialized_size(
+            const flat_map<_K, _V, _Compare, _Alloc>& data,
+            size_t& current_alignment)
+    {
+        return calculate_map_serialized_size(data, current_alignment);
+    }
+
     /*!
      * @brief Specific template which calculates the encoded size of an instance of a bitset of 8bits.
      * @param[in] data Reference to the instance.
@@ -778,7 +898,7 @@ public:
     {
         if (!data)
         {
-            throw exception::BadParamException("External member is null");
+            FASTCDR_THROW(exception::BadParamException("External member is null"));
         }
 
         return calculate_serialized_size(*data, current_alignment);
@@ -1304,6 +1424,9 @@ public:
 
 private:
 
+    //! Informs whether the sizes of described sequences can be joined with NEXTINT, as the templates do.
+    friend class TypeInterpreter;
+
     CdrSizeCalculator() = delete;
 
     CdrVersion cdr_version_ {CdrVersion::XCDRv2};
@@ -1330,6 +1453,70 @@ private:
         return (data_size - (current_alignment % data_size)) & (data_size - 1);
     }
 
+    /*!
+     * @brief Calculates the encoded size of an instance of a map-like container of non-primitives.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    template<class _Map, typename std::enable_if<!std::is_enum<typename _Map::mapped_type>::value &&
+            !std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    size_t calculate_map_serialized_size(
+            const _Map& data,
+            size_t& current_alignment)
+    {
+        size_t initial_alignment {current_alignment};
+
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            // DHEADER
+            current_alignment += 4 + alignment(current_alignment, 4);
+        }
+
+        current_alignment += 4 + alignment(current_alignment, 4);
+
+        size_t calculated_size {current_alignment - initial_alignment};
+        for (auto it = data.begin(); it != data.end(); ++it)
+        {
+            calculated_size += calculate_serialized_size(it->first, current_alignment);
+            calculated_size += calculate_serialized_size(it->second, current_alignment);
+        }
+
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            // Inform DHEADER can be joined with NEXTINT
+            serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+        }
+
+        return calculated_size;
+    }
+
+    /*!
+     * @brief Calculates the encoded size of an instance of a map-like container of primitives.
+     * @param[in] data Reference to the instance.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the instance.
+     */
+    template<class _Map, typename std::enable_if<std::is_enum<typename _Map::mapped_type>::value ||
+            std::is_arithmetic<typename _Map::mapped_type>::value>::type* = nullptr>
+    size_t calculate_map_serialized_size(
+            const _Map& data,
+            size_t& current_alignment)
+    {
+        size_t initial_alignment {current_alignment};
+
+        current_alignment += 4 + alignment(current_alignment, 4);
+
+        size_t calculated_size {current_alignment - initial_alignment};
+        for (auto it = data.begin(); it != data.end(); ++it)
+        {
+            calculated_size += calculate_serialized_size(it->first, current_alignment);
+            calculated_size += calculate_serialized_size(it->second, current_alignment);
+        }
+
+        return calculated_size;
+    }
+
     template<class _T, typename std::enable_if<std::is_enum<_T>::value ||
             std::is_arithmetic<_T>::value>::type* = nullptr>
     constexpr SerializedMemberSizeForNextInt get_serialized_member_size() const
@@ -0,0 +1,172 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_COMPRESSION_HPP_
+#define _FASTCDR_COMPRESSION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fastcdr_dll.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Flag set in the first byte of the encapsulation options of a compressed payload.
+constexpr uint8_t COMPRESSED_PAYLOAD_OPTION {0x80};
+
+//! Maximum number of bytes of a payload compressed independently of the others.
+constexpr size_t COMPRESSION_SEGMENT_SIZE {65536};
+
+/*!
+ * @brief Returns whether a payload, starting with its encapsulation, was compressed by @ref compress_payload.
+ * @param[in] payload Serialized payload.
+ * @param[in] size Size of the payload.
+ * @return Whether the payload is flagged as compressed in its encapsulation options.
+ */
+Cdr_DllAPI bool is_compressed_payload(
+        const char* payload,
+        size_t size);
+
+/*!
+ * @brief Returns the maximum size of a payload once compressed by @ref compress_payload.
+ * @param[in] size Size of the payload, including its encapsulation.
+ * @return Maximum size of the compressed payload, including its encapsulation.
+ */
+Cdr_DllAPI size_t calculate_compressed_max_size(
+        size_t size);
+
+/*!
+ * @brief Compresses a serialized payload, starting with its DDS encapsulation.
+ *
+ * The encapsulation is kept, with @ref COMPRESSED_PAYLOAD_OPTION set in its options, followed by the size of the
+ * decompressed data. The data is split in segments of @ref COMPRESSION_SEGMENT_SIZE bytes, each one compressed by a
+ * self-contained LZ77 codec, or stored as is when it doesn't compress. Segments are independent, so each one is
+ * compressed and decompressed while it is still in cache.
+ * @param[in] payload Serialized payload.
+ * @param[in] size Size of the payload, including its encapsulation.
+ * @param[out] destination Buffer where the compressed payload is written.
+ * @param[in] destination_size Size of the destination buffer. See @ref calculate_compressed_max_size.
+ * @return Size of the compressed payload, including its encapsulation.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the destination can't hold the
+ * compressed payload.
+ * @exception exception::BadParamException This exception is thrown when the payload has no encapsulation or is already
+ * compressed.
+ */
+Cdr_DllAPI size_t compress_payload(
+        const char* payload,
+        size_t size,
+        char* destination,
+        size_t destination_size);
+
+/*!
+ * @brief This class compresses a serialized payload while it is encoded, in the format of @ref compress_payload.
+ *
+ * Each segment is compressed as soon as its bytes are added, while they are still in cache. It can be attached to a
+ * eprosima::fastcdr::Cdr object, using eprosima::fastcdr::Cdr::set_compressor, which adds the encoded bytes once they
+ * won't be patched anymore.
+ */
+class PayloadCompressor
+{
+public:
+
+    /*!
+     * @brief Starts compressing a payload.
+     * @param[out] destination Buffer where the compressed payload is written.
+     * @param[in] destination_size Size of the destination buffer. See @ref calculate_compressed_max_size.
+     */
+    Cdr_DllAPI PayloadCompressor(
+            char* destination,
+            size_t destination_size);
+
+    /*!
+     * @brief Adds bytes of the payload following its encapsulation, compressing every segment completed by them.
+     * @param[in] data Pointer to the bytes.
+     * @param[in] size Number of bytes.
+     */
+    Cdr_DllAPI void update(
+            const char* data,
+            size_t size);
+
+    /*!
+     * @brief Compresses the last segment and writes the encapsulation of the compressed payload.
+     * @param[in] encapsulation Encapsulation of the payload.
+     * @return Size of the compressed payload, including its encapsulation.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the destination can't hold the
+     * compressed payload.
+     * @exception exception::BadParamException This exception is thrown when the payload is already compressed or too
+     * big.
+     */
+    Cdr_DllAPI size_t finish(
+            const char* encapsulation);
+
+private:
+
+    //! Compresses a segment, or stores it as is when it doesn't shrink, after the last one.
+    void write_segment(
+            const char* segment,
+            size_t segment_size);
+
+    char* destination_ {nullptr};
+
+    size_t destination_size_ {0};
+
+    //! Number of bytes written to the destination, including the room of the encapsulation.
+    size_t length_ {0};
+
+    //! Number of bytes of the payload added.
+    size_t data_size_ {0};
+
+    //! Bytes of the segment being completed, when it was added in several chunks.
+    std::vector<char> pending_;
+
+    //! Whether the destination couldn't hold a segment.
+    bool overflow_ {false};
+};
+
+/*!
+ * @brief Returns the size of a payload compressed by @ref compress_payload once decompressed.
+ * @param[in] payload Compressed payload.
+ * @param[in] size Size of the compressed payload.
+ * @return Size of the decompressed payload, including its encapsulation.
+ * @exception exception::BadParamException This exception is thrown when the payload is not compressed.
+ */
+Cdr_DllAPI size_t calculate_decompressed_size(
+        const char* payload,
+        size_t size);
+
+/*!
+ * @brief Decompresses a payload compressed by @ref compress_payload, restoring its original encapsulation, so it can
+ * be decoded by eprosima::fastcdr::Cdr.
+ * @param[in] payload Compressed payload.
+ * @param[in] size Size of the compressed payload.
+ * @param[out] destination Buffer where the decompressed payload is written.
+ * @param[in] destination_size Size of the destination buffer. See @ref calculate_decompressed_size.
+ * @return Size of the decompressed payload, including its encapsulation.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the destination can't hold the
+ * decompressed payload.
+ * @exception exception::BadParamException This exception is thrown when the payload is not compressed or is
+ * corrupted.
+ */
+Cdr_DllAPI size_t decompress_payload(
+        const char* payload,
+        size_t size,
+        char* destination,
+        size_t destination_size);
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_COMPRESSION_HPP_
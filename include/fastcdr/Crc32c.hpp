@@ -0,0 +1,69 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_CRC32C_HPP_
+#define _FASTCDR_CRC32C_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fastcdr_dll.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief This class accumulates the CRC-32C (Castagnoli) checksum of a sequence of bytes.
+ *
+ * The checksum is calculated using the SSE4.2 crc32 instruction when the processor supports it, the ARMv8 CRC32
+ * instructions when the library is built for them, and a table-driven implementation processing eight bytes at a time
+ * otherwise.
+ *
+ * It can be attached to a eprosima::fastcdr::Cdr object, using eprosima::fastcdr::Cdr::set_checksum, to calculate the
+ * checksum of the bytes while they are encoded or decoded.
+ */
+class Crc32c
+{
+public:
+
+    /*!
+     * @brief Adds bytes to the checksum.
+     * @param[in] data Pointer to the bytes.
+     * @param[in] size Number of bytes.
+     */
+    Cdr_DllAPI void update(
+            const char* data,
+            size_t size);
+
+    //! Returns the checksum of the bytes added since the creation or the last reset.
+    uint32_t value() const
+    {
+        return ~crc_;
+    }
+
+    //! Restarts the checksum.
+    void reset()
+    {
+        crc_ = 0xFFFFFFFFu;
+    }
+
+private:
+
+    uint32_t crc_ {0xFFFFFFFFu};
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_CRC32C_HPP_
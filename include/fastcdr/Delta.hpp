@@ -0,0 +1,202 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_DELTA_HPP_
+#define _FASTCDR_DELTA_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "fastcdr_dll.h"
+#include "Cdr.h"
+#include "exceptions/BadParamException.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief Returns the maximum size of a delta calculated by @ref encode_delta.
+ * @param[in] size Size of the new sample.
+ * @return Maximum size of the delta.
+ */
+Cdr_DllAPI size_t calculate_delta_max_size(
+        size_t size);
+
+/*!
+ * @brief Calculates the delta turning a serialized sample into the next one.
+ *
+ * The delta stores the size and the CRC-32C of the previous sample, the size of the new one and the ranges of bytes
+ * which changed, with their new contents. Ranges separated by a few unchanged bytes are merged, and when the ranges
+ * would take more than the whole sample, the delta stores the whole sample instead. The delta only depends on the
+ * two samples.
+ * @param[in] previous Previous serialized sample.
+ * @param[in] previous_size Size of the previous sample. It may be zero, for the first sample.
+ * @param[in] sample New serialized sample.
+ * @param[in] size Size of the new sample.
+ * @param[out] destination Buffer where the delta is written.
+ * @param[in] destination_size Size of the destination buffer. See @ref calculate_delta_max_size.
+ * @return Size of the delta.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the destination can't hold the delta.
+ * @exception exception::BadParamException This exception is thrown when a sample is greater than 4 GiB.
+ */
+Cdr_DllAPI size_t encode_delta(
+        const char* previous,
+        size_t previous_size,
+        const char* sample,
+        size_t size,
+        char* destination,
+        size_t destination_size);
+
+/*!
+ * @brief Returns the size of the sample reconstructed by a delta.
+ * @param[in] delta Delta calculated by @ref encode_delta.
+ * @param[in] delta_size Size of the delta.
+ * @return Size of the new sample.
+ * @exception exception::BadParamException This exception is thrown when the delta is truncated.
+ */
+Cdr_DllAPI size_t calculate_delta_sample_size(
+        const char* delta,
+        size_t delta_size);
+
+/*!
+ * @brief Applies a delta in place, turning the previous serialized sample into the new one.
+ *
+ * Only the changed bytes are written. The delta is checked against the size and the CRC-32C of the sample before
+ * modifying it, so a delta calculated from another sample (e.g. after a sample was lost) is rejected and the sample
+ * is left untouched.
+ * @param[in] delta Delta calculated by @ref encode_delta.
+ * @param[in] delta_size Size of the delta.
+ * @param[inout] sample Buffer holding the previous sample, where the new one is written.
+ * @param[in] size Size of the previous sample.
+ * @param[in] capacity Size of the sample buffer. See @ref calculate_delta_sample_size.
+ * @return Size of the new sample.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer can't hold the new sample.
+ * @exception exception::BadParamException This exception is thrown when the delta was not calculated from the sample
+ * or is corrupted.
+ */
+Cdr_DllAPI size_t apply_delta(
+        const char* delta,
+        size_t delta_size,
+        char* sample,
+        size_t size,
+        size_t capacity);
+
+/*!
+ * @brief This class serializes consecutive samples of a type and calculates the delta between each one and the
+ * previous.
+ *
+ * Each sample is serialized with its encapsulation into a zeroed buffer, so the padding bytes, which
+ * eprosima::fastcdr::Cdr doesn't write, don't make equal samples differ.
+ * @ingroup FASTCDRAPIREFERENCE
+ */
+class DeltaEncoder
+{
+public:
+
+    /*!
+     * @brief Constructor.
+     * @param[in] cdr_version Encoding algorithm used to serialize the samples.
+     * @param[in] endianness Endianness used to serialize the samples.
+     */
+    explicit DeltaEncoder(
+            CdrVersion cdr_version = CdrVersion::XCDRv2,
+            Cdr::Endianness endianness = Cdr::DEFAULT_ENDIAN)
+        : cdr_version_(cdr_version)
+        , endianness_(endianness)
+    {
+    }
+
+    /*!
+     * @brief Serializes a sample and calculates the delta from the previous one. The first sample, or the first one
+     * after a reset, is calculated from an empty sample.
+     * @param[in] data Sample to be serialized.
+     * @param[out] delta Vector where the delta is stored.
+     * @exception exception::BadParamException This exception is thrown when the sample can't be serialized.
+     */
+    template<class _T>
+    void encode(
+            const _T& data,
+            std::vector<char>& delta)
+    {
+        for (;;)
+        {
+            std::fill(sample_.begin(), sample_.end(), '\0');
+            FastBuffer fast_buffer(sample_.data(), sample_.size());
+            Cdr cdr(fast_buffer, endianness_, cdr_version_);
+            cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+            cdr.serialize_encapsulation();
+            cdr << data;
+
+            if (Cdr::ErrorCode::CDR_ERROR_NONE == cdr.get_error())
+            {
+                sample_size_ = cdr.get_serialized_data_length();
+                break;
+            }
+
+            // The buffer is grown until the sample fits. Any other error is not solved by retrying.
+            if (Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY != cdr.get_error())
+            {
+                FASTCDR_THROW(exception::BadParamException(cdr.get_error_message()));
+            }
+
+            sample_.resize(std::max<size_t>(256, sample_.size() * 2));
+        }
+
+        delta.resize(calculate_delta_max_size(sample_size_));
+        delta.resize(encode_delta(previous_.data(), previous_size_, sample_.data(), sample_size_, delta.data(),
+                delta.size()));
+        std::swap(previous_, sample_);
+        previous_size_ = sample_size_;
+    }
+
+    //! Returns the last serialized sample.
+    const char* get_sample() const
+    {
+        return previous_.data();
+    }
+
+    //! Returns the size of the last serialized sample.
+    size_t get_sample_size() const
+    {
+        return previous_size_;
+    }
+
+    //! Forgets the last sample, so the next delta holds the whole sample.
+    void reset()
+    {
+        previous_size_ = 0;
+    }
+
+private:
+
+    CdrVersion cdr_version_ {CdrVersion::XCDRv2};
+
+    Cdr::Endianness endianness_ {Cdr::DEFAULT_ENDIAN};
+
+    std::vector<char> previous_;
+
+    size_t previous_size_ {0};
+
+    std::vector<char> sample_;
+
+    size_t sample_size_ {0};
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DELTA_HPP_
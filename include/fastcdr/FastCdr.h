@@ -18,7 +18,9 @@
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #if !__APPLE__ && !__FreeBSD__ && !__VXWORKS__
@@ -72,6 +74,22 @@ public:
         //! @brief The position in the buffer when the state was created.
         const FastBuffer::iterator current_position_;
     };
+
+    /*!
+     * @brief This enumeration represents how the integers are encoded.
+     */
+    enum class IntegerEncoding : uint8_t
+    {
+        //! @brief Integers are encoded using all the bytes of their type.
+        FIXED_WIDTH,
+        /*!
+         * @brief Integers, wide characters and the lengths of strings and sequences are encoded as LEB128 varints, in
+         * as many bytes as their value needs. Signed integers are zigzag encoded first, so small negative values are
+         * short too.
+         */
+        VARINT
+    };
+
     /*!
      * @brief This constructor creates a eprosima::fastcdr::FastCdr object that can serialize/deserialize
      * the assigned buffer.
@@ -81,6 +99,70 @@ public:
     FastCdr(
             FastBuffer& cdr_buffer);
 
+    /*!
+     * @brief This constructor creates a eprosima::fastcdr::FastCdr object that can serialize/deserialize
+     * the assigned buffer using the given encoding of the integers.
+     *
+     * @param cdr_buffer A reference to the buffer that contains (or will contain) the CDR representation.
+     * @param integer_encoding How the integers are encoded.
+     */
+    FastCdr(
+            FastBuffer& cdr_buffer,
+            IntegerEncoding integer_encoding);
+
+    /*!
+     * @brief This function returns how the integers are encoded.
+     * @return The encoding of the integers.
+     */
+    IntegerEncoding get_integer_encoding() const;
+
+    /*!
+     * @brief This function returns the number of bytes of a value encoded as a LEB128 varint.
+     * @param value The value, already zigzag encoded if it is signed.
+     * @return The number of bytes, from 1 to 10.
+     */
+    static inline size_t varint_size(
+            uint64_t value)
+    {
+        size_t size {1};
+
+        while (0x80u <= value)
+        {
+            value >>= 7;
+            ++size;
+        }
+
+        return size;
+    }
+
+    /*!
+     * @brief This function maps a signed integer to an unsigned one, interleaving the positive and negative values.
+     * @param value The value to be encoded.
+     * @return The zigzag encoded value.
+     */
+    template<class _T>
+    static inline typename std::make_unsigned<_T>::type zigzag_encode(
+            _T value)
+    {
+        using unsigned_type = typename std::make_unsigned<_T>::type;
+        return static_cast<unsigned_type>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) << 1) ^
+               static_cast<unsigned_type>(value >> (std::numeric_limits<unsigned_type>::digits - 1)));
+    }
+
+    /*!
+     * @brief This function recovers a signed integer encoded by @ref zigzag_encode.
+     * @param value The zigzag encoded value.
+     * @return The signed value.
+     */
+    template<class _T>
+    static inline _T zigzag_decode(
+            typename std::make_unsigned<_T>::type value)
+    {
+        using unsigned_type = typename std::make_unsigned<_T>::type;
+        return static_cast<_T>(static_cast<unsigned_type>(static_cast<unsigned_type>(value >> 1) ^
+               static_cast<unsigned_type>(0u - static_cast<unsigned_type>(value & 1u))));
+    }
+
     /*!
      * @brief This function skips a number of bytes in the CDR stream buffer.
      * @param num_bytes The number of bytes that will be jumped.
@@ -681,6 +763,11 @@ public:
     FastCdr& serialize(
             const uint16_t ushort_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(ushort_t);
+        }
+
         return serialize(static_cast<int16_t>(ushort_t));
     }
 
@@ -694,6 +781,11 @@ public:
     FastCdr& serialize(
             const int16_t short_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(zigzag_encode(short_t));
+        }
+
         if (((last_position_ - current_position_) >= sizeof(short_t)) || resize(sizeof(short_t)))
         {
             current_position_ << short_t;
@@ -715,6 +807,11 @@ public:
     FastCdr& serialize(
             const uint32_t ulong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(ulong_t);
+        }
+
         return serialize(static_cast<int32_t>(ulong_t));
     }
 
@@ -728,6 +825,11 @@ public:
     FastCdr& serialize(
             const int32_t long_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(zigzag_encode(long_t));
+        }
+
         if (((last_position_ - current_position_) >= sizeof(long_t)) || resize(sizeof(long_t)))
         {
             current_position_ << long_t;
@@ -762,6 +864,11 @@ public:
     FastCdr& serialize(
             const uint64_t ulonglong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(ulonglong_t);
+        }
+
         return serialize(static_cast<int64_t>(ulonglong_t));
     }
 
@@ -775,6 +882,11 @@ public:
     FastCdr& serialize(
             const int64_t longlong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varint(zigzag_encode(longlong_t));
+        }
+
         if (((last_position_ - current_position_) >= sizeof(longlong_t)) || resize(sizeof(longlong_t)))
         {
             current_position_ << longlong_t;
@@ -953,7 +1065,7 @@ public:
     {
         state state_before_error(*this);
 
-        *this << static_cast<int32_t>(vector_t.size());
+        *this << static_cast<uint32_t>(vector_t.size());
 
         try
         {
@@ -1051,6 +1163,11 @@ public:
             const uint16_t* ushort_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varints(ushort_t, num_elements);
+        }
+
         return serialize_array(reinterpret_cast<const int16_t*>(ushort_t), num_elements);
     }
 
@@ -1077,6 +1194,11 @@ public:
             const uint32_t* ulong_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varints(ulong_t, num_elements);
+        }
+
         return serialize_array(reinterpret_cast<const int32_t*>(ulong_t), num_elements);
     }
 
@@ -1114,6 +1236,11 @@ public:
             const uint64_t* ulonglong_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return serialize_varints(ulonglong_t, num_elements);
+        }
+
         return serialize_array(reinterpret_cast<const int64_t*>(ulonglong_t), num_elements);
     }
 
@@ -1262,7 +1389,7 @@ public:
     {
         state state_before_error(*this);
 
-        serialize(static_cast<int32_t>(num_elements));
+        serialize(static_cast<uint32_t>(num_elements));
 
         try
         {
@@ -1332,6 +1459,12 @@ public:
     FastCdr& deserialize(
             uint16_t& ushort_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            ushort_t = static_cast<uint16_t>(deserialize_varint(std::numeric_limits<uint16_t>::max()));
+            return *this;
+        }
+
         return deserialize(reinterpret_cast<int16_t&>(ushort_t));
     }
 
@@ -1345,6 +1478,12 @@ public:
     FastCdr& deserialize(
             int16_t& short_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            short_t = zigzag_decode<int16_t>(static_cast<uint16_t>(deserialize_varint(std::numeric_limits<uint16_t>::max())));
+            return *this;
+        }
+
         if ((last_position_ - current_position_) >= sizeof(short_t))
         {
             current_position_ >> short_t;
@@ -1366,6 +1505,12 @@ public:
     FastCdr& deserialize(
             uint32_t& ulong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            ulong_t = static_cast<uint32_t>(deserialize_varint(std::numeric_limits<uint32_t>::max()));
+            return *this;
+        }
+
         return deserialize(reinterpret_cast<int32_t&>(ulong_t));
     }
 
@@ -1379,6 +1524,12 @@ public:
     FastCdr& deserialize(
             int32_t& long_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            long_t = zigzag_decode<int32_t>(static_cast<uint32_t>(deserialize_varint(std::numeric_limits<uint32_t>::max())));
+            return *this;
+        }
+
         if ((last_position_ - current_position_) >= sizeof(long_t))
         {
             current_position_ >> long_t;
@@ -1416,6 +1567,12 @@ public:
     FastCdr& deserialize(
             uint64_t& ulonglong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            ulonglong_t = deserialize_varint(std::numeric_limits<uint64_t>::max());
+            return *this;
+        }
+
         return deserialize(reinterpret_cast<int64_t&>(ulonglong_t));
     }
 
@@ -1429,6 +1586,12 @@ public:
     FastCdr& deserialize(
             int64_t& longlong_t)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            longlong_t = zigzag_decode<int64_t>(deserialize_varint(std::numeric_limits<uint64_t>::max()));
+            return *this;
+        }
+
         if ((last_position_ - current_position_) >= sizeof(longlong_t))
         {
             current_position_ >> longlong_t;
@@ -1709,6 +1872,11 @@ public:
             uint16_t* ushort_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return deserialize_varints(ushort_t, num_elements);
+        }
+
         return deserialize_array(reinterpret_cast<int16_t*>(ushort_t), num_elements);
     }
 
@@ -1735,6 +1903,11 @@ public:
             uint32_t* ulong_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return deserialize_varints(ulong_t, num_elements);
+        }
+
         return deserialize_array(reinterpret_cast<int32_t*>(ulong_t), num_elements);
     }
 
@@ -1772,6 +1945,11 @@ public:
             uint64_t* ulonglong_t,
             size_t num_elements)
     {
+        if (IntegerEncoding::VARINT == integer_encoding_)
+        {
+            return deserialize_varints(ulonglong_t, num_elements);
+        }
+
         return deserialize_array(reinterpret_cast<int64_t*>(ulonglong_t), num_elements);
     }
 
@@ -2068,6 +2246,51 @@ private:
     bool resize(
             size_t min_size_inc);
 
+    /*!
+     * @brief This function serializes an unsigned value as a LEB128 varint.
+     * @param value The value, already zigzag encoded if it is signed.
+     * @return Reference to the eprosima::fastcdr::FastCdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+     */
+    FastCdr& serialize_varint(
+            uint64_t value);
+
+    /*!
+     * @brief This function deserializes a LEB128 varint.
+     * @param max_value The greatest value the varint may store.
+     * @return The decoded value.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the value is greater than max_value.
+     */
+    uint64_t deserialize_varint(
+            uint64_t max_value);
+
+    /*!
+     * @brief This function template serializes an array of integers as LEB128 varints, checking the bounds once.
+     * @param values The array of integers.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::FastCdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to serialize in a position that exceeds the internal memory size.
+     */
+    template<class _T>
+    FastCdr& serialize_varints(
+            const _T* values,
+            size_t num_elements);
+
+    /*!
+     * @brief This function template deserializes an array of integers encoded as LEB128 varints. Runs of varints of
+     * one byte, the usual case of small values, are decoded in blocks.
+     * @param values The array where the integers are stored.
+     * @param num_elements Number of the elements in the array.
+     * @return Reference to the eprosima::fastcdr::FastCdr object.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to deserialize in a position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when a value doesn't fit in the integer type.
+     */
+    template<class _T>
+    FastCdr& deserialize_varints(
+            _T* values,
+            size_t num_elements);
+
     const char* read_string(
             uint32_t& length);
 
@@ -2082,6 +2305,9 @@ private:
 
     //! @brief The last position in the buffer;
     FastBuffer::iterator last_position_;
+
+    //! @brief How the integers are encoded.
+    IntegerEncoding integer_encoding_ {IntegerEncoding::FIXED_WIDTH};
 };
 }     //namespace fastcdr
 } //namespace eprosima
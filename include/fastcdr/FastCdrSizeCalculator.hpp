@@ -0,0 +1,230 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_FASTCDRSIZECALCULATOR_HPP_
+#define _FASTCDR_FASTCDRSIZECALCULATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FastCdr.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief This class offers an interface to calculate the size of the data encoded by eprosima::fastcdr::FastCdr,
+ * which depends on the values of the integers when they are encoded as varints.
+ *
+ * The encoding of FastCdr has no alignment, so the size of a structure is the sum of the sizes of its members.
+ * @ingroup FASTCDRAPIREFERENCE
+ */
+class FastCdrSizeCalculator
+{
+public:
+
+    /*!
+     * @brief Constructor.
+     * @param[in] integer_encoding How the integers are encoded.
+     */
+    explicit FastCdrSizeCalculator(
+            FastCdr::IntegerEncoding integer_encoding = FastCdr::IntegerEncoding::FIXED_WIDTH)
+        : integer_encoding_(integer_encoding)
+    {
+    }
+
+    /*!
+     * @brief Retrieves how the integers are encoded.
+     * @return The encoding of the integers.
+     */
+    FastCdr::IntegerEncoding get_integer_encoding() const
+    {
+        return integer_encoding_;
+    }
+
+    //! Calculates the encoded size of a byte-sized primitive.
+    size_t calculate_serialized_size(
+            const char) const
+    {
+        return 1;
+    }
+
+    //! Calculates the encoded size of a byte-sized primitive.
+    size_t calculate_serialized_size(
+            const int8_t) const
+    {
+        return 1;
+    }
+
+    //! Calculates the encoded size of a byte-sized primitive.
+    size_t calculate_serialized_size(
+            const uint8_t) const
+    {
+        return 1;
+    }
+
+    //! Calculates the encoded size of a boolean.
+    size_t calculate_serialized_size(
+            const bool) const
+    {
+        return 1;
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const int16_t data) const
+    {
+        return integer_size(FastCdr::zigzag_encode(data), sizeof(data));
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const uint16_t data) const
+    {
+        return integer_size(data, sizeof(data));
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const int32_t data) const
+    {
+        return integer_size(FastCdr::zigzag_encode(data), sizeof(data));
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const uint32_t data) const
+    {
+        return integer_size(data, sizeof(data));
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const int64_t data) const
+    {
+        return integer_size(FastCdr::zigzag_encode(data), sizeof(data));
+    }
+
+    //! Calculates the encoded size of an integer.
+    size_t calculate_serialized_size(
+            const uint64_t data) const
+    {
+        return integer_size(data, sizeof(data));
+    }
+
+    //! Calculates the encoded size of a wide character, encoded as an integer of 32 bits.
+    size_t calculate_serialized_size(
+            const wchar_t data) const
+    {
+        return integer_size(static_cast<uint32_t>(data), 4);
+    }
+
+    //! Calculates the encoded size of a float.
+    size_t calculate_serialized_size(
+            const float) const
+    {
+        return 4;
+    }
+
+    //! Calculates the encoded size of a double.
+    size_t calculate_serialized_size(
+            const double) const
+    {
+        return 8;
+    }
+
+    //! Calculates the encoded size of a long double.
+    size_t calculate_serialized_size(
+            const long double) const
+    {
+        return 16;
+    }
+
+    //! Calculates the encoded size of a string: its length, including the null terminator, and its characters.
+    size_t calculate_serialized_size(
+            const std::string& data) const
+    {
+        return calculate_serialized_size(static_cast<uint32_t>(data.size() + 1)) + data.size() + 1;
+    }
+
+    //! Calculates the encoded size of a wide string: its length and its characters, without null terminator.
+    size_t calculate_serialized_size(
+            const std::wstring& data) const
+    {
+        size_t size {calculate_serialized_size(static_cast<uint32_t>(data.size()))};
+
+        for (const wchar_t character : data)
+        {
+            size += calculate_serialized_size(character);
+        }
+
+        return size;
+    }
+
+    //! Calculates the encoded size of an array.
+    template<class _T, size_t _Size>
+    size_t calculate_serialized_size(
+            const std::array<_T, _Size>& data) const
+    {
+        size_t size {0};
+
+        for (const _T& element : data)
+        {
+            size += calculate_serialized_size(element);
+        }
+
+        return size;
+    }
+
+    //! Calculates the encoded size of a sequence: its length and its elements.
+    template<class _T>
+    size_t calculate_serialized_size(
+            const std::vector<_T>& data) const
+    {
+        size_t size {calculate_serialized_size(static_cast<uint32_t>(data.size()))};
+
+        for (const _T& element : data)
+        {
+            size += calculate_serialized_size(element);
+        }
+
+        return size;
+    }
+
+    //! Calculates the encoded size of a sequence of booleans: its length and a byte per element.
+    size_t calculate_serialized_size(
+            const std::vector<bool>& data) const
+    {
+        return calculate_serialized_size(static_cast<uint32_t>(data.size())) + data.size();
+    }
+
+private:
+
+    size_t integer_size(
+            uint64_t value,
+            size_t width) const
+    {
+        return FastCdr::IntegerEncoding::VARINT == integer_encoding_ ? FastCdr::varint_size(value) : width;
+    }
+
+    FastCdr::IntegerEncoding integer_encoding_ {FastCdr::IntegerEncoding::FIXED_WIDTH};
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_FASTCDRSIZECALCULATOR_HPP_
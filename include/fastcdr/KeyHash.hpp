@@ -0,0 +1,150 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_KEYHASH_HPP_
+#define _FASTCDR_KEYHASH_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Cdr.h"
+#include "FastBuffer.h"
+#include "fastcdr_dll.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief This class calculates the key hash of a DDS instance while its key members are being encoded.
+ *
+ * Key members are encoded in big endianness using XCDRv2 and PLAIN_CDR2, and their bytes are hashed right after each
+ * member is encoded, so the serialized key is never stored whole. Only the encoding of the member being added is kept,
+ * in a zeroed window reused by all the keys hashed by this object, which grows when a member doesn't fit in it.
+ *
+ * When the maximum size of the serialized key is 16 bytes or less, the key hash is the serialized key padded with
+ * zeros. Otherwise it is the MD5 digest of the serialized key, calculated by an MD5 implementation built into the
+ * library.
+ */
+class KeyHash
+{
+public:
+
+    //! Size of a key hash in bytes.
+    static constexpr size_t HASH_SIZE {16};
+
+    /*!
+     * @brief Creates a key hash calculator.
+     * @param[in] max_serialized_key_size Maximum size of the serialized key of the type. When greater than @ref
+     * HASH_SIZE, the key hash is calculated using MD5.
+     */
+    Cdr_DllAPI explicit KeyHash(
+            size_t max_serialized_key_size);
+
+    /*!
+     * @brief Encodes the next key member and hashes its bytes.
+     * @param[in] key_member Value of the key member. Key members of nested structures have to be added one by one.
+     * @return Reference to this object.
+     * @exception exception::BadParamException This exception is thrown when the serialized key exceeds @ref
+     * HASH_SIZE without using MD5, or when the value can't be encoded.
+     */
+    template<class _T>
+    KeyHash& serialize(
+            const _T& key_member)
+    {
+        bool consumed {false};
+
+        do
+        {
+            // The encoder is rebuilt for each member, so it always spans the current window.
+            Cdr cdr(window_buffer_, Cdr::BIG_ENDIANNESS, CdrVersion::XCDRv2);
+            cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+            cdr.jump(hashed_);
+            cdr.serialize(key_member);
+            consumed = consume(cdr);
+        } while (!consumed);
+
+        return *this;
+    }
+
+    /*!
+     * @brief Encodes the next key member and hashes its bytes. See @ref serialize.
+     * @param[in] key_member Value of the key member.
+     * @return Reference to this object.
+     */
+    template<class _T>
+    KeyHash& operator <<(
+            const _T& key_member)
+    {
+        return serialize(key_member);
+    }
+
+    /*!
+     * @brief Finishes the calculation of the key hash and resets this object to hash another key.
+     * @param[out] key_hash Calculated key hash.
+     */
+    Cdr_DllAPI void finish(
+            std::array<uint8_t, HASH_SIZE>& key_hash);
+
+    /*!
+     * @brief Discards the key members added since the last call to @ref finish.
+     */
+    Cdr_DllAPI void reset();
+
+private:
+
+    KeyHash(
+            const KeyHash&) = delete;
+
+    KeyHash& operator =(
+            const KeyHash&) = delete;
+
+    /*!
+     * @brief Hashes the bytes encoded since the last call, keeping the alignment of the next member.
+     * @param[in] cdr Encoder of the member, which was positioned at @ref hashed_.
+     * @return False when the member didn't fit in the window, which was enlarged to encode it again.
+     */
+    Cdr_DllAPI bool consume(
+            Cdr& cdr);
+
+    void update(
+            const uint8_t* data,
+            size_t size);
+
+    void transform(
+            const uint8_t* block);
+
+    bool use_md5_ {true};
+
+    std::vector<char> window_;
+
+    FastBuffer window_buffer_;
+
+    //! Bytes at the beginning of the window which were already hashed.
+    size_t hashed_ {0};
+
+    //! Size of the serialized key.
+    uint64_t length_ {0};
+
+    std::array<uint32_t, 4> md5_state_;
+
+    //! Pending bytes of the current MD5 block, or the serialized key when MD5 is not used.
+    std::array<uint8_t, 64> block_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_KEYHASH_HPP_
@@ -0,0 +1,171 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTCDR_SERIALIZATIONPLAN_HPP_
+#define _FASTCDR_SERIALIZATIONPLAN_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "CdrEncoding.hpp"
+#include "fastcdr_dll.h"
+
+namespace eprosima {
+namespace fastcdr {
+
+namespace detail {
+
+//! Element type and number of elements of a primitive or a, maybe multidimensional, std::array of primitives.
+template<class _T>
+struct plan_field
+{
+    using element_type = _T;
+
+    static constexpr size_t num_elements = 1;
+};
+
+template<class _T, size_t _Size>
+struct plan_field<std::array<_T, _Size>>
+{
+    using element_type = typename plan_field<_T>::element_type;
+
+    static constexpr size_t num_elements = _Size * plan_field<_T>::num_elements;
+};
+
+} // namespace detail
+
+/*!
+ * @brief This class stores the precomputed encoding of a final type made only of primitives and arrays of primitives.
+ *
+ * The position of every member in the encoded buffer only depends on the CDR version and on the alignment where the
+ * type starts, so it is computed once when the members are added. Each operation copies a run of contiguous members
+ * of the same width from the object to the buffer, and adjacent members are merged into the same run when there is
+ * no padding between them, neither in memory nor in the buffer.
+ *
+ * A plan is executed by eprosima::fastcdr::Cdr::serialize_with_plan and eprosima::fastcdr::Cdr::deserialize_with_plan,
+ * which check the bounds of the buffer once. The encoding is the same as encoding the members one by one using
+ * eprosima::fastcdr::Cdr.
+ */
+class SerializationPlan
+{
+public:
+
+    //! Copies a run of members of the same width.
+    struct Operation
+    {
+        //! Offset of the first member in the object.
+        size_t source_offset {0};
+
+        //! Offset of the first member in the encoded buffer, relative to the start of the plan.
+        size_t wire_offset {0};
+
+        //! Width of each member in bytes.
+        size_t width {0};
+
+        //! Number of members in the run.
+        size_t num_elements {0};
+
+        //! Whether the bytes of each member are swapped when the endianness is not the native one.
+        bool swap {false};
+
+        //! Whether the members are booleans, whose decoded values are checked.
+        bool boolean {false};
+    };
+
+    /*!
+     * @brief Creates an empty plan.
+     * @param[in] cdr_version CDR version the plan will be executed with.
+     * @param[in] initial_alignment Alignment where the type starts, as used with eprosima::fastcdr::CdrSizeCalculator.
+     */
+    Cdr_DllAPI SerializationPlan(
+            CdrVersion cdr_version,
+            size_t initial_alignment = 0);
+
+    /*!
+     * @brief Adds the next member of the type.
+     * @tparam _T Type of the member: a primitive, an enumeration or a, maybe multidimensional, std::array of them.
+     * wchar_t and long double are not supported because their size in memory is not their encoded size.
+     * @param[in] source_offset Offset of the member in the object, as given by offsetof.
+     * @return Reference to this plan.
+     */
+    template<class _T>
+    SerializationPlan& add_member(
+            size_t source_offset)
+    {
+        using element_type = typename detail::plan_field<_T>::element_type;
+        static_assert(std::is_arithmetic<element_type>::value || std::is_enum<element_type>::value,
+                "Only primitives and arrays of primitives can be planned");
+        static_assert(!std::is_same<element_type, wchar_t>::value && !std::is_same<element_type, long double>::value,
+                "Members whose size in memory is not their encoded size can not be planned");
+        add(source_offset, sizeof(element_type), detail::plan_field<_T>::num_elements,
+                std::is_same<element_type, bool>::value);
+        return *this;
+    }
+
+    //! Returns the operations of the plan.
+    const std::vector<Operation>& operations() const
+    {
+        return operations_;
+    }
+
+    //! Returns the encoded size of the type, including the padding between members.
+    size_t serialized_size() const
+    {
+        return serialized_size_;
+    }
+
+    //! Returns the alignment where the type starts.
+    size_t initial_alignment() const
+    {
+        return initial_alignment_;
+    }
+
+    //! Returns the greatest alignment of the members, which the plan is valid modulo.
+    size_t max_alignment() const
+    {
+        return max_alignment_;
+    }
+
+    //! Returns the alignment of 64 bits members in the CDR version of the plan.
+    size_t align64() const
+    {
+        return align64_;
+    }
+
+private:
+
+    Cdr_DllAPI void add(
+            size_t source_offset,
+            size_t width,
+            size_t num_elements,
+            bool boolean);
+
+    size_t align64_ {4};
+
+    size_t initial_alignment_ {0};
+
+    size_t max_alignment_ {1};
+
+    size_t serialized_size_ {0};
+
+    std::vector<Operation> operations_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_SERIALIZATIONPLAN_HPP_
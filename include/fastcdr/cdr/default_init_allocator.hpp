@@ -0,0 +1,119 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file default_init_allocator.hpp
+ *
+ */
+
+#ifndef FASTCDR_UTILS_DEFAULT_INIT_ALLOCATOR_HPP_
+#define FASTCDR_UTILS_DEFAULT_INIT_ALLOCATOR_HPP_
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace eprosima {
+namespace fastcdr {
+
+/**
+ * @brief Allocator adaptor which default-initializes the elements constructed without arguments.
+ *
+ * Containers using it don't value-initialize (zero-fill) the new elements of primitive types when they grow through
+ * `resize()`. A `std::vector<float, default_init_allocator<float>>` decoded by eprosima::fastcdr::Cdr is therefore
+ * written only once by the decoder, and decoding into a recycled one reuses its capacity.
+ *
+ * @tparam T Type of the allocated elements.
+ * @tparam A Underlying allocator. By default, std::allocator.
+ */
+template<class T, class A = std::allocator<T>>
+class default_init_allocator : public A
+{
+    using a_traits = std::allocator_traits<A>;
+
+public:
+
+    template<class U>
+    struct rebind
+    {
+        using other = default_init_allocator<U, typename a_traits::template rebind_alloc<U>>;
+    };
+
+    using A::A;
+
+    //! @brief Default constructor.
+    default_init_allocator() = default;
+
+    //! @brief Constructs from a copy of the underlying allocator.
+    default_init_allocator(
+            const A& allocator) noexcept
+        : A(allocator)
+    {
+    }
+
+    //! @brief Converting constructor from another instantiation of the adaptor.
+    template<class U, class B>
+    default_init_allocator(
+            const default_init_allocator<U, B>& other) noexcept
+        : A(static_cast<const B&>(other))
+    {
+    }
+
+    /*!
+     * @brief Constructs an element without arguments using default-initialization.
+     * @param[in] ptr Address where the element will be constructed.
+     */
+    template<class U>
+    void construct(
+            U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    /*!
+     * @brief Constructs an element with arguments through the underlying allocator.
+     * @param[in] ptr Address where the element will be constructed.
+     * @param[in] args Arguments forwarded to the constructor.
+     */
+    template<class U, class ... Args>
+    void construct(
+            U* ptr,
+            Args&&... args)
+    {
+        a_traits::construct(static_cast<A&>(*this), ptr, std::forward<Args>(args)...);
+    }
+
+};
+
+template<class T, class A, class U, class B>
+bool operator ==(
+        const default_init_allocator<T, A>& lhs,
+        const default_init_allocator<U, B>& rhs) noexcept
+{
+    return static_cast<const A&>(lhs) == static_cast<const B&>(rhs);
+}
+
+template<class T, class A, class U, class B>
+bool operator !=(
+        const default_init_allocator<T, A>& lhs,
+        const default_init_allocator<U, B>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // FASTCDR_UTILS_DEFAULT_INIT_ALLOCATOR_HPP_
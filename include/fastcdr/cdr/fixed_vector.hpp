@@ -0,0 +1,415 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file fixed_vector.hpp
+ *
+ */
+
+#ifndef FASTCDR_UTILS_FIXED_VECTOR_HPP_
+#define FASTCDR_UTILS_FIXED_VECTOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <fastcdr/config.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+/**
+ * @brief Template class for non-alloc bounded sequences.
+ *
+ * The elements are stored inside the object, so a bounded sequence never touches the heap and can live in shared
+ * memory or preallocated pools when its elements can. Growing beyond the bound throws std::length_error.
+ *
+ * @tparam T Type of the elements.
+ * @tparam MAX_ELEMENTS Maximum number of elements, specified as the template parameter.
+ */
+template<class T, size_t MAX_ELEMENTS>
+class fixed_vector
+{
+public:
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    //! @brief Maximum number of elements.
+    static constexpr size_t max_size = MAX_ELEMENTS;
+
+    //! @brief Default constructor.
+    fixed_vector() noexcept = default;
+
+    /*!
+     * @brief Constructs the given number of value-initialized elements.
+     * @param[in] count Number of elements.
+     */
+    explicit fixed_vector(
+            size_type count)
+    {
+        resize(count);
+    }
+
+    /*!
+     * @brief Constructs the given number of copies of a value.
+     * @param[in] count Number of elements.
+     * @param[in] value Value to be copied.
+     */
+    fixed_vector(
+            size_type count,
+            const T& value)
+    {
+        resize(count, value);
+    }
+
+    /*!
+     * @brief Constructs from an initializer list.
+     * @param[in] init Initializer list.
+     */
+    fixed_vector(
+            std::initializer_list<T> init)
+    {
+        check_capacity(init.size());
+        for (const T& value : init)
+        {
+            emplace_back(value);
+        }
+    }
+
+    fixed_vector(
+            const fixed_vector& other)
+    {
+        for (const T& value : other)
+        {
+            emplace_back(value);
+        }
+    }
+
+    fixed_vector(
+            fixed_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        for (T& value : other)
+        {
+            emplace_back(std::move(value));
+        }
+    }
+
+    ~fixed_vector()
+    {
+        clear();
+    }
+
+    fixed_vector& operator =(
+            const fixed_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (const T& value : other)
+            {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    fixed_vector& operator =(
+            fixed_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (T& value : other)
+            {
+                emplace_back(std::move(value));
+            }
+        }
+        return *this;
+    }
+
+    iterator begin() noexcept
+    {
+        return data();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return data();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return data();
+    }
+
+    iterator end() noexcept
+    {
+        return data() + size_;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return data() + size_;
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return data() + size_;
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    T* data() noexcept
+    {
+        return reinterpret_cast<T*>(storage_);
+    }
+
+    const T* data() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+    bool empty() const noexcept
+    {
+        return 0 == size_;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    //! @brief Returns the maximum number of elements.
+    static constexpr size_type capacity() noexcept
+    {
+        return MAX_ELEMENTS;
+    }
+
+    T& operator [](
+            size_type pos) noexcept
+    {
+        return data()[pos];
+    }
+
+    const T& operator [](
+            size_type pos) const noexcept
+    {
+        return data()[pos];
+    }
+
+    /*!
+     * @brief Returns the element at the given position.
+     * @exception std::out_of_range This exception is thrown when the position is not valid.
+     */
+    T& at(
+            size_type pos)
+    {
+        if (pos >= size_)
+        {
+            FASTCDR_THROW(std::out_of_range("fixed_vector::at"));
+        }
+        return data()[pos];
+    }
+
+    /*!
+     * @brief Returns the element at the given position.
+     * @exception std::out_of_range This exception is thrown when the position is not valid.
+     */
+    const T& at(
+            size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            FASTCDR_THROW(std::out_of_range("fixed_vector::at"));
+        }
+        return data()[pos];
+    }
+
+    T& front() noexcept
+    {
+        return data()[0];
+    }
+
+    const T& front() const noexcept
+    {
+        return data()[0];
+    }
+
+    T& back() noexcept
+    {
+        return data()[size_ - 1];
+    }
+
+    const T& back() const noexcept
+    {
+        return data()[size_ - 1];
+    }
+
+    /*!
+     * @brief Constructs an element in place at the end.
+     * @exception std::length_error This exception is thrown when the sequence is full.
+     */
+    template<class ... Args>
+    T& emplace_back(
+            Args&&... args)
+    {
+        check_capacity(size_ + 1);
+        T* element = ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *element;
+    }
+
+    /*!
+     * @brief Appends a copy of the value.
+     * @exception std::length_error This exception is thrown when the sequence is full.
+     */
+    void push_back(
+            const T& value)
+    {
+        emplace_back(value);
+    }
+
+    /*!
+     * @brief Appends the value.
+     * @exception std::length_error This exception is thrown when the sequence is full.
+     */
+    void push_back(
+            T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    //! @brief Removes the last element.
+    void pop_back() noexcept
+    {
+        --size_;
+        data()[size_].~T();
+    }
+
+    /*!
+     * @brief Changes the number of elements, value-initializing the new ones.
+     * @exception std::length_error This exception is thrown when the new size exceeds the bound.
+     */
+    void resize(
+            size_type count)
+    {
+        check_capacity(count);
+        shrink(count);
+        while (size_ < count)
+        {
+            emplace_back();
+        }
+    }
+
+    /*!
+     * @brief Changes the number of elements, copying the value into the new ones.
+     * @exception std::length_error This exception is thrown when the new size exceeds the bound.
+     */
+    void resize(
+            size_type count,
+            const T& value)
+    {
+        check_capacity(count);
+        shrink(count);
+        while (size_ < count)
+        {
+            emplace_back(value);
+        }
+    }
+
+    //! @brief Removes all elements.
+    void clear() noexcept
+    {
+        shrink(0);
+    }
+
+    bool operator ==(
+            const fixed_vector& other) const
+    {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator !=(
+            const fixed_vector& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    void check_capacity(
+            size_type count) const
+    {
+        if (MAX_ELEMENTS < count)
+        {
+            FASTCDR_THROW(std::length_error("fixed_vector bound exceeded"));
+        }
+    }
+
+    void shrink(
+            size_type count) noexcept
+    {
+        while (count < size_)
+        {
+            pop_back();
+        }
+    }
+
+    //! Holds the elements. One byte is reserved when the bound is zero.
+    alignas(T) unsigned char storage_[0 < MAX_ELEMENTS ? MAX_ELEMENTS * sizeof(T) : 1];
+
+    //! Holds the current number of elements.
+    size_type size_ {0};
+};
+
+template<class T, size_t MAX_ELEMENTS>
+constexpr size_t fixed_vector<T, MAX_ELEMENTS>::max_size;
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // FASTCDR_UTILS_FIXED_VECTOR_HPP_
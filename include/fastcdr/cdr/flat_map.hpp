@@ -0,0 +1,363 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file flat_map.hpp
+ *
+ */
+
+#ifndef FASTCDR_UTILS_FLAT_MAP_HPP_
+#define FASTCDR_UTILS_FLAT_MAP_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fastcdr/config.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+/**
+ * @brief Template class for an associative container storing its elements in a sorted contiguous sequence.
+ *
+ * Lookups are binary searches over contiguous memory and the whole container uses a single allocation. Inserting
+ * at the end an element whose key is greater than the last one (as eprosima::fastcdr::Cdr does when decoding a
+ * map whose keys were encoded in order) is amortized constant time.
+ *
+ * Unlike std::map, the stored elements are `std::pair<Key, T>`. Keys must not be modified through the iterators.
+ * Insertions and removals invalidate the iterators.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped values.
+ * @tparam Compare Comparison function object for the keys.
+ * @tparam Allocator Allocator used by the underlying sequence.
+ */
+template<class Key, class T, class Compare = std::less<Key>,
+        class Allocator = std::allocator<std::pair<Key, T>>>
+class flat_map
+{
+public:
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using container_type = std::vector<value_type, Allocator>;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    //! @brief Default constructor.
+    flat_map() = default;
+
+    //! @brief Constructs an empty container using the given comparison function object and allocator.
+    explicit flat_map(
+            const Compare& compare,
+            const Allocator& allocator = Allocator())
+        : data_(allocator)
+        , compare_(compare)
+    {
+    }
+
+    //! @brief Constructs an empty container using the given allocator.
+    explicit flat_map(
+            const Allocator& allocator)
+        : data_(allocator)
+    {
+    }
+
+    //! @brief Constructs the container with the contents of the initializer list.
+    flat_map(
+            std::initializer_list<value_type> init,
+            const Compare& compare = Compare(),
+            const Allocator& allocator = Allocator())
+        : data_(allocator)
+        , compare_(compare)
+    {
+        data_.reserve(init.size());
+        for (const auto& value : init)
+        {
+            insert(value);
+        }
+    }
+
+    //! @brief Returns the allocator associated with the container.
+    allocator_type get_allocator() const
+    {
+        return data_.get_allocator();
+    }
+
+    //! @brief Returns the comparison function object for the keys.
+    key_compare key_comp() const
+    {
+        return compare_;
+    }
+
+    iterator begin() noexcept
+    {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return data_.begin();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return data_.cbegin();
+    }
+
+    iterator end() noexcept
+    {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return data_.end();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return data_.cend();
+    }
+
+    bool empty() const noexcept
+    {
+        return data_.empty();
+    }
+
+    size_type size() const noexcept
+    {
+        return data_.size();
+    }
+
+    size_type capacity() const noexcept
+    {
+        return data_.capacity();
+    }
+
+    //! @brief Reserves storage for the given number of elements.
+    void reserve(
+            size_type new_capacity)
+    {
+        data_.reserve(new_capacity);
+    }
+
+    //! @brief Removes all elements. The capacity is kept.
+    void clear() noexcept
+    {
+        data_.clear();
+    }
+
+    //! @brief Returns an iterator to the first element whose key is not less than the given one.
+    iterator lower_bound(
+            const Key& key)
+    {
+        return std::lower_bound(data_.begin(), data_.end(), key, key_value_compare{compare_});
+    }
+
+    //! @brief Returns an iterator to the first element whose key is not less than the given one.
+    const_iterator lower_bound(
+            const Key& key) const
+    {
+        return std::lower_bound(data_.begin(), data_.end(), key, key_value_compare{compare_});
+    }
+
+    //! @brief Returns an iterator to the element with the given key, or end() if not found.
+    iterator find(
+            const Key& key)
+    {
+        iterator it = lower_bound(key);
+        return (it != data_.end() && !compare_(key, it->first)) ? it : data_.end();
+    }
+
+    //! @brief Returns an iterator to the element with the given key, or end() if not found.
+    const_iterator find(
+            const Key& key) const
+    {
+        const_iterator it = lower_bound(key);
+        return (it != data_.end() && !compare_(key, it->first)) ? it : data_.end();
+    }
+
+    //! @brief Returns the number of elements with the given key (0 or 1).
+    size_type count(
+            const Key& key) const
+    {
+        return find(key) != data_.end() ? 1 : 0;
+    }
+
+    /*!
+     * @brief Returns a reference to the value mapped to the given key.
+     * @exception std::out_of_range This exception is thrown when there is no element with the given key.
+     */
+    T& at(
+            const Key& key)
+    {
+        iterator it = find(key);
+        if (it == data_.end())
+        {
+            FASTCDR_THROW(std::out_of_range("flat_map::at"));
+        }
+        return it->second;
+    }
+
+    /*!
+     * @brief Returns a reference to the value mapped to the given key.
+     * @exception std::out_of_range This exception is thrown when there is no element with the given key.
+     */
+    const T& at(
+            const Key& key) const
+    {
+        const_iterator it = find(key);
+        if (it == data_.end())
+        {
+            FASTCDR_THROW(std::out_of_range("flat_map::at"));
+        }
+        return it->second;
+    }
+
+    //! @brief Returns a reference to the value mapped to the given key, inserting it if it doesn't exist.
+    T& operator [](
+            const Key& key)
+    {
+        iterator it = lower_bound(key);
+        if (it == data_.end() || compare_(key, it->first))
+        {
+            it = data_.emplace(it, key, T());
+        }
+        return it->second;
+    }
+
+    //! @brief Inserts an element if there is no element with the same key.
+    std::pair<iterator, bool> insert(
+            const value_type& value)
+    {
+        return emplace(value);
+    }
+
+    //! @brief Inserts an element if there is no element with the same key.
+    std::pair<iterator, bool> insert(
+            value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    //! @brief Constructs an element in place if there is no element with the same key.
+    template<class ... Args>
+    std::pair<iterator, bool> emplace(
+            Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        iterator it = lower_bound(value.first);
+        if (it != data_.end() && !compare_(value.first, it->first))
+        {
+            return {it, false};
+        }
+        return {data_.emplace(it, std::move(value)), true};
+    }
+
+    /*!
+     * @brief Constructs an element in place if there is no element with the same key, using a hint.
+     * When the element belongs just before the hint, it is inserted there without searching.
+     * @return Iterator to the inserted element or to the element with the same key.
+     */
+    template<class ... Args>
+    iterator emplace_hint(
+            const_iterator hint,
+            Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        const bool after_previous {hint == data_.cbegin() || compare_(std::prev(hint)->first, value.first)};
+        const bool before_hint {hint == data_.cend() || compare_(value.first, hint->first)};
+
+        if (after_previous && before_hint)
+        {
+            if (hint == data_.cend())
+            {
+                data_.push_back(std::move(value));
+                return std::prev(data_.end());
+            }
+            return data_.emplace(hint, std::move(value));
+        }
+
+        return emplace(std::move(value)).first;
+    }
+
+    //! @brief Removes the element with the given key.
+    size_type erase(
+            const Key& key)
+    {
+        iterator it = find(key);
+        if (it == data_.end())
+        {
+            return 0;
+        }
+        data_.erase(it);
+        return 1;
+    }
+
+    //! @brief Removes the element at the given position.
+    iterator erase(
+            const_iterator position)
+    {
+        return data_.erase(position);
+    }
+
+    bool operator ==(
+            const flat_map& other) const
+    {
+        return data_ == other.data_;
+    }
+
+    bool operator !=(
+            const flat_map& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    //! Compares an element with a key.
+    struct key_value_compare
+    {
+        bool operator ()(
+                const value_type& value,
+                const Key& key) const
+        {
+            return compare(value.first, key);
+        }
+
+        const Compare& compare;
+    };
+
+    container_type data_;
+
+    Compare compare_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // FASTCDR_UTILS_FLAT_MAP_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_COMPARISON_HPP_
+#define _FASTCDR_DYNAMIC_COMPARISON_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "TypeDescription.hpp"
+#include "TypeInterpreter.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief Compares two serialized payloads, starting with their encapsulations, without decoding them.
+ *
+ * Padding is ignored and the members of mutable types can be encoded in any order. See
+ * eprosima::fastcdr::TypeInterpreter::equals.
+ * @param[in] first Buffer of the first payload.
+ * @param[in] first_size Size of the first buffer.
+ * @param[in] second Buffer of the second payload.
+ * @param[in] second_size Size of the second buffer.
+ * @param[in] interpreter Compiled description of the data model.
+ * @param[in] type Index of the type of the payloads.
+ * @return Whether both payloads hold the same value.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when a buffer doesn't contain the whole
+ * payload.
+ * @exception exception::BadParamException This exception is thrown when a payload is not valid.
+ */
+Cdr_DllAPI bool equals(
+        const char* first,
+        size_t first_size,
+        const char* second,
+        size_t second_size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type);
+
+/*!
+ * @brief Calculates the hash of a serialized payload, starting with its encapsulation, without decoding it.
+ *
+ * Payloads holding the same value according to @ref equals have the same hash. See
+ * eprosima::fastcdr::TypeInterpreter::hash.
+ * @param[in] buffer Serialized payload.
+ * @param[in] size Size of the buffer.
+ * @param[in] interpreter Compiled description of the data model.
+ * @param[in] type Index of the type of the payload.
+ * @return Hash of the value of the payload.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the whole
+ * payload.
+ * @exception exception::BadParamException This exception is thrown when the payload is not valid.
+ */
+Cdr_DllAPI uint64_t hash(
+        const char* buffer,
+        size_t size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type);
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_COMPARISON_HPP_
@@ -0,0 +1,167 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_DYNAMICVALUE_HPP_
+#define _FASTCDR_DYNAMIC_DYNAMICVALUE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "TypeDescription.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief Generic value of a type described by a eprosima::fastcdr::TypeDescription.
+ *
+ * Primitive values are stored using their native C++ type: bool, char, wchar_t, the fixed width integers, float,
+ * double and long double. Sequences and arrays of primitives, including multidimensional ones, store their elements
+ * contiguously, so they are encoded and decoded as a block.
+ */
+class DynamicValue
+{
+public:
+
+    DynamicValue() = default;
+
+    /*!
+     * @brief Creates an empty value.
+     * @param[in] value_kind Kind of the type of the value.
+     */
+    explicit DynamicValue(
+            TypeKind value_kind)
+        : kind(value_kind)
+    {
+    }
+
+    /*!
+     * @brief Returns the value of a primitive.
+     * @tparam _T Native type of the primitive.
+     */
+    template<class _T>
+    _T get() const
+    {
+        static_assert(std::is_arithmetic<_T>::value, "Only primitives are stored in place");
+        _T value;
+        memcpy(&value, primitive_, sizeof(_T));
+        return value;
+    }
+
+    /*!
+     * @brief Sets the value of a primitive.
+     * @tparam _T Native type of the primitive.
+     */
+    template<class _T>
+    void set(
+            _T value)
+    {
+        static_assert(std::is_arithmetic<_T>::value, "Only primitives are stored in place");
+        memcpy(primitive_, &value, sizeof(_T));
+    }
+
+    /*!
+     * @brief Returns the number of elements of a sequence or array of primitives.
+     * @tparam _T Native type of the elements.
+     */
+    template<class _T>
+    size_t primitive_count() const
+    {
+        return primitives_.size() / sizeof(_T);
+    }
+
+    /*!
+     * @brief Returns the elements of a sequence or array of primitives.
+     * @tparam _T Native type of the elements.
+     */
+    template<class _T>
+    const _T* primitives() const
+    {
+        return reinterpret_cast<const _T*>(primitives_.data());
+    }
+
+    /*!
+     * @brief Returns the elements of a sequence or array of primitives.
+     * @tparam _T Native type of the elements.
+     */
+    template<class _T>
+    _T* primitives()
+    {
+        return reinterpret_cast<_T*>(primitives_.data());
+    }
+
+    /*!
+     * @brief Changes the number of elements of a sequence or array of primitives. New elements are zero-filled.
+     * @tparam _T Native type of the elements.
+     * @param[in] count Number of elements.
+     */
+    template<class _T>
+    void resize_primitives(
+            size_t count)
+    {
+        primitives_.resize(count * sizeof(_T));
+    }
+
+    /*!
+     * @brief Sets the elements of a sequence or array of primitives.
+     * @tparam _T Native type of the elements.
+     * @param[in] data Pointer to the elements.
+     * @param[in] count Number of elements.
+     */
+    template<class _T>
+    void assign_primitives(
+            const _T* data,
+            size_t count)
+    {
+        static_assert(std::is_arithmetic<_T>::value, "Only primitives are stored contiguously");
+        primitives_.resize(count * sizeof(_T));
+        if (0 < count)
+        {
+            memcpy(primitives_.data(), data, count * sizeof(_T));
+        }
+    }
+
+    //! Kind of the type of the value.
+    TypeKind kind {TypeKind::BOOLEAN};
+
+    //! Whether the value is present. Only meaningful for optional members.
+    bool present {true};
+
+    //! Characters of a TypeKind::STRING8 value.
+    std::string string8;
+
+    //! Characters of a TypeKind::STRING16 value.
+    std::wstring string16;
+
+    /*!
+     * Elements of sequences and arrays of non-primitives, keys and values of maps interleaved, or members of
+     * structures in declaration order.
+     */
+    std::vector<DynamicValue> elements;
+
+private:
+
+    alignas(long double) unsigned char primitive_[sizeof(long double)] {};
+
+    //! Storage allocated by operator new, which is suitably aligned for every primitive.
+    std::vector<unsigned char> primitives_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_DYNAMICVALUE_HPP_
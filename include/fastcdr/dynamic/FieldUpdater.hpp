@@ -0,0 +1,168 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_FIELDUPDATER_HPP_
+#define _FASTCDR_DYNAMIC_FIELDUPDATER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "../CdrEncoding.hpp"
+#include "../fastcdr_dll.h"
+#include "TypeDescription.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief This class overwrites single fields of payloads already serialized, starting with their encapsulation, whose
+ * type has a fixed layout.
+ *
+ * A type has a fixed layout when it is made of primitives, arrays and non-optional members of final and appendable
+ * structures, so every field is always encoded at the same position for a CDR version. The position of a field is
+ * computed once, when it is first located, and kept for the next calls. Updating a field then only writes its bytes,
+ * swapped when the payload endianness is not the native one.
+ *
+ * Locating fields is not thread-safe. Updating them with already located fields is.
+ */
+class FieldUpdater
+{
+public:
+
+    //! Position of a field in the payloads.
+    struct Location
+    {
+        //! Offset of the field from the start of the payload, including the encapsulation.
+        size_t offset {0};
+
+        //! Kind of the primitives of the field.
+        TypeKind kind {TypeKind::BOOLEAN};
+
+        //! Number of primitives of the field: 1, or the number of elements of an array of primitives.
+        size_t num_elements {1};
+    };
+
+    /*!
+     * @brief Computes the layout of a type.
+     * @param[in] description Description of the data model. It is copied.
+     * @param[in] type Index of the type of the payloads.
+     * @param[in] cdr_version CDR version of the payloads: CdrVersion::XCDRv1 or CdrVersion::XCDRv2.
+     * @exception exception::BadParamException This exception is thrown when the type has no fixed layout or the CDR
+     * version is not supported.
+     */
+    Cdr_DllAPI FieldUpdater(
+            const TypeDescription& description,
+            TypeDescription::TypeIndex type,
+            CdrVersion cdr_version);
+
+    /*!
+     * @brief Locates a field.
+     * @param[in] path Steps from the type of the payloads to the field: the identifier of a member of a structure or
+     * the index of an element of an array. The field has to be a primitive or an array of primitives.
+     * @return Reference to the location of the field, which is valid while this object exists.
+     * @exception exception::BadParamException This exception is thrown when the path doesn't lead to a primitive or an
+     * array of primitives.
+     */
+    Cdr_DllAPI const Location& locate(
+            const std::vector<uint32_t>& path);
+
+    /*!
+     * @brief Overwrites a primitive field.
+     * @param[inout] payload Serialized payload.
+     * @param[in] size Size of the payload.
+     * @param[in] location Location of the field, see @ref locate.
+     * @param[in] value New value of the field. Its size has to be the encoded size of the field.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the payload doesn't contain the
+     * field.
+     * @exception exception::BadParamException This exception is thrown when the encapsulation doesn't match the CDR
+     * version and the type, or the value doesn't match the field.
+     */
+    template<class _T>
+    void update(
+            char* payload,
+            size_t size,
+            const Location& location,
+            const _T& value) const
+    {
+        update_array(payload, size, location, &value, 1);
+    }
+
+    /*!
+     * @brief Overwrites a field which is an array of primitives.
+     * @param[inout] payload Serialized payload.
+     * @param[in] size Size of the payload.
+     * @param[in] location Location of the field, see @ref locate.
+     * @param[in] values New values of the elements. Their size has to be the encoded size of the elements.
+     * @param[in] num_elements Number of values. It has to be the number of elements of the field.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the payload doesn't contain the
+     * field.
+     * @exception exception::BadParamException This exception is thrown when the encapsulation doesn't match the CDR
+     * version and the type, or the values don't match the field.
+     */
+    template<class _T>
+    void update_array(
+            char* payload,
+            size_t size,
+            const Location& location,
+            const _T* values,
+            size_t num_elements) const
+    {
+        static_assert(std::is_arithmetic<_T>::value || std::is_enum<_T>::value,
+                "Only primitives can be written into a field");
+        write(payload, size, location, reinterpret_cast<const char*>(values), sizeof(_T), num_elements);
+    }
+
+    //! Returns the size of the payloads, including the encapsulation.
+    size_t serialized_size() const
+    {
+        return serialized_size_;
+    }
+
+private:
+
+    Cdr_DllAPI void write(
+            char* payload,
+            size_t size,
+            const Location& location,
+            const char* values,
+            size_t width,
+            size_t num_elements) const;
+
+    size_t primitive_alignment(
+            TypeKind kind) const;
+
+    size_t skip_type(
+            TypeDescription::TypeIndex index,
+            size_t offset) const;
+
+    TypeDescription description_;
+
+    TypeDescription::TypeIndex type_ {0};
+
+    CdrVersion cdr_version_ {CdrVersion::XCDRv2};
+
+    EncodingAlgorithmFlag encoding_ {EncodingAlgorithmFlag::PLAIN_CDR2};
+
+    size_t serialized_size_ {0};
+
+    std::map<std::vector<uint32_t>, Location> locations_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_FIELDUPDATER_HPP_
@@ -0,0 +1,294 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_PAYLOADVIEW_HPP_
+#define _FASTCDR_DYNAMIC_PAYLOADVIEW_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Cdr.h"
+#include "../exceptions/BadParamException.h"
+#include "../FastBuffer.h"
+#include "../fastcdr_dll.h"
+#include "TypeDescription.hpp"
+#include "TypeInterpreter.hpp"
+
+#if FASTCDR_HAVE_STRING_VIEW
+#include <string_view>
+#endif // if FASTCDR_HAVE_STRING_VIEW
+
+namespace eprosima {
+namespace fastcdr {
+
+class PayloadView;
+
+/*!
+ * @brief This class refers to a value encoded in a payload viewed by eprosima::fastcdr::PayloadView.
+ *
+ * It is a small handle which can be copied freely, valid while its eprosima::fastcdr::PayloadView exists. Nothing is
+ * decoded until a primitive or a string is read, and then only that value is.
+ */
+class ValueView
+{
+public:
+
+    //! Creates an empty view, as returned for members not present in the payload.
+    ValueView() = default;
+
+    /*!
+     * @brief Returns whether the view refers to a value.
+     * @return false if the view was returned for a member not present in the payload.
+     */
+    explicit operator bool() const
+    {
+        return nullptr != payload_;
+    }
+
+    //! Returns the index of the type of the value.
+    TypeDescription::TypeIndex type() const
+    {
+        return type_;
+    }
+
+    //! Returns the kind of the type of the value.
+    Cdr_DllAPI TypeKind kind() const;
+
+    /*!
+     * @brief Reads a primitive value.
+     * @tparam _T Type of the value. Its size has to be the encoded size of the primitive.
+     * @return The decoded value.
+     * @exception exception::BadParamException This exception is thrown when the value is not a primitive of the size
+     * of _T, or it is not valid.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the payload is truncated.
+     */
+    template<class _T>
+    _T get() const;
+
+    /*!
+     * @brief Returns the characters of a string of TypeKind::STRING8, which are not copied.
+     * @param[out] length Number of characters, without the null terminator.
+     * @return Pointer to the characters in the payload.
+     * @exception exception::BadParamException This exception is thrown when the value is not a string.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the payload is truncated.
+     */
+    Cdr_DllAPI const char* get_string(
+            size_t& length) const;
+
+#if FASTCDR_HAVE_STRING_VIEW
+    /*!
+     * @brief Returns the characters of a string of TypeKind::STRING8, which are not copied.
+     * @return View of the characters in the payload.
+     */
+    std::string_view get_string_view() const
+    {
+        size_t length {0};
+        const char* data {get_string(length)};
+        return std::string_view(data, length);
+    }
+
+#endif // if FASTCDR_HAVE_STRING_VIEW
+
+    /*!
+     * @brief Returns a member of a structure.
+     * @param[in] id Identifier of the member.
+     * @return View of the member, or an empty view if the member is not present.
+     * @exception exception::BadParamException This exception is thrown when the value is not a structure.
+     */
+    Cdr_DllAPI ValueView member(
+            uint32_t id) const;
+
+    /*!
+     * @brief Returns the number of elements of an array or a sequence, the number of entries of a map or the number
+     * of characters of a string.
+     * @return The number of elements.
+     * @exception exception::BadParamException This exception is thrown when the value is not a collection.
+     */
+    Cdr_DllAPI size_t size() const;
+
+    /*!
+     * @brief Returns an element of an array or a sequence, or the value of an entry of a map.
+     * @param[in] index Position of the element.
+     * @return View of the element.
+     * @exception exception::BadParamException This exception is thrown when the value is not a collection or the
+     * index is out of its bounds.
+     */
+    Cdr_DllAPI ValueView element(
+            size_t index) const;
+
+    /*!
+     * @brief Returns the key of an entry of a map.
+     * @param[in] index Position of the entry.
+     * @return View of the key.
+     * @exception exception::BadParamException This exception is thrown when the value is not a map or the index is
+     * out of its bounds.
+     */
+    Cdr_DllAPI ValueView key(
+            size_t index) const;
+
+private:
+
+    friend class PayloadView;
+
+    ValueView(
+            PayloadView* payload,
+            TypeDescription::TypeIndex type,
+            size_t offset)
+        : payload_(payload)
+        , type_(type)
+        , offset_(offset)
+    {
+    }
+
+    PayloadView* payload_ {nullptr};
+
+    TypeDescription::TypeIndex type_ {0};
+
+    //! Position of the value, relative to the beginning of the buffer. The view keeps the decoder state there.
+    size_t offset_ {0};
+};
+
+/*!
+ * @brief This class gives random access to the values of a serialized payload, starting with its encapsulation,
+ * without decoding it, using a compiled description of its type.
+ *
+ * Values are reached from the root view through eprosima::fastcdr::ValueView. Primitive elements of arrays and
+ * sequences are located by arithmetic. Members of structures and non-primitive elements are located by skipping the
+ * values before them, the first time they are looked up. Their positions are kept, so the next lookups don't walk the
+ * payload again. Members of mutable types are located by their member headers.
+ *
+ * The buffer must not be modified nor released while the view is in use. The view is not thread-safe.
+ */
+class PayloadView
+{
+public:
+
+    /*!
+     * @brief Reads the encapsulation of a payload.
+     * @param[in] interpreter Compiled description of the data model. It has to outlive the view.
+     * @param[in] type Index of the type of the payload.
+     * @param[in] buffer Serialized payload. It is not modified.
+     * @param[in] size Size of the buffer.
+     * @exception exception::BadParamException This exception is thrown when the encapsulation is not valid or doesn't
+     * match the type.
+     */
+    Cdr_DllAPI PayloadView(
+            const TypeInterpreter& interpreter,
+            TypeDescription::TypeIndex type,
+            const char* buffer,
+            size_t size);
+
+    PayloadView(
+            const PayloadView&) = delete;
+
+    PayloadView& operator =(
+            const PayloadView&) = delete;
+
+    //! Returns the view of the whole value of the payload.
+    ValueView root()
+    {
+        return root_;
+    }
+
+private:
+
+    friend class ValueView;
+
+    //! Position of a value, as stored by ValueView.
+    struct Position
+    {
+        size_t offset {0};
+
+        bool present {true};
+    };
+
+    //! Positions the decoder at the beginning of a value, restoring the state kept at its position.
+    Cdr_DllAPI void move_to(
+            const ValueView& value);
+
+    //! Returns the position of the decoder, keeping its state so values found there can be decoded later.
+    Position position();
+
+    template<class _T>
+    _T read(
+            const ValueView& value)
+    {
+        static_assert(std::is_arithmetic<_T>::value || std::is_enum<_T>::value, "Only primitives can be read");
+
+        if (!TypeDescription::is_primitive(value.kind()) ||
+                TypeDescription::primitive_size(value.kind()) != sizeof(_T))
+        {
+            FASTCDR_THROW(exception::BadParamException("The value is not a primitive of the requested size"));
+        }
+
+        _T primitive {};
+        move_to(value);
+        cdr_.deserialize(primitive);
+        return primitive;
+    }
+
+    const char* read_string(
+            const ValueView& value,
+            size_t& length);
+
+    ValueView member(
+            const ValueView& structure,
+            uint32_t id);
+
+    size_t size(
+            const ValueView& collection);
+
+    ValueView element(
+            const ValueView& collection,
+            size_t index,
+            bool key);
+
+    const TypeInterpreter& interpreter_;
+
+    FastBuffer fast_buffer_;
+
+    Cdr cdr_;
+
+    ValueView root_;
+
+    //! States of the decoder at the positions of the values found, by position.
+    std::map<size_t, Cdr::state> states_;
+
+    //! Positions of the members of structures, by position and type of the structure and member identifier.
+    std::map<std::tuple<size_t, TypeDescription::TypeIndex, uint32_t>, Position> members_;
+
+    //! Positions of the elements of collections of non-primitives, by position and type of the collection.
+    std::map<std::pair<size_t, TypeDescription::TypeIndex>, std::vector<Position>> elements_;
+};
+
+template<class _T>
+_T ValueView::get() const
+{
+    if (nullptr == payload_)
+    {
+        FASTCDR_THROW(exception::BadParamException("The view is empty"));
+    }
+
+    return payload_->read<_T>(*this);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_PAYLOADVIEW_HPP_
@@ -0,0 +1,99 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_TRANSCODER_HPP_
+#define _FASTCDR_DYNAMIC_TRANSCODER_HPP_
+
+#include <cstddef>
+
+#include "../CdrEncoding.hpp"
+#include "TypeDescription.hpp"
+#include "TypeInterpreter.hpp"
+#include "Validator.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief Changes in place the endianness of a serialized payload, starting with its encapsulation, using a runtime
+ * description of its type.
+ *
+ * Nothing is decoded into objects, allocated nor thrown. The payload is validated as it is walked, see
+ * eprosima::fastcdr::Cdr::transcode_endianness, and the endianness bit of the encapsulation is flipped once the whole
+ * value was swapped. On error, the value may be left partially swapped and the encapsulation is not changed.
+ * @param[inout] buffer Serialized payload.
+ * @param[in] size Size of the buffer.
+ * @param[in] description Description of the data model.
+ * @param[in] type Index of the type of the payload.
+ * @return Result of the operation. On success, its length is the number of bytes of the payload.
+ */
+Cdr_DllAPI ValidationResult transcode_endianness(
+        char* buffer,
+        size_t size,
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type);
+
+/*!
+ * @brief Calculates the size of a serialized payload, starting with its encapsulation, once transcoded to another CDR
+ * version. See @ref transcode_cdr_version.
+ * @param[in] buffer Serialized payload.
+ * @param[in] size Size of the buffer.
+ * @param[in] interpreter Compiled description of the data model.
+ * @param[in] type Index of the type of the payload.
+ * @param[in] cdr_version CDR version of the transcoded payload.
+ * @return Size of the transcoded payload, including its encapsulation.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the whole
+ * payload.
+ * @exception exception::BadParamException This exception is thrown when the payload is not valid.
+ */
+Cdr_DllAPI size_t calculate_transcoded_size(
+        const char* buffer,
+        size_t size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version);
+
+/*!
+ * @brief Transcodes a serialized payload, starting with its encapsulation, from XCDRv1 to XCDRv2 or vice versa,
+ * using a compiled description of its type.
+ *
+ * The payload is read member by member and written directly into the destination with the rules of the target CDR
+ * version, without decoding it into objects nor allocating memory. The endianness and the options of the encapsulation
+ * are kept. Members of mutable types not found in the description are dropped.
+ * @param[in] buffer Serialized payload.
+ * @param[in] size Size of the buffer.
+ * @param[out] destination Buffer where the transcoded payload is written.
+ * @param[in] destination_size Size of the destination buffer. See @ref calculate_transcoded_size.
+ * @param[in] interpreter Compiled description of the data model.
+ * @param[in] type Index of the type of the payload.
+ * @param[in] cdr_version CDR version of the transcoded payload: CdrVersion::XCDRv1 or CdrVersion::XCDRv2.
+ * @return Size of the transcoded payload, including its encapsulation.
+ * @exception exception::NotEnoughMemoryException This exception is thrown when the buffer doesn't contain the whole
+ * payload or the destination can't hold the transcoded one.
+ * @exception exception::BadParamException This exception is thrown when the payload is not valid or the CDR version is
+ * not supported.
+ */
+Cdr_DllAPI size_t transcode_cdr_version(
+        const char* buffer,
+        size_t size,
+        char* destination,
+        size_t destination_size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version);
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_TRANSCODER_HPP_
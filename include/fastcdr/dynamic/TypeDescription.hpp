@@ -0,0 +1,302 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_TYPEDESCRIPTION_HPP_
+#define _FASTCDR_DYNAMIC_TYPEDESCRIPTION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../CdrEncoding.hpp"
+#include "../fastcdr_dll.h"
+#include "../xcdr/MemberId.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Kinds of types which can be described by a eprosima::fastcdr::TypeDescription.
+enum class TypeKind : uint8_t
+{
+    BOOLEAN,
+    CHAR8,
+    //! Wide character, encoded in 2 bytes.
+    CHAR16,
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    //! Also used for enumerations.
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT32,
+    FLOAT64,
+    FLOAT128,
+    STRING8,
+    STRING16,
+    SEQUENCE,
+    ARRAY,
+    MAP,
+    STRUCTURE
+};
+
+//! Extensibility of a structure, which selects its encoding algorithm.
+enum class Extensibility : uint8_t
+{
+    FINAL,
+    APPENDABLE,
+    MUTABLE
+};
+
+/*!
+ * @brief This class describes the types of a data model at runtime, so serialized data can be inspected without
+ * generated code.
+ *
+ * Types are stored in a flat table and referenced by their index. The primitive types and the unbounded strings are
+ * predefined, and their index is the value of their eprosima::fastcdr::TypeKind. Composed types are added referencing
+ * the index of their element types. A structure can be declared before setting its members, which allows recursive
+ * types.
+ */
+class TypeDescription
+{
+public:
+
+    //! Index of a type in the description.
+    using TypeIndex = uint32_t;
+
+    //! Describes a member of a structure.
+    struct Member
+    {
+        //! Member identifier. It also stores whether the member has to be understood.
+        MemberId id;
+
+        //! Index of the type of the member.
+        TypeIndex type {0};
+
+        //! Whether the member is optional.
+        bool optional {false};
+
+        //! Whether the member is part of the key.
+        bool key {false};
+    };
+
+    //! Describes a type.
+    struct Type
+    {
+        TypeKind kind {TypeKind::BOOLEAN};
+
+        Extensibility extensibility {Extensibility::FINAL};
+
+        //! Element type of sequences and arrays, and value type of maps.
+        TypeIndex element {0};
+
+        //! Key type of maps.
+        TypeIndex key {0};
+
+        //! Bound of strings, sequences and maps (0 if unbounded), or length of arrays.
+        uint32_t bound {0};
+
+        //! Position of the first member of a structure.
+        uint32_t first_member {0};
+
+        //! Number of members of a structure.
+        uint32_t member_count {0};
+    };
+
+    //! Creates a description containing the predefined types.
+    Cdr_DllAPI TypeDescription();
+
+    /*!
+     * @brief Returns the index of a predefined type.
+     * @param[in] kind Kind of a primitive type or an unbounded string.
+     * @return Index of the type.
+     */
+    static TypeIndex predefined(
+            TypeKind kind)
+    {
+        return static_cast<TypeIndex>(kind);
+    }
+
+    /*!
+     * @brief Adds a bounded string.
+     * @param[in] kind TypeKind::STRING8 or TypeKind::STRING16.
+     * @param[in] bound Maximum number of characters.
+     * @return Index of the new type.
+     * @exception exception::BadParamException This exception is thrown when the kind is not a string kind.
+     */
+    Cdr_DllAPI TypeIndex add_string(
+            TypeKind kind,
+            uint32_t bound);
+
+    /*!
+     * @brief Adds a sequence.
+     * @param[in] element Index of the element type.
+     * @param[in] bound Maximum number of elements, or 0 if unbounded.
+     * @return Index of the new type.
+     * @exception exception::BadParamException This exception is thrown when the element type doesn't exist.
+     */
+    Cdr_DllAPI TypeIndex add_sequence(
+            TypeIndex element,
+            uint32_t bound = 0);
+
+    /*!
+     * @brief Adds an array. Multidimensional arrays are arrays of arrays.
+     * @param[in] element Index of the element type.
+     * @param[in] length Number of elements.
+     * @return Index of the new type.
+     * @exception exception::BadParamException This exception is thrown when the element type doesn't exist.
+     */
+    Cdr_DllAPI TypeIndex add_array(
+            TypeIndex element,
+            uint32_t length);
+
+    /*!
+     * @brief Adds a map.
+     * @param[in] key Index of the key type.
+     * @param[in] value Index of the value type.
+     * @param[in] bound Maximum number of elements, or 0 if unbounded.
+     * @return Index of the new type.
+     * @exception exception::BadParamException This exception is thrown when the key or value type doesn't exist.
+     */
+    Cdr_DllAPI TypeIndex add_map(
+            TypeIndex key,
+            TypeIndex value,
+            uint32_t bound = 0);
+
+    /*!
+     * @brief Declares a structure without members. They are set later using @ref set_members.
+     * @param[in] extensibility Extensibility of the structure.
+     * @return Index of the new type.
+     */
+    Cdr_DllAPI TypeIndex declare_structure(
+            Extensibility extensibility);
+
+    /*!
+     * @brief Sets the members of a declared structure.
+     * @param[in] structure Index of the structure.
+     * @param[in] members Members in declaration order.
+     * @exception exception::BadParamException This exception is thrown when the type is not a structure, its members
+     * were already set or a member type doesn't exist.
+     */
+    Cdr_DllAPI void set_members(
+            TypeIndex structure,
+            const std::vector<Member>& members);
+
+    /*!
+     * @brief Adds a structure.
+     * @param[in] extensibility Extensibility of the structure.
+     * @param[in] members Members in declaration order.
+     * @return Index of the new type.
+     * @exception exception::BadParamException This exception is thrown when a member type doesn't exist.
+     */
+    Cdr_DllAPI TypeIndex add_structure(
+            Extensibility extensibility,
+            const std::vector<Member>& members);
+
+    /*!
+     * @brief Returns a type.
+     * @param[in] index Index of the type. It has to exist.
+     * @return Reference to the type.
+     */
+    const Type& type(
+            TypeIndex index) const
+    {
+        return types_[index];
+    }
+
+    /*!
+     * @brief Returns a member of a structure.
+     * @param[in] structure Structure type.
+     * @param[in] position Position of the member in the structure. It has to exist.
+     * @return Reference to the member.
+     */
+    const Member& member(
+            const Type& structure,
+            uint32_t position) const
+    {
+        return members_[structure.first_member + position];
+    }
+
+    /*!
+     * @brief Looks for a member of a structure by its identifier.
+     * @param[in] structure Structure type.
+     * @param[in] id Member identifier.
+     * @return Pointer to the member, or nullptr if the structure has no member with that identifier.
+     */
+    Cdr_DllAPI const Member* find_member(
+            const Type& structure,
+            uint32_t id) const;
+
+    //! Returns the number of types in the description.
+    size_t size() const
+    {
+        return types_.size();
+    }
+
+    /*!
+     * @brief Returns whether a kind is primitive, which are the kinds encoded as arrays without DHEADER.
+     * @param[in] kind Kind to be checked.
+     * @return true if it is primitive.
+     */
+    static bool is_primitive(
+            TypeKind kind)
+    {
+        return TypeKind::FLOAT128 >= kind;
+    }
+
+    /*!
+     * @brief Returns the encoded size of a primitive kind.
+     * @param[in] kind Primitive kind.
+     * @return Size in bytes.
+     */
+    Cdr_DllAPI static size_t primitive_size(
+            TypeKind kind);
+
+    /*!
+     * @brief Returns whether an array has primitive elements, looking through nested arrays.
+     * @param[in] index Index of an array type.
+     * @return true if the innermost element type is primitive.
+     */
+    Cdr_DllAPI bool is_multi_array_primitive(
+            TypeIndex index) const;
+
+    /*!
+     * @brief Returns the encoding algorithm of structures with the given extensibility.
+     * @param[in] cdr_version CDR version.
+     * @param[in] extensibility Extensibility of the structure.
+     * @return Encoding algorithm, as written in the encapsulation.
+     */
+    Cdr_DllAPI static EncodingAlgorithmFlag encoding(
+            CdrVersion cdr_version,
+            Extensibility extensibility);
+
+private:
+
+    TypeIndex add(
+            const Type& type);
+
+    void check_index(
+            TypeIndex index) const;
+
+    std::vector<Type> types_;
+
+    std::vector<Member> members_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_TYPEDESCRIPTION_HPP_
@@ -0,0 +1,548 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_TYPEINTERPRETER_HPP_
+#define _FASTCDR_DYNAMIC_TYPEINTERPRETER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../Cdr.h"
+#include "../CdrSizeCalculator.hpp"
+#include "DynamicValue.hpp"
+#include "TypeDescription.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+/*!
+ * @brief This class encodes, decodes, skips and calculates the encoded size of values of types known only at runtime.
+ *
+ * The description is compiled once into a flat array of instructions, one per type, where the decisions which don't
+ * depend on the value are already taken: the encoding algorithm of each structure for both XCDR versions, whether a
+ * collection has a DHEADER, the native type of primitive elements and the number of elements of multidimensional
+ * arrays of primitives, which are handled as a single block. Members of mutable structures are looked up by identifier
+ * using a sorted table.
+ *
+ * Values are encoded through eprosima::fastcdr::Cdr and sized through eprosima::fastcdr::CdrSizeCalculator using the
+ * same rules as generated code, so the result is byte-exact with the encoding of the equivalent generated type.
+ */
+class TypeInterpreter
+{
+public:
+
+    /*!
+     * @brief Binds a value to the instruction of its type.
+     * Used to apply the member rules of eprosima::fastcdr::Cdr and eprosima::fastcdr::CdrSizeCalculator.
+     */
+    struct BoundValue
+    {
+        const TypeInterpreter* interpreter {nullptr};
+
+        uint32_t instruction {0};
+
+        const DynamicValue* value {nullptr};
+    };
+
+    /*!
+     * @brief Binds an encoded value, read from a decoder, to the instruction of its type.
+     * Used to apply the member rules of eprosima::fastcdr::Cdr and eprosima::fastcdr::CdrSizeCalculator while
+     * transcoding.
+     */
+    struct TranscodedValue
+    {
+        const TypeInterpreter* interpreter {nullptr};
+
+        uint32_t instruction {0};
+
+        Cdr* source {nullptr};
+    };
+
+    /*!
+     * @brief Compiles a description.
+     * @param[in] description Description of the data model. It is copied.
+     */
+    Cdr_DllAPI explicit TypeInterpreter(
+            const TypeDescription& description);
+
+    /*!
+     * @brief Returns the compiled description.
+     */
+    const TypeDescription& description() const
+    {
+        return description_;
+    }
+
+    /*!
+     * @brief Creates a value of a type holding its default value: zero primitives, empty strings, sequences and maps,
+     * arrays with all their elements, and structures with all their members, being the optional ones not present.
+     * @param[in] type Index of the type.
+     * @return The created value.
+     */
+    Cdr_DllAPI DynamicValue make_value(
+            TypeDescription::TypeIndex type) const;
+
+    /*!
+     * @brief Encodes a value.
+     * @param[inout] cdr Encoder.
+     * @param[in] type Index of the type of the value.
+     * @param[in] value Value to be encoded.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to encode into a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when the value doesn't match its type: wrong
+     * number of array elements or members, or a bound exceeded.
+     */
+    Cdr_DllAPI void serialize(
+            Cdr& cdr,
+            TypeDescription::TypeIndex type,
+            const DynamicValue& value) const;
+
+    /*!
+     * @brief Decodes a value.
+     * @param[inout] cdr Decoder.
+     * @param[in] type Index of the type of the value.
+     * @param[out] value Decoded value. Members not found in the buffer keep their default value.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when trying to decode from a buffer
+     * position that exceeds the internal memory size.
+     * @exception exception::BadParamException This exception is thrown when a bound is exceeded, a size doesn't match
+     * or the maximum nesting depth of the decoder is exceeded.
+     */
+    Cdr_DllAPI void deserialize(
+            Cdr& cdr,
+            TypeDescription::TypeIndex type,
+            DynamicValue& value) const;
+
+    /*!
+     * @brief Skips a value without decoding it. See eprosima::fastcdr::Cdr::skip.
+     * @param[inout] cdr Decoder.
+     * @param[in] type Index of the type of the value.
+     */
+    Cdr_DllAPI void skip(
+            Cdr& cdr,
+            TypeDescription::TypeIndex type) const;
+
+    /*!
+     * @brief Calculates the encoded size of a value.
+     * @param[inout] calculator Size calculator.
+     * @param[in] type Index of the type of the value.
+     * @param[in] value Value to be measured.
+     * @param[inout] current_alignment Current alignment in the encoding.
+     * @return Encoded size of the value.
+     * @exception exception::BadParamException This exception is thrown when the value doesn't match its type.
+     */
+    Cdr_DllAPI size_t calculate_serialized_size(
+            CdrSizeCalculator& calculator,
+            TypeDescription::TypeIndex type,
+            const DynamicValue& value,
+            size_t& current_alignment) const;
+
+    /*!
+     * @brief Transcodes an encoded value from a decoder to an encoder, which can use another CDR version, without
+     * decoding it into a value nor allocating memory.
+     *
+     * The value is re-encoded member by member with the rules of the encoder: alignment of 64 bits values, DHEADERs,
+     * member headers and sentinels. Members of mutable types not found in the description are dropped.
+     * @param[inout] source Decoder.
+     * @param[inout] destination Encoder.
+     * @param[in] type Index of the type of the value.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the source doesn't contain the
+     * whole value or the destination can't hold it.
+     * @exception exception::BadParamException This exception is thrown when the encoded value is not valid, or when
+     * it lacks members which the encoding of the destination requires.
+     */
+    Cdr_DllAPI void transcode(
+            Cdr& source,
+            Cdr& destination,
+            TypeDescription::TypeIndex type) const;
+
+    /*!
+     * @brief Calculates the encoded size of an encoded value once transcoded. See @ref transcode.
+     * @param[inout] source Decoder. The value is consumed.
+     * @param[inout] calculator Size calculator of the CDR version of the destination.
+     * @param[in] type Index of the type of the value.
+     * @param[inout] current_alignment Current alignment in the destination encoding.
+     * @return Encoded size of the transcoded value.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the source doesn't contain the
+     * whole value.
+     * @exception exception::BadParamException This exception is thrown when the encoded value is not valid.
+     */
+    Cdr_DllAPI size_t calculate_transcoded_size(
+            Cdr& source,
+            CdrSizeCalculator& calculator,
+            TypeDescription::TypeIndex type,
+            size_t& current_alignment) const;
+
+    /*!
+     * @brief Reads the encapsulation of a payload and checks it matches the extensibility of its type.
+     * @param[inout] cdr Decoder.
+     * @param[in] type Index of the type of the payload.
+     * @exception exception::BadParamException This exception is thrown when the encapsulation is not valid or doesn't
+     * match the type.
+     */
+    Cdr_DllAPI void read_encapsulation(
+            Cdr& cdr,
+            TypeDescription::TypeIndex type) const;
+
+    /*!
+     * @brief Compares two encoded values without decoding them nor allocating memory.
+     *
+     * The values are equal when a reader using this description would decode equal values: padding is ignored,
+     * members of mutable types can be encoded in any order, and members not found in the description are ignored.
+     * Both values can use different CDR versions and endianness. Primitives are compared by their encoded bytes, so
+     * floating point values are equal when their bit patterns are. Members missing at the end of an appendable type
+     * make the values differ.
+     * @param[inout] first Decoder of the first value.
+     * @param[inout] second Decoder of the second value.
+     * @param[in] type Index of the type of the values.
+     * @return Whether both values are equal. When they differ, the decoders are left inside the values.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when a decoder doesn't contain the whole
+     * value.
+     * @exception exception::BadParamException This exception is thrown when an encoded value is not valid.
+     */
+    Cdr_DllAPI bool equals(
+            Cdr& first,
+            Cdr& second,
+            TypeDescription::TypeIndex type) const;
+
+    /*!
+     * @brief Calculates the 64 bits hash of an encoded value without decoding it nor allocating memory.
+     *
+     * Values equal according to @ref equals have the same hash, whatever their CDR version and endianness. The hash is
+     * a FNV-1a hash of the primitives in little endianness and of the lengths, where the members of mutable types are
+     * hashed apart and combined independently of their order.
+     * @param[inout] cdr Decoder.
+     * @param[in] type Index of the type of the value.
+     * @return Hash of the value.
+     * @exception exception::NotEnoughMemoryException This exception is thrown when the decoder doesn't contain the
+     * whole value.
+     * @exception exception::BadParamException This exception is thrown when the encoded value is not valid.
+     */
+    Cdr_DllAPI uint64_t hash(
+            Cdr& cdr,
+            TypeDescription::TypeIndex type) const;
+
+    //! Encodes a bound value. Called through eprosima::fastcdr::serialize.
+    void serialize(
+            Cdr& cdr,
+            const BoundValue& bound) const;
+
+    //! Calculates the encoded size of a bound value. Called through eprosima::fastcdr::calculate_serialized_size.
+    size_t calculate_serialized_size(
+            CdrSizeCalculator& calculator,
+            const BoundValue& bound,
+            size_t& current_alignment) const;
+
+    //! Transcodes a bound encoded value. Called through eprosima::fastcdr::serialize.
+    void serialize(
+            Cdr& cdr,
+            const TranscodedValue& transcoded) const;
+
+    //! Sizes a bound encoded value once transcoded. Called through eprosima::fastcdr::calculate_serialized_size.
+    size_t calculate_serialized_size(
+            CdrSizeCalculator& calculator,
+            const TranscodedValue& transcoded,
+            size_t& current_alignment) const;
+
+private:
+
+    //! Walks encoded structures and collections with the same rules as decoding them.
+    friend class PayloadView;
+
+    enum class OpCode : uint8_t
+    {
+        PRIMITIVE,
+        //! Arrays of primitives, including multidimensional ones.
+        PRIMITIVE_ARRAY,
+        PRIMITIVE_SEQUENCE,
+        STRING8,
+        STRING16,
+        SEQUENCE,
+        ARRAY,
+        MAP,
+        STRUCTURE
+    };
+
+    struct Instruction
+    {
+        OpCode op {OpCode::PRIMITIVE};
+
+        //! Kind of the primitive, or of the primitive elements.
+        TypeKind kind {TypeKind::BOOLEAN};
+
+        //! Whether a DHEADER is encoded in XCDRv2.
+        bool dheader {false};
+
+        //! Encoding algorithm of structures in XCDRv1.
+        EncodingAlgorithmFlag xcdrv1_encoding {EncodingAlgorithmFlag::PLAIN_CDR};
+
+        //! Encoding algorithm of structures in XCDRv2.
+        EncodingAlgorithmFlag xcdrv2_encoding {EncodingAlgorithmFlag::PLAIN_CDR2};
+
+        //! Instruction of the elements, or of the values of maps.
+        uint32_t element {0};
+
+        //! Instruction of the keys of maps.
+        uint32_t key {0};
+
+        //! Bound of strings, sequences and maps, or number of elements of arrays.
+        uint32_t count {0};
+
+        //! Position of the first member of structures in members_ and member_ids_.
+        uint32_t first_member {0};
+
+        uint32_t member_count {0};
+    };
+
+    struct MemberInstruction
+    {
+        MemberId id;
+
+        uint32_t instruction {0};
+
+        bool optional {false};
+    };
+
+    EncodingAlgorithmFlag encoding(
+            const Instruction& instruction,
+            CdrVersion cdr_version) const
+    {
+        return CdrVersion::XCDRv2 == cdr_version ? instruction.xcdrv2_encoding : instruction.xcdrv1_encoding;
+    }
+
+    void serialize_value(
+            Cdr& cdr,
+            uint32_t instruction,
+            const DynamicValue& value) const;
+
+    void serialize_structure(
+            Cdr& cdr,
+            const Instruction& instruction,
+            const DynamicValue& value) const;
+
+    void deserialize_value(
+            Cdr& cdr,
+            uint32_t instruction,
+            DynamicValue& value) const;
+
+    void deserialize_structure(
+            Cdr& cdr,
+            const Instruction& instruction,
+            DynamicValue& value) const;
+
+    bool deserialize_member(
+            Cdr& cdr,
+            const MemberInstruction& member,
+            DynamicValue& value) const;
+
+    //! Decodes whether an optional member is present, decoding its member header in XCDRv1.
+    bool deserialize_presence(
+            Cdr& cdr,
+            uint32_t& member_size) const;
+
+    //! Skips the rest of an optional member encoded with a member header in XCDRv1.
+    void end_optional_member(
+            Cdr& cdr,
+            uint32_t member_size,
+            size_t value_begin) const;
+
+    void transcode_value(
+            Cdr& source,
+            Cdr& destination,
+            uint32_t instruction) const;
+
+    void transcode_structure(
+            Cdr& source,
+            Cdr& destination,
+            const Instruction& instruction) const;
+
+    void transcode_member(
+            Cdr& source,
+            Cdr& destination,
+            const MemberInstruction& member) const;
+
+    size_t calculate_transcoded_value_size(
+            Cdr& source,
+            CdrSizeCalculator& calculator,
+            uint32_t instruction,
+            size_t& current_alignment) const;
+
+    size_t calculate_transcoded_structure_size(
+            Cdr& source,
+            CdrSizeCalculator& calculator,
+            const Instruction& instruction,
+            size_t& current_alignment) const;
+
+    size_t calculate_transcoded_member_size(
+            Cdr& source,
+            CdrSizeCalculator& calculator,
+            const MemberInstruction& member,
+            size_t& current_alignment) const;
+
+    //! Decodes the length of a sequence, map or string, checking its bound and that the buffer can hold it.
+    bool deserialize_length(
+            Cdr& cdr,
+            const Instruction& instruction,
+            uint32_t& length) const;
+
+    //! Decodes the DHEADER, if any, and the length of a sequence, array or map.
+    bool begin_collection(
+            Cdr& cdr,
+            const Instruction& instruction,
+            uint32_t& dheader,
+            size_t& elements_begin,
+            uint32_t& length) const;
+
+    //! Checks the DHEADER, if any, of a sequence, array or map after decoding its elements.
+    bool end_collection(
+            Cdr& cdr,
+            const Instruction& instruction,
+            uint32_t dheader,
+            size_t elements_begin) const;
+
+    //! Members of a structure decoded without Cdr::deserialize_type.
+    struct StructureState
+    {
+        explicit StructureState(
+                Cdr& cdr)
+            : members(cdr)
+            , members_begin(cdr.get_serialized_data_length())
+        {
+        }
+
+        //! State of the decoder at the first member.
+        Cdr::state members;
+
+        //! Position of the first member.
+        size_t members_begin;
+
+        //! Encoding algorithm of the enclosing type, set back when the structure ends.
+        EncodingAlgorithmFlag previous_encoding {EncodingAlgorithmFlag::PLAIN_CDR2};
+    };
+
+    //! Decodes the DHEADER of a structure, if any, and starts decoding its members, returning the state before them.
+    StructureState begin_structure(
+            Cdr& cdr,
+            const Instruction& instruction,
+            uint32_t& dheader) const;
+
+    //! Skips the remaining members of a structure and ends decoding it.
+    void end_structure(
+            Cdr& cdr,
+            const StructureState& members_state,
+            uint32_t dheader) const;
+
+    //! Whether a member of an appendable or final structure remains to be decoded.
+    bool has_next_member(
+            const Cdr& cdr,
+            const StructureState& members_state,
+            uint32_t dheader) const;
+
+    //! Decodes the next member header of a mutable structure, returning false after the last member.
+    bool next_member_header(
+            Cdr& cdr,
+            const StructureState& members_state,
+            uint32_t dheader,
+            MemberId& member_id,
+            uint32_t& member_size) const;
+
+    //! Skips the rest of a member value delimited by its member header.
+    bool end_member_value(
+            Cdr& cdr,
+            uint32_t member_size,
+            size_t value_begin) const;
+
+    //! Positions the decoder at the value of a member of a mutable structure, returning false if not found.
+    bool find_encoded_member(
+            Cdr& cdr,
+            const StructureState& members_state,
+            uint32_t dheader,
+            uint32_t id,
+            uint32_t& member_size) const;
+
+    bool equal_primitives(
+            Cdr& first,
+            Cdr& second,
+            TypeKind kind,
+            size_t num_elements) const;
+
+    bool equal_value(
+            Cdr& first,
+            Cdr& second,
+            uint32_t instruction) const;
+
+    bool equal_structure(
+            Cdr& first,
+            Cdr& second,
+            const Instruction& instruction) const;
+
+    bool equal_member(
+            Cdr& first,
+            Cdr& second,
+            const MemberInstruction& member) const;
+
+    void hash_primitives(
+            Cdr& cdr,
+            TypeKind kind,
+            size_t num_elements,
+            uint64_t& hash) const;
+
+    void hash_value(
+            Cdr& cdr,
+            uint32_t instruction,
+            uint64_t& hash) const;
+
+    void hash_structure(
+            Cdr& cdr,
+            const Instruction& instruction,
+            uint64_t& hash) const;
+
+    //! Returns the member of a structure found while decoding it, or nullptr if unknown.
+    const MemberInstruction* decoded_member(
+            const Instruction& instruction,
+            const MemberId& member_id,
+            bool by_id) const;
+
+    size_t calculate_value_size(
+            CdrSizeCalculator& calculator,
+            uint32_t instruction,
+            const DynamicValue& value,
+            size_t& current_alignment) const;
+
+    size_t calculate_structure_size(
+            CdrSizeCalculator& calculator,
+            const Instruction& instruction,
+            const DynamicValue& value,
+            size_t& current_alignment) const;
+
+    const MemberInstruction* find_member(
+            const Instruction& instruction,
+            uint32_t id) const;
+
+    TypeDescription description_;
+
+    //! One instruction per type, at the index of the type.
+    std::vector<Instruction> instructions_;
+
+    std::vector<MemberInstruction> members_;
+
+    //! Pairs of member identifier and position, sorted by identifier, for each structure.
+    std::vector<std::pair<uint32_t, uint32_t>> member_ids_;
+};
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_TYPEINTERPRETER_HPP_
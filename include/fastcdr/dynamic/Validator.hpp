@@ -0,0 +1,61 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef _FASTCDR_DYNAMIC_VALIDATOR_HPP_
+#define _FASTCDR_DYNAMIC_VALIDATOR_HPP_
+
+#include <cstddef>
+
+#include "../Cdr.h"
+#include "TypeDescription.hpp"
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Result of validating a serialized payload.
+struct ValidationResult
+{
+    //! Cdr::CDR_ERROR_NONE if the payload is valid.
+    Cdr::ErrorCode error {Cdr::CDR_ERROR_NONE};
+
+    //! Number of bytes consumed by the payload if valid, or position where the error was found.
+    size_t length {0};
+
+    //! Message describing the error, or empty if valid.
+    const char* message {""};
+};
+
+/*!
+ * @brief Validates a serialized payload, starting with its encapsulation, using a runtime description of its type.
+ *
+ * Nothing is decoded, allocated nor thrown. The encapsulation has to match the extensibility of the type when it is a
+ * structure. See eprosima::fastcdr::Cdr::skip for the performed checks.
+ * @param[in] buffer Serialized payload. It is not modified.
+ * @param[in] size Size of the buffer.
+ * @param[in] description Description of the data model.
+ * @param[in] type Index of the type of the payload.
+ * @param[in] max_nesting_depth Maximum number of nested values. Deeper payloads are not valid.
+ * @return Result of the validation.
+ */
+Cdr_DllAPI ValidationResult validate(
+        const char* buffer,
+        size_t size,
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type,
+        uint32_t max_nesting_depth = Cdr::DEFAULT_MAX_NESTING_DEPTH);
+
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _FASTCDR_DYNAMIC_VALIDATOR_HPP_
@@ -72,8 +72,8 @@ public:
     {
         if (locked_)
         {
-            throw exception::LockedExternalAccessException(
-                      exception::LockedExternalAccessException::LOCKED_EXTERNAL_ACCESS_MESSAGE_DEFAULT);
+            FASTCDR_THROW(exception::LockedExternalAccessException(
+                      exception::LockedExternalAccessException::LOCKED_EXTERNAL_ACCESS_MESSAGE_DEFAULT));
         }
 
         if (!other.pointer_)
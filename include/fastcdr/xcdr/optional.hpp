@@ -141,8 +141,8 @@ public:
     {
         if (!storage_.engaged_)
         {
-            throw exception::BadOptionalAccessException(
-                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT);
+            FASTCDR_THROW(exception::BadOptionalAccessException(
+                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT));
         }
 
         return storage_.val_;
@@ -158,8 +158,8 @@ public:
     {
         if (!storage_.engaged_)
         {
-            throw exception::BadOptionalAccessException(
-                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT);
+            FASTCDR_THROW(exception::BadOptionalAccessException(
+                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT));
         }
 
         return storage_.val_;
@@ -175,8 +175,8 @@ public:
     {
         if (!storage_.engaged_)
         {
-            throw exception::BadOptionalAccessException(
-                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT);
+            FASTCDR_THROW(exception::BadOptionalAccessException(
+                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT));
         }
 
         return std::move(storage_.val_);
@@ -192,8 +192,8 @@ public:
     {
         if (!storage_.engaged_)
         {
-            throw exception::BadOptionalAccessException(
-                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT);
+            FASTCDR_THROW(exception::BadOptionalAccessException(
+                      exception::BadOptionalAccessException::BAD_OPTIONAL_ACCESS_MESSAGE_DEFAULT));
         }
 
         return std::move(storage_.val_);
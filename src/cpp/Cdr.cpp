@@ -13,8 +13,17 @@
 // limitations under the License.
 
 #include <cstring>
+#include <cwchar>
 #include <limits>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FASTCDR_SSE2 1
+#if WCHAR_MAX > 0xFFFF
+#define FASTCDR_SSE2_WIDE_CHARS 1
+#endif // if WCHAR_MAX > 0xFFFF
+#endif // if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
 #include <fastcdr/Cdr.h>
 
 namespace eprosima {
@@ -28,6 +37,8 @@ const Cdr::Endianness Cdr::DEFAULT_ENDIAN = BIG_ENDIANNESS;
 const Cdr::Endianness Cdr::DEFAULT_ENDIAN = LITTLE_ENDIANNESS;
 #endif // if FASTCDR_IS_BIG_ENDIAN_TARGET
 
+const uint32_t Cdr::DEFAULT_MAX_NESTING_DEPTH = 100;
+
 constexpr uint16_t PID_EXTENDED = 0x3F01;
 constexpr uint16_t PID_EXTENDED_LENGTH = 0x8;
 constexpr uint16_t PID_SENTINEL = 0x3F02;
@@ -47,6 +58,226 @@ inline size_t alignment_on_state(
     return (data_size - ((offset - origin) % data_size)) & (data_size - 1);
 }
 
+#if FASTCDR_SSE2
+inline __m128i swap_bytes_16(
+        __m128i value)
+{
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+
+inline __m128i swap_bytes_32(
+        __m128i value)
+{
+    // Swap the bytes of each 16 bits word, then the words of each 32 bits element.
+    value = swap_bytes_16(value);
+    value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+inline __m128i swap_bytes_64(
+        __m128i value)
+{
+    // Swap the bytes of each 16 bits word, then reverse the words of each 64 bits element.
+    value = swap_bytes_16(value);
+    value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+    return _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+#endif // if FASTCDR_SSE2
+
+/*!
+ * @brief Narrows wide-chars to the 2-byte characters of the wire, swapping their bytes if requested.
+ * As the previous per-character encoding did, only the lower 16 bits of each wide-char are kept.
+ */
+inline void narrow_wide_chars(
+        const wchar_t* wchar,
+        size_t num_elements,
+        char* dst,
+        bool swap)
+{
+    size_t count {0};
+#if FASTCDR_SSE2_WIDE_CHARS
+    for (; count + 8 <= num_elements; count += 8)
+    {
+        // Sign-extend the lower 16 bits, so the saturating pack keeps them unchanged.
+        __m128i low {_mm_loadu_si128(reinterpret_cast<const __m128i*>(wchar + count))};
+        __m128i high {_mm_loadu_si128(reinterpret_cast<const __m128i*>(wchar + count + 4))};
+        low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+        high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+        __m128i packed {_mm_packs_epi32(low, high)};
+        if (swap)
+        {
+            packed = swap_bytes_16(packed);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count * 2), packed);
+    }
+#endif // if FASTCDR_SSE2_WIDE_CHARS
+    for (; count < num_elements; ++count)
+    {
+        uint16_t value {static_cast<uint16_t>(wchar[count])};
+        if (swap)
+        {
+            value = static_cast<uint16_t>((value << 8) | (value >> 8));
+        }
+        memcpy(dst + count * 2, &value, sizeof(value));
+    }
+}
+
+/*!
+ * @brief Widens the 2-byte characters of the wire to wide-chars, swapping their bytes if requested.
+ */
+inline void widen_wide_chars(
+        const char* src,
+        size_t num_elements,
+        wchar_t* wchar,
+        bool swap)
+{
+    size_t count {0};
+#if FASTCDR_SSE2_WIDE_CHARS
+    const __m128i zero {_mm_setzero_si128()};
+    for (; count + 8 <= num_elements; count += 8)
+    {
+        __m128i value {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count * 2))};
+        if (swap)
+        {
+            value = swap_bytes_16(value);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(wchar + count), _mm_unpacklo_epi16(value, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(wchar + count + 4), _mm_unpackhi_epi16(value, zero));
+    }
+#endif // if FASTCDR_SSE2_WIDE_CHARS
+    for (; count < num_elements; ++count)
+    {
+        uint16_t value {0};
+        memcpy(&value, src + count * 2, sizeof(value));
+        if (swap)
+        {
+            value = static_cast<uint16_t>((value << 8) | (value >> 8));
+        }
+        wchar[count] = static_cast<wchar_t>(value);
+    }
+}
+
+/*!
+ * @brief Copies elements of the given width, reversing the order of the bytes of each element.
+ * The source and the destination can be the same, to swap the elements in place. Elements of 2, 4 and 8 bytes are
+ * swapped 16 bytes at once when SSE2 is available.
+ */
+inline void copy_swapped(
+        char* dst,
+        const char* src,
+        size_t width,
+        size_t num_elements)
+{
+    size_t count {0};
+#if FASTCDR_SSE2
+    if (2 == width || 4 == width || 8 == width)
+    {
+        const size_t per_vector {16 / width};
+        for (; count + per_vector <= num_elements; count += per_vector)
+        {
+            __m128i value {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count * width))};
+            value = 2 == width ? swap_bytes_16(value) : (4 == width ? swap_bytes_32(value) : swap_bytes_64(value));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count * width), value);
+        }
+    }
+#endif // if FASTCDR_SSE2
+    for (; count < num_elements; ++count)
+    {
+        char element[16];
+        memcpy(element, src + count * width, width);
+        for (size_t byte {0}; byte < width; ++byte)
+        {
+            dst[count * width + byte] = element[width - 1 - byte];
+        }
+    }
+}
+
+/*!
+ * @brief Checks that all the bytes are encoded booleans, that is 0 or 1.
+ * Eight bytes are checked at once.
+ */
+inline bool are_encoded_bools(
+        const char* src,
+        size_t size)
+{
+    uint64_t bits {0};
+    size_t count {0};
+    for (; count + sizeof(uint64_t) <= size; count += sizeof(uint64_t))
+    {
+        uint64_t bytes {0};
+        memcpy(&bytes, src + count, sizeof(bytes));
+        bits |= bytes;
+    }
+    for (; count < size; ++count)
+    {
+        bits |= static_cast<uint8_t>(src[count]);
+    }
+    return 0 == (bits & 0xFEFEFEFEFEFEFEFEull);
+}
+
+/*!
+ * @brief Encodes the booleans of a std::vector<bool> as one byte per boolean.
+ */
+inline void unpack_bools(
+        const std::vector<bool>& vector_t,
+        char* dst)
+{
+    size_t count {0};
+    for (std::vector<bool>::const_iterator it {vector_t.begin()}; it != vector_t.end(); ++it, ++count)
+    {
+        dst[count] = *it ? 1 : 0;
+    }
+}
+
+/*!
+ * @brief Decodes bytes previously checked with are_encoded_bools() into a std::vector<bool>.
+ */
+inline void pack_bools(
+        const char* src,
+        std::vector<bool>& vector_t)
+{
+    size_t count {0};
+    for (std::vector<bool>::iterator it {vector_t.begin()}; it != vector_t.end(); ++it, ++count)
+    {
+        *it = (1 == src[count]);
+    }
+}
+
+//! Returns whether the values of a type are always encoded in zero bytes, as empty final structures are.
+inline bool is_encoded_in_zero_bytes(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex index,
+        CdrVersion cdr_version)
+{
+    const TypeDescription::Type& type = description.type(index);
+
+    if (TypeKind::ARRAY == type.kind)
+    {
+        // Arrays of non-primitives have a DHEADER in XCDRv2.
+        return CdrVersion::XCDRv2 != cdr_version && is_encoded_in_zero_bytes(description, type.element, cdr_version);
+    }
+
+    if (TypeKind::STRUCTURE != type.kind ||
+            (CdrVersion::XCDRv2 == cdr_version ? Extensibility::FINAL != type.extensibility :
+            Extensibility::MUTABLE == type.extensibility))
+    {
+        return false;
+    }
+
+    for (uint32_t position {0}; position < type.member_count; ++position)
+    {
+        const TypeDescription::Member& member = description.member(type, position);
+
+        if (member.optional || !is_encoded_in_zero_bytes(description, member.type, cdr_version))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 inline uint32_t Cdr::get_long_lc(
         SerializedMemberSizeForNextInt serialized_member_size)
 {
@@ -201,7 +432,7 @@ Cdr& Cdr::read_encapsulation()
     uint8_t encapsulation {0};
     state state_before_error(*this);
 
-    try
+    FASTCDR_TRY
     {
         // If it is DDS_CDR, the first step is to get the dummy byte.
         if (CdrVersion::CORBA_CDR < cdr_version_)
@@ -209,7 +440,8 @@ Cdr& Cdr::read_encapsulation()
             (*this) >> dummy;
             if (0 != dummy)
             {
-                throw BadParamException("Unexpected non-zero initial byte received in Cdr::read_encapsulation");
+                set_state(state_before_error);
+                return report_error(CDR_ERROR_BAD_PARAM, "Unexpected non-zero initial byte received in Cdr::read_encapsulation");
             }
         }
 
@@ -239,7 +471,8 @@ Cdr& Cdr::read_encapsulation()
                 }
                 else
                 {
-                    throw BadParamException(
+                    set_state(state_before_error);
+                    return report_error(CDR_ERROR_BAD_PARAM,
                               "Unexpected encoding algorithm received in Cdr::read_encapsulation. XCDRv2 should be selected.");
                 }
                 break;
@@ -251,7 +484,8 @@ Cdr& Cdr::read_encapsulation()
                 }
                 else
                 {
-                    throw BadParamException(
+                    set_state(state_before_error);
+                    return report_error(CDR_ERROR_BAD_PARAM,
                               "Unexpected encoding algorithm received in Cdr::read_encapsulation. XCDRv1 should be selected");
                 }
                 break;
@@ -263,7 +497,8 @@ Cdr& Cdr::read_encapsulation()
                 }
                 break;
             default:
-                throw BadParamException("Unexpected encoding algorithm received in Cdr::read_encapsulation for DDS CDR");
+                set_state(state_before_error);
+                return report_error(CDR_ERROR_BAD_PARAM, "Unexpected encoding algorithm received in Cdr::read_encapsulation for DDS CDR");
         }
         reset_callbacks();
 
@@ -289,10 +524,10 @@ Cdr& Cdr::read_encapsulation()
         }
 
     }
-    catch (Exception& ex)
+    FASTCDR_CATCH(Exception&)
     {
         set_state(state_before_error);
-        ex.raise();
+        FASTCDR_RETHROW;
     }
 
     reset_alignment();
@@ -305,7 +540,7 @@ Cdr& Cdr::serialize_encapsulation()
     uint8_t encapsulation = 0;
     state state_before_error(*this);
 
-    try
+    FASTCDR_TRY
     {
         // If it is DDS_CDR, the first step is to serialize the dummy byte.
         if (CdrVersion::CORBA_CDR < cdr_version_)
@@ -321,23 +556,23 @@ Cdr& Cdr::serialize_encapsulation()
 
         current_encoding_ = encoding_flag_;
     }
-    catch (Exception& ex)
+    FASTCDR_CATCH(Exception&)
     {
         set_state(state_before_error);
-        ex.raise();
+        FASTCDR_RETHROW;
     }
 
-    try
+    FASTCDR_TRY
     {
         if (CdrVersion::CORBA_CDR < cdr_version_)
         {
             serialize(options_);
         }
     }
-    catch (Exception& ex)
+    FASTCDR_CATCH(Exception&)
     {
         set_state(state_before_error);
-        ex.raise();
+        FASTCDR_RETHROW;
     }
 
     reset_alignment();
@@ -372,6 +607,17 @@ bool Cdr::set_encoding_flag(
     return ret_value;
 }
 
+EncodingAlgorithmFlag Cdr::get_current_encoding_flag() const
+{
+    return current_encoding_;
+}
+
+void Cdr::set_current_encoding_flag(
+        EncodingAlgorithmFlag encoding_flag)
+{
+    current_encoding_ = encoding_flag;
+}
+
 std::array<uint8_t, 2> Cdr::get_dds_cdr_options() const
 {
     return options_;
@@ -447,6 +693,11 @@ size_t Cdr::get_serialized_data_length() const
     return offset_ - cdr_buffer_.begin();
 }
 
+size_t Cdr::get_remaining_length() const
+{
+    return end_ - offset_;
+}
+
 Cdr::state Cdr::get_state() const
 {
     return Cdr::state(*this);
@@ -473,6 +724,10 @@ void Cdr::reset()
     current_encoding_ = encoding_flag_;
     next_member_id_ = MEMBER_ID_INVALID;
     options_ = {0, 0};
+    checksum_position_ = 0;
+    compressor_position_ = 0;
+    patched_regions_ = 0;
+    clear_error();
 }
 
 bool Cdr::move_alignment_forward(
@@ -490,6 +745,159 @@ bool Cdr::move_alignment_forward(
     return ret_value;
 }
 
+void Cdr::set_error_mode(
+        ErrorMode error_mode)
+{
+    error_mode_ = error_mode;
+}
+
+Cdr::ErrorMode Cdr::get_error_mode() const
+{
+    return error_mode_;
+}
+
+Cdr::ErrorCode Cdr::get_error() const
+{
+    return error_;
+}
+
+const char* Cdr::get_error_message() const
+{
+    return nullptr != error_message_ ? error_message_ : "";
+}
+
+void Cdr::clear_error()
+{
+    error_ = ErrorCode::CDR_ERROR_NONE;
+    error_message_ = nullptr;
+}
+
+void Cdr::set_max_nesting_depth(
+        uint32_t max_nesting_depth)
+{
+    max_nesting_depth_ = max_nesting_depth;
+}
+
+uint32_t Cdr::get_max_nesting_depth() const
+{
+    return max_nesting_depth_;
+}
+
+void Cdr::set_checksum(
+        Crc32c* checksum)
+{
+    checksum_ = checksum;
+    checksum_position_ = offset_ - cdr_buffer_.begin();
+    patched_regions_ = 0;
+}
+
+uint32_t Cdr::get_checksum()
+{
+    if (nullptr == checksum_)
+    {
+        return 0;
+    }
+
+    update_stable_bytes();
+    return checksum_->value();
+}
+
+void Cdr::set_compressor(
+        PayloadCompressor* compressor)
+{
+    compressor_ = compressor;
+    compressor_position_ = offset_ - cdr_buffer_.begin();
+    patched_regions_ = 0;
+}
+
+size_t Cdr::end_compression()
+{
+    if (nullptr == compressor_)
+    {
+        return 0;
+    }
+
+    if (!encapsulation_serialized_)
+    {
+        report_error(ErrorCode::CDR_ERROR_BAD_PARAM, "The payload has no encapsulation");
+        return 0;
+    }
+
+    update_stable_bytes();
+    PayloadCompressor* compressor {compressor_};
+    compressor_ = nullptr;
+    return compressor->finish(cdr_buffer_.getBuffer());
+}
+
+void Cdr::update_stable_bytes()
+{
+    if (nullptr == checksum_ && nullptr == compressor_)
+    {
+        return;
+    }
+
+    const size_t stable_position {0 < patched_regions_ ? patched_region_begin_ :
+                                  offset_ - cdr_buffer_.begin()};
+
+    if (nullptr != checksum_ && stable_position > checksum_position_)
+    {
+        checksum_->update(cdr_buffer_.getBuffer() + checksum_position_, stable_position - checksum_position_);
+        checksum_position_ = stable_position;
+    }
+
+    if (nullptr != compressor_ && stable_position > compressor_position_)
+    {
+        compressor_->update(cdr_buffer_.getBuffer() + compressor_position_, stable_position - compressor_position_);
+        compressor_position_ = stable_position;
+    }
+}
+
+void Cdr::begin_patched_region()
+{
+    if ((nullptr != checksum_ || nullptr != compressor_) && 0 == patched_regions_++)
+    {
+        patched_region_begin_ = offset_ - cdr_buffer_.begin();
+    }
+}
+
+void Cdr::end_patched_region()
+{
+    if ((nullptr != checksum_ || nullptr != compressor_) && 0 < patched_regions_ && 0 == --patched_regions_)
+    {
+        update_stable_bytes();
+    }
+}
+
+Cdr& Cdr::report_error(
+        ErrorCode error,
+        const char* message)
+{
+    if (nullptr == message)
+    {
+        message = ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY == error ?
+                NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT :
+                BadParamException::BAD_PARAM_MESSAGE_DEFAULT;
+    }
+
+    if (ErrorMode::THROW_EXCEPTIONS == error_mode_)
+    {
+        if (ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY == error)
+        {
+            FASTCDR_THROW(NotEnoughMemoryException(message));
+        }
+
+        FASTCDR_THROW(BadParamException(message));
+    }
+
+    if (ErrorCode::CDR_ERROR_NONE == error_)
+    {
+        error_ = error;
+        error_message_ = message;
+    }
+
+    return *this;
+}
+
 bool Cdr::resize(
         size_t min_size_inc)
 {
@@ -522,7 +930,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -565,7 +973,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -604,7 +1012,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -653,7 +1061,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -686,7 +1094,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -723,7 +1131,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -810,7 +1218,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -833,7 +1241,7 @@ Cdr& Cdr::serialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize(
@@ -845,35 +1253,54 @@ Cdr& Cdr::serialize(
 Cdr& Cdr::serialize(
         const char* string_t)
 {
-    uint32_t length = 0;
+    if (string_t == nullptr)
+    {
+        serialize(uint32_t(0));
+        serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+        return *this;
+    }
 
-    if (string_t != nullptr)
+    return serialize_string(string_t, strlen(string_t), false);
+}
+
+Cdr& Cdr::serialize_string(
+        const char* string_t,
+        size_t length,
+        bool check_null_characters)
+{
+    // The encoded length includes the null terminator.
+    if (std::numeric_limits<uint32_t>::max() <= length)
     {
-        length = size_to_uint32(strlen(string_t)) + 1;
+        return report_error(CDR_ERROR_BAD_PARAM, "The string is too long to be encoded");
     }
 
-    if (length > 0)
+    // memchr is vectorized by the C library, so the check reads the characters much faster than copying them.
+    if (check_null_characters && 0 < length && nullptr != memchr(string_t, '\0', length))
     {
-        Cdr::state state_before_error(*this);
-        serialize(length);
+        return report_error(CDR_ERROR_BAD_PARAM, "The string contains null characters");
+    }
 
-        if (((end_ - offset_) >= length) || resize(length))
-        {
-            // Save last datasize.
-            last_data_size_ = sizeof(uint8_t);
+    const uint32_t encoded_length {size_to_uint32(length) + 1};
+    Cdr::state state_before_error(*this);
+    serialize(encoded_length);
+
+    if (((end_ - offset_) >= encoded_length) || resize(encoded_length))
+    {
+        // Save last datasize.
+        last_data_size_ = sizeof(uint8_t);
 
+        if (0 < length)
+        {
             offset_.memcopy(string_t, length);
             offset_ += length;
         }
-        else
-        {
-            set_state(state_before_error);
-            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
-        }
+        *(&offset_) = '\0';
+        offset_ += 1;
     }
     else
     {
-        serialize(length);
+        set_state(state_before_error);
+        return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
     }
 
     serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
@@ -905,7 +1332,7 @@ Cdr& Cdr::serialize(
         else
         {
             set_state(state_);
-            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
         }
     }
     else
@@ -927,21 +1354,18 @@ Cdr& Cdr::serialize_array(
         // Save last datasize.
         last_data_size_ = sizeof(*bool_t);
 
-        for (size_t count = 0; count < num_elements; ++count)
+        // A bool is stored as a byte holding 0 or 1, which is its encoding.
+        static_assert(1 == sizeof(bool), "bool is expected to be stored in one byte");
+        if (0 < total_size)
         {
-            uint8_t value = 0;
-
-            if (bool_t[count])
-            {
-                value = 1;
-            }
-            offset_++ << value;
+            offset_.memcopy(bool_t, total_size);
+            offset_ += total_size;
         }
 
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -960,7 +1384,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1002,7 +1426,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1046,7 +1470,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1058,11 +1482,23 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    for (size_t count = 0; count < num_elements; ++count)
+    size_t align = alignment(sizeof(uint16_t));
+    size_t total_size = sizeof(uint16_t) * num_elements;
+    size_t size_aligned = total_size + align;
+
+    if (((end_ - offset_) >= size_aligned) || resize(size_aligned))
     {
-        serialize(wchar[count]);
+        // Align and save last datasize.
+        make_alignment(align);
+        last_data_size_ = sizeof(uint16_t);
+
+        narrow_wide_chars(wchar, num_elements, &offset_, swap_bytes_);
+        offset_ += total_size;
+
+        return *this;
     }
-    return *this;
+
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1110,7 +1546,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1154,7 +1590,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1202,7 +1638,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::serialize_array(
@@ -1320,7 +1756,7 @@ Cdr& Cdr::serialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1335,7 +1771,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1366,7 +1802,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1399,7 +1835,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1436,7 +1872,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1469,7 +1905,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1506,7 +1942,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1586,7 +2022,7 @@ Cdr& Cdr::deserialize(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1612,10 +2048,10 @@ Cdr& Cdr::deserialize(
             return *this;
         }
 
-        throw BadParamException("Unexpected byte value in Cdr::deserialize(bool), expected 0 or 1");
+        return report_error(CDR_ERROR_BAD_PARAM, "Unexpected byte value in Cdr::deserialize(bool), expected 0 or 1");
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1646,7 +2082,7 @@ Cdr& Cdr::deserialize(
     }
 
     set_state(state_before_error);
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize(
@@ -1675,7 +2111,7 @@ Cdr& Cdr::deserialize(
     }
 
     set_state(state_before_error);
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 const char* Cdr::read_string(
@@ -1705,8 +2141,9 @@ const char* Cdr::read_string(
     }
 
     set_state(state_before_error);
-    throw exception::NotEnoughMemoryException(
-              exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+    length = 0;
+    return "";
 }
 
 const std::wstring Cdr::read_wstring(
@@ -1727,19 +2164,23 @@ const std::wstring Cdr::read_wstring(
         // Save last datasize.
         last_data_size_ = sizeof(uint16_t);
 
-        ret_value.resize(length);
-        deserialize_array(const_cast<wchar_t*>(ret_value.c_str()), length);
-        if (ret_value[length - 1] == L'\0')
+        // Don't decode the terminating zero some implementations send.
+        const char* last_char {&offset_ + bytes_length - sizeof(uint16_t)};
+        if (0 == last_char[0] && 0 == last_char[1])
         {
             --length;
-            ret_value.erase(length);
         }
+
+        ret_value.resize(length);
+        widen_wide_chars(&offset_, length, &ret_value[0], swap_bytes_);
+        offset_ += bytes_length;
         return ret_value;
     }
 
     set_state(state_);
-    throw exception::NotEnoughMemoryException(
-              exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+    length = 0;
+    return L"";
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1753,25 +2194,37 @@ Cdr& Cdr::deserialize_array(
         // Save last datasize.
         last_data_size_ = sizeof(*bool_t);
 
-        for (size_t count = 0; count < num_elements; ++count)
+        if (are_encoded_bools(&offset_, total_size))
         {
-            uint8_t value = 0;
-            offset_++ >> value;
-
-            if (value == 1)
+            if (0 < total_size)
             {
-                bool_t[count] = true;
+                offset_.rmemcopy(bool_t, total_size);
+                offset_ += total_size;
             }
-            else if (value == 0)
+        }
+        else
+        {
+            // Elements with an unexpected value are left unchanged.
+            for (size_t count = 0; count < num_elements; ++count)
             {
-                bool_t[count] = false;
+                uint8_t value = 0;
+                offset_++ >> value;
+
+                if (value == 1)
+                {
+                    bool_t[count] = true;
+                }
+                else if (value == 0)
+                {
+                    bool_t[count] = false;
+                }
             }
         }
 
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1790,7 +2243,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1832,7 +2285,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1876,7 +2329,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1888,13 +2341,23 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    uint16_t value;
-    for (size_t count = 0; count < num_elements; ++count)
+    size_t align = alignment(sizeof(uint16_t));
+    size_t total_size = sizeof(uint16_t) * num_elements;
+    size_t size_aligned = total_size + align;
+
+    if ((end_ - offset_) >= size_aligned)
     {
-        deserialize(value);
-        wchar[count] = static_cast<wchar_t>(value);
+        // Align and save last datasize.
+        make_alignment(align);
+        last_data_size_ = sizeof(uint16_t);
+
+        widen_wide_chars(&offset_, num_elements, wchar, swap_bytes_);
+        offset_ += total_size;
+
+        return *this;
     }
-    return *this;
+
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1942,7 +2405,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -1986,7 +2449,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -2034,7 +2497,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::deserialize_array(
@@ -2144,7 +2607,7 @@ Cdr& Cdr::deserialize_array(
         return *this;
     }
 
-    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
 }
 
 Cdr& Cdr::begin_serialize_type(
@@ -2157,56 +2620,213 @@ Cdr& Cdr::begin_serialize_type(
 Cdr& Cdr::end_serialize_type(
         Cdr::state& current_state)
 {
-    return (this->*end_serialize_type_)(current_state);
+    (this->*end_serialize_type_)(current_state);
+    update_stable_bytes();
+    return *this;
 }
 
 Cdr& Cdr::deserialize_type(
         EncodingAlgorithmFlag type_encoding,
         std::function<bool (Cdr&, const MemberId&)> functor)
 {
-    return (this->*deserialize_type_)(type_encoding, functor);
-}
-
-Cdr& Cdr::operator <<(
-        const MemberId& member_id)
-{
-    if (next_member_id_ != MEMBER_ID_INVALID)
-    {
-        throw exception::BadParamException("Member id already set and not encoded");
-    }
-
-    next_member_id_ = member_id;
+    (this->*deserialize_type_)(type_encoding, functor);
+    update_stable_bytes();
     return *this;
 }
 
-Cdr& Cdr::serialize_bool_array(
-        const std::vector<bool>& vector_t)
+Cdr& Cdr::deserialize_type(
+        EncodingAlgorithmFlag type_encoding,
+        const std::vector<uint32_t>& member_ids,
+        std::function<bool (Cdr&, const MemberId&)> functor)
 {
-    state state_before_error(*this);
+    size_t pending_members {member_ids.size()};
+    auto is_selected = [&member_ids](const MemberId& member_id) -> bool
+            {
+                return member_ids.end() != std::find(member_ids.begin(), member_ids.end(), member_id.id);
+            };
+    // Decodes the member whose header was just read when it is selected, and skips what was not decoded of it.
+    auto decode_member = [&](const Cdr::state& current_state) -> bool
+            {
+                const auto offset = offset_;
 
-    size_t total_size = vector_t.size() * sizeof(bool);
+                if (0 < pending_members && is_selected(next_member_id_))
+                {
+                    --pending_members;
 
-    if (((end_ - offset_) >= total_size) || resize(total_size))
+                    if (functor(*this, next_member_id_))
+                    {
+                        if (current_state.member_size_ != offset_ - offset)
+                        {
+                            report_error(CDR_ERROR_BAD_PARAM,
+                                    "Member size provided by member header is not equal to the real decoded size");
+                            return false;
+                        }
+                    }
+                    else if (next_member_id_.must_understand)
+                    {
+                        report_error(CDR_ERROR_BAD_PARAM, "Cannot deserialize a member with flag must_understand");
+                        return false;
+                    }
+                }
+
+                if (current_state.member_size_ < offset_ - offset)
+                {
+                    report_error(CDR_ERROR_BAD_PARAM,
+                            "Member size provided by member header is lower than real decoded member size");
+                    return false;
+                }
+                else if (!jump(current_state.member_size_ - (offset_ - offset)))
+                {
+                    report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                    return false;
+                }
+
+                return true;
+            };
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == type_encoding || EncodingAlgorithmFlag::DELIMIT_CDR2 == type_encoding)
     {
-        // Save last datasize.
-        last_data_size_ = sizeof(bool);
+        assert(CdrVersion::XCDRv2 == cdr_version_);
+        uint32_t dheader {0};
+        deserialize(dheader);
+
+        Cdr::state current_state(*this);
+        current_encoding_ = type_encoding;
+
+        if (EncodingAlgorithmFlag::PL_CDR2 == type_encoding)
+        {
+            while (0 < pending_members && CDR_ERROR_NONE == error_ && offset_ - current_state.offset_ != dheader)
+            {
+                if (offset_ - current_state.offset_ > dheader)
+                {
+                    return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+                }
+
+                xcdr2_deserialize_member_header(next_member_id_, current_state);
 
-        for (size_t count = 0; count < vector_t.size(); ++count)
+                if (!decode_member(current_state))
+                {
+                    return *this;
+                }
+            }
+        }
+        else
+        {
+            next_member_id_ = MemberId(0);
+
+            while (0 < pending_members && offset_ - current_state.offset_ < dheader &&
+                    functor(*this, next_member_id_))
+            {
+                if (is_selected(next_member_id_))
+                {
+                    --pending_members;
+                }
+                ++next_member_id_.id;
+            }
+        }
+
+        // Skip the members after the last selected one.
+        if (offset_ - current_state.offset_ > dheader)
+        {
+            return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+        }
+        else if (!jump(dheader - (offset_ - current_state.offset_)))
         {
-            uint8_t value = 0;
-            std::vector<bool>::const_reference ref = vector_t[count];
+            return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        }
+
+        next_member_id_ = current_state.next_member_id_;
+        current_encoding_ = current_state.previous_encoding_;
+    }
+    else if (EncodingAlgorithmFlag::PL_CDR == type_encoding)
+    {
+        assert(CdrVersion::XCDRv1 == cdr_version_);
+        Cdr::state current_state(*this);
+        current_encoding_ = type_encoding;
 
-            if (ref)
+        // Without DHEADER, the member headers are walked until the sentinel.
+        while (xcdr1_deserialize_member_header(next_member_id_, current_state))
+        {
+            if (!decode_member(current_state))
             {
-                value = 1;
+                return *this;
             }
-            offset_++ << value;
         }
+
+        next_member_id_ = current_state.next_member_id_;
+        current_encoding_ = current_state.previous_encoding_;
+    }
+    else
+    {
+        deserialize_type(type_encoding, functor);
+    }
+
+    return *this;
+}
+
+bool Cdr::deserialize_member_header(
+        MemberId& member_id,
+        uint32_t& member_size)
+{
+    Cdr::state current_state(*this);
+    bool ret_value {true};
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == current_encoding_)
+    {
+        xcdr2_deserialize_member_header(member_id, current_state);
+    }
+    else
+    {
+        ret_value = xcdr1_deserialize_member_header(member_id, current_state);
+    }
+
+    member_size = current_state.member_size_;
+    return ret_value && CDR_ERROR_NONE == error_;
+}
+
+void Cdr::set_encoded_primitive_sequence(
+        size_t element_size)
+{
+    if (CdrVersion::XCDRv2 == cdr_version_)
+    {
+        // Same rule as serialize_sequence.
+        serialized_member_size_ = 1 == element_size ? SERIALIZED_MEMBER_SIZE :
+                (4 == element_size ? SERIALIZED_MEMBER_SIZE_4 :
+                (8 == element_size ? SERIALIZED_MEMBER_SIZE_8 : NO_SERIALIZED_MEMBER_SIZE));
+    }
+}
+
+Cdr& Cdr::operator <<(
+        const MemberId& member_id)
+{
+    if (next_member_id_ != MEMBER_ID_INVALID)
+    {
+        return report_error(CDR_ERROR_BAD_PARAM, "Member id already set and not encoded");
+    }
+
+    next_member_id_ = member_id;
+    return *this;
+}
+
+Cdr& Cdr::serialize_bool_array(
+        const std::vector<bool>& vector_t)
+{
+    state state_before_error(*this);
+
+    size_t total_size = vector_t.size() * sizeof(bool);
+
+    if (((end_ - offset_) >= total_size) || resize(total_size))
+    {
+        // Save last datasize.
+        last_data_size_ = sizeof(bool);
+
+        unpack_bools(vector_t, &offset_);
+        offset_ += total_size;
     }
     else
     {
         set_state(state_before_error);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
     }
 
     if (CdrVersion::XCDRv2 == cdr_version_)
@@ -2231,22 +2851,13 @@ Cdr& Cdr::serialize_bool_sequence(
         // Save last datasize.
         last_data_size_ = sizeof(bool);
 
-        for (size_t count = 0; count < vector_t.size(); ++count)
-        {
-            uint8_t value = 0;
-            std::vector<bool>::const_reference ref = vector_t[count];
-
-            if (ref)
-            {
-                value = 1;
-            }
-            offset_++ << value;
-        }
+        unpack_bools(vector_t, &offset_);
+        offset_ += total_size;
     }
     else
     {
         set_state(state_before_error);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
     }
 
     if (CdrVersion::XCDRv2 == cdr_version_)
@@ -2266,32 +2877,22 @@ Cdr& Cdr::deserialize_bool_array(
 
     if ((end_ - offset_) >= total_size)
     {
+        if (!are_encoded_bools(&offset_, total_size))
+        {
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_BAD_PARAM, "Unexpected byte value in Cdr::deserialize_bool_sequence, expected 0 or 1");
+        }
+
         // Save last datasize.
         last_data_size_ = sizeof(bool);
 
-        for (uint32_t count = 0; count < vector_t.size(); ++count)
-        {
-            uint8_t value = 0;
-            offset_++ >> value;
-
-            if (value == 1)
-            {
-                vector_t[count] = true;
-            }
-            else if (value == 0)
-            {
-                vector_t[count] = false;
-            }
-            else
-            {
-                throw BadParamException("Unexpected byte value in Cdr::deserialize_bool_sequence, expected 0 or 1");
-            }
-        }
+        pack_bools(&offset_, vector_t);
+        offset_ += total_size;
     }
     else
     {
         set_state(state_before_error);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
     }
 
     return *this;
@@ -2309,33 +2910,23 @@ Cdr& Cdr::deserialize_bool_sequence(
 
     if ((end_ - offset_) >= total_size)
     {
+        if (!are_encoded_bools(&offset_, total_size))
+        {
+            set_state(state_before_error);
+            return report_error(CDR_ERROR_BAD_PARAM, "Unexpected byte value in Cdr::deserialize_bool_sequence, expected 0 or 1");
+        }
+
         vector_t.resize(sequence_length);
         // Save last datasize.
         last_data_size_ = sizeof(bool);
 
-        for (uint32_t count = 0; count < sequence_length; ++count)
-        {
-            uint8_t value = 0;
-            offset_++ >> value;
-
-            if (value == 1)
-            {
-                vector_t[count] = true;
-            }
-            else if (value == 0)
-            {
-                vector_t[count] = false;
-            }
-            else
-            {
-                throw BadParamException("Unexpected byte value in Cdr::deserialize_bool_sequence, expected 0 or 1");
-            }
-        }
+        pack_bools(&offset_, vector_t);
+        offset_ += total_size;
     }
     else
     {
         set_state(state_before_error);
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
     }
 
     return *this;
@@ -2356,7 +2947,7 @@ Cdr& Cdr::deserialize_string_sequence(
 
         deserialize(sequence_length);
 
-        try
+        FASTCDR_TRY
         {
             sequence_t = new std::string[sequence_length];
 
@@ -2369,14 +2960,16 @@ Cdr& Cdr::deserialize_string_sequence(
 
             if (offset_ - offset != dheader)
             {
-                throw BadParamException("Member size greater than size specified by DHEADER");
+                delete [] sequence_t;
+                sequence_t = nullptr;
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
             }
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             delete [] sequence_t;
             sequence_t = nullptr;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
     }
     else
@@ -2385,17 +2978,17 @@ Cdr& Cdr::deserialize_string_sequence(
 
         deserialize(sequence_length);
 
-        try
+        FASTCDR_TRY
         {
             sequence_t = new std::string[sequence_length];
             deserialize_array(sequence_t, sequence_length);
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             delete [] sequence_t;
             sequence_t = nullptr;
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
     }
 
@@ -2418,7 +3011,7 @@ Cdr& Cdr::deserialize_wstring_sequence(
 
         deserialize(sequence_length);
 
-        try
+        FASTCDR_TRY
         {
             sequence_t = new std::wstring[sequence_length];
 
@@ -2431,14 +3024,16 @@ Cdr& Cdr::deserialize_wstring_sequence(
 
             if (offset_ - offset != dheader)
             {
-                throw BadParamException("Member size greater than size specified by DHEADER");
+                delete [] sequence_t;
+                sequence_t = nullptr;
+                return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
             }
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             delete [] sequence_t;
             sequence_t = nullptr;
-            ex.raise();
+            FASTCDR_RETHROW;
         }
     }
     else
@@ -2447,17 +3042,17 @@ Cdr& Cdr::deserialize_wstring_sequence(
 
         deserialize(sequence_length);
 
-        try
+        FASTCDR_TRY
         {
             sequence_t = new std::wstring[sequence_length];
             deserialize_array(sequence_t, sequence_length);
         }
-        catch (exception::Exception& ex)
+        FASTCDR_CATCH(exception::Exception&)
         {
             delete [] sequence_t;
             sequence_t = nullptr;
             set_state(state_before_error);
-            ex.raise();
+            FASTCDR_RETHROW;
         }
     }
 
@@ -2547,7 +3142,8 @@ void Cdr::xcdr1_change_to_long_member_header(
     }
     else
     {
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return;
     }
     uint16_t flags_and_extended_pid = static_cast<uint16_t>(member_id.must_understand ? 0x4000 : 0x0) |
             static_cast<uint16_t>(PID_EXTENDED);
@@ -2565,7 +3161,15 @@ bool Cdr::xcdr1_deserialize_member_header(
         Cdr::state& current_state)
 {
     bool ret_value = true;
-    make_alignment(alignment(4));
+    const size_t align {alignment(4)};
+
+    if ((end_ - offset_) < align)
+    {
+        report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return false;
+    }
+
+    make_alignment(align);
     uint16_t flags_and_member_id = 0;
     deserialize(flags_and_member_id);
     member_id.must_understand = (flags_and_member_id & 0x4000);
@@ -2587,7 +3191,8 @@ bool Cdr::xcdr1_deserialize_member_header(
         deserialize(size);
         if (PID_EXTENDED_LENGTH != size)
         {
-            throw BadParamException("PID_EXTENDED comes with a size different than 8");
+            report_error(CDR_ERROR_BAD_PARAM, "PID_EXTENDED comes with a size different than 8");
+            return false;
         }
         uint32_t mid = 0;
         deserialize(mid);
@@ -2602,12 +3207,19 @@ bool Cdr::xcdr1_deserialize_member_header(
         deserialize(size);
         if (0 != size)
         {
-            throw BadParamException("PID_SENTINEL comes with a size different than 0");
+            report_error(CDR_ERROR_BAD_PARAM, "PID_SENTINEL comes with a size different than 0");
+            return false;
         }
         current_state.member_size_ = size;
         ret_value = false;
     }
 
+    if (CDR_ERROR_NONE != error_)
+    {
+        // Stop iterating members when the buffer could not be decoded.
+        ret_value = false;
+    }
+
     return ret_value;
 }
 
@@ -2684,7 +3296,8 @@ void Cdr::xcdr2_change_to_long_member_header(
     }
     else
     {
-        throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return;
     }
     uint32_t lc = get_long_lc(serialized_member_size_);
     uint32_t flags_and_member_id = (member_id.must_understand ? 0x80000000 : 0x0) | lc | member_id.id;
@@ -2748,7 +3361,7 @@ Cdr& Cdr::xcdr1_begin_serialize_member(
                     current_state.header_serialized_ = XCdrHeaderSelection::LONG_HEADER;
                     break;
                 default:
-                    throw BadParamException(
+                    return report_error(CDR_ERROR_BAD_PARAM,
                               "Cannot encode XCDRv1 ShortMemberHeader when member_id is bigger than 0x3F00");
             }
         }
@@ -2767,7 +3380,8 @@ Cdr& Cdr::xcdr1_end_serialize_member(
     assert(EncodingAlgorithmFlag::PLAIN_CDR == current_encoding_ ||
             EncodingAlgorithmFlag::PL_CDR == current_encoding_);
 
-    if (EncodingAlgorithmFlag::PL_CDR == current_encoding_)
+    // The header of a member not completely encoded is not patched.
+    if (CDR_ERROR_NONE == error_ && EncodingAlgorithmFlag::PL_CDR == current_encoding_)
     {
         auto last_offset = offset_;
         auto member_origin = origin_;
@@ -2787,7 +3401,7 @@ Cdr& Cdr::xcdr1_end_serialize_member(
                     }
                     else
                     {
-                        throw BadParamException(
+                        return report_error(CDR_ERROR_BAD_PARAM,
                                   "Cannot encode XCDRv1 ShortMemberHeader when serialized member size is greater than 0xFFFF");
                     }
                     break;
@@ -2844,6 +3458,8 @@ Cdr& Cdr::xcdr1_begin_serialize_opt_member(
 
     if (is_present || EncodingAlgorithmFlag::PL_CDR != current_encoding_)
     {
+        begin_patched_region();
+
         if (0x3F00 >= member_id.id)
         {
             switch (header_selection)
@@ -2871,7 +3487,7 @@ Cdr& Cdr::xcdr1_begin_serialize_opt_member(
                     current_state.header_serialized_ = XCdrHeaderSelection::LONG_HEADER;
                     break;
                 default:
-                    throw BadParamException(
+                    return report_error(CDR_ERROR_BAD_PARAM,
                               "Cannot encode XCDRv1 ShortMemberHeader when member_id is bigger than 0x3F00");
             }
         }
@@ -2891,7 +3507,7 @@ Cdr& Cdr::xcdr1_end_serialize_opt_member(
     assert(EncodingAlgorithmFlag::PLAIN_CDR == current_encoding_ ||
             EncodingAlgorithmFlag::PL_CDR == current_encoding_);
 
-    if (0 < current_state.member_size_)
+    if (CDR_ERROR_NONE == error_ && 0 < current_state.member_size_)
     {
         auto last_offset = offset_;
         auto member_origin = origin_;
@@ -2911,7 +3527,7 @@ Cdr& Cdr::xcdr1_end_serialize_opt_member(
                     }
                     else
                     {
-                        throw BadParamException(
+                        return report_error(CDR_ERROR_BAD_PARAM,
                                   "Cannot encode XCDRv1 ShortMemberHeader when serialized member size is greater than 0xFFFF");
                     }
                     break;
@@ -2949,6 +3565,11 @@ Cdr& Cdr::xcdr1_end_serialize_opt_member(
         jump(member_serialized_size);
     }
 
+    if (0 < current_state.member_size_ || EncodingAlgorithmFlag::PL_CDR != current_encoding_)
+    {
+        end_patched_region();
+    }
+
     next_member_id_ = MEMBER_ID_INVALID;
 
     return *this;
@@ -2971,7 +3592,7 @@ Cdr& Cdr::xcdr2_begin_serialize_member(
     {
         if (0x10000000 <= member_id.id)
         {
-            throw BadParamException("Cannot serialize a member identifier equal or greater than 0x10000000");
+            return report_error(CDR_ERROR_BAD_PARAM, "Cannot serialize a member identifier equal or greater than 0x10000000");
         }
 
         switch (header_selection)
@@ -3005,7 +3626,8 @@ Cdr& Cdr::xcdr2_end_serialize_member(
             EncodingAlgorithmFlag::DELIMIT_CDR2 == current_encoding_ ||
             EncodingAlgorithmFlag::PL_CDR2 == current_encoding_);
 
-    if (0 < current_state.member_size_ && EncodingAlgorithmFlag::PL_CDR2 == current_encoding_)
+    if (CDR_ERROR_NONE == error_ && 0 < current_state.member_size_ &&
+            EncodingAlgorithmFlag::PL_CDR2 == current_encoding_)
     {
         auto last_offset = offset_;
         set_state(current_state);
@@ -3025,7 +3647,7 @@ Cdr& Cdr::xcdr2_end_serialize_member(
                         }
                         else
                         {
-                            throw BadParamException("Cannot encode XCDRv2 LongMemberHeader");
+                            return report_error(CDR_ERROR_BAD_PARAM, "Cannot encode XCDRv2 LongMemberHeader");
                         }
                         break;
                     case XCdrHeaderSelection::LONG_HEADER:
@@ -3072,7 +3694,7 @@ Cdr& Cdr::xcdr2_end_serialize_member(
                     }
                     else
                     {
-                        throw BadParamException("Cannot encode XCDRv2 LongMemberHeader");
+                        return report_error(CDR_ERROR_BAD_PARAM, "Cannot encode XCDRv2 LongMemberHeader");
                     }
                     break;
                 case XCdrHeaderSelection::LONG_HEADER:
@@ -3153,6 +3775,11 @@ Cdr& Cdr::xcdr1_begin_serialize_type(
             EncodingAlgorithmFlag::PL_CDR == current_encoding_);
     assert(EncodingAlgorithmFlag::PLAIN_CDR == type_encoding ||
             EncodingAlgorithmFlag::PL_CDR == type_encoding);
+    if (EncodingAlgorithmFlag::PL_CDR == type_encoding)
+    {
+        // Member headers are patched when each member ends.
+        begin_patched_region();
+    }
     current_state.previous_encoding_ = current_encoding_;
     current_encoding_ = type_encoding;
     return *this;
@@ -3169,6 +3796,7 @@ Cdr& Cdr::xcdr1_end_serialize_type(
         make_alignment(alignment(4));
         serialize(PID_SENTINEL);
         serialize(PID_SENTINEL_LENGTH);
+        end_patched_region();
     }
 
     current_encoding_ = current_state.previous_encoding_;
@@ -3189,6 +3817,7 @@ Cdr& Cdr::xcdr2_begin_serialize_type(
             EncodingAlgorithmFlag::PL_CDR2 == type_encoding);
     if (EncodingAlgorithmFlag::PLAIN_CDR2 != type_encoding)
     {
+        begin_patched_region();
         uint32_t dheader {0};
         serialize(dheader);
     }
@@ -3204,7 +3833,7 @@ Cdr& Cdr::xcdr2_end_serialize_type(
     assert(EncodingAlgorithmFlag::PLAIN_CDR2 == current_encoding_ ||
             EncodingAlgorithmFlag::DELIMIT_CDR2 == current_encoding_ ||
             EncodingAlgorithmFlag::PL_CDR2 == current_encoding_);
-    if (EncodingAlgorithmFlag::PLAIN_CDR2 != current_encoding_)
+    if (CDR_ERROR_NONE == error_ && EncodingAlgorithmFlag::PLAIN_CDR2 != current_encoding_)
     {
         auto last_offset = offset_;
         set_state(current_state);
@@ -3212,6 +3841,7 @@ Cdr& Cdr::xcdr2_end_serialize_type(
         serialize(static_cast<uint32_t>(member_serialized_size));
         jump(member_serialized_size);
         serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+        end_patched_region();
     }
     current_encoding_ = current_state.previous_encoding_;
     return *this;
@@ -3237,7 +3867,7 @@ Cdr& Cdr::xcdr1_deserialize_type(
             {
                 if (next_member_id_.must_understand)
                 {
-                    throw BadParamException("Cannot deserialize a member with flag must_understand");
+                    return report_error(CDR_ERROR_BAD_PARAM, "Cannot deserialize a member with flag must_understand");
                 }
                 else
                 {
@@ -3247,7 +3877,7 @@ Cdr& Cdr::xcdr1_deserialize_type(
 
             if (current_state.member_size_ != offset_ - prev_offset)
             {
-                throw BadParamException(
+                return report_error(CDR_ERROR_BAD_PARAM,
                           "Member size provided by member header is not equal to the real decoded member size");
             }
         }
@@ -3287,11 +3917,11 @@ Cdr& Cdr::xcdr2_deserialize_type(
 
         if (EncodingAlgorithmFlag::PL_CDR2 == current_encoding_)
         {
-            while (offset_ - current_state.offset_ != dheader)
+            while (CDR_ERROR_NONE == error_ && offset_ - current_state.offset_ != dheader)
             {
                 if (offset_ - current_state.offset_ > dheader)
                 {
-                    throw BadParamException("Member size greater than size specified by DHEADER");
+                    return report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
                 }
 
                 auto offset = offset_;
@@ -3302,7 +3932,7 @@ Cdr& Cdr::xcdr2_deserialize_type(
                 {
                     if (next_member_id_.must_understand)
                     {
-                        throw BadParamException("Cannot deserialize a member with flag must_understand");
+                        return report_error(CDR_ERROR_BAD_PARAM, "Cannot deserialize a member with flag must_understand");
                     }
                     else
                     {
@@ -3317,7 +3947,7 @@ Cdr& Cdr::xcdr2_deserialize_type(
                         alignment_on_state(current_state.origin_, offset, sizeof(uint32_t)) -
                         (XCdrHeaderSelection::SHORT_HEADER == current_state.header_serialized_ ? 4 : 8)))
                 {
-                    throw BadParamException(
+                    return report_error(CDR_ERROR_BAD_PARAM,
                               "Member size provided by member header is not equal to the real decoded size");
                 }
             }
@@ -3358,6 +3988,809 @@ Cdr& Cdr::xcdr2_deserialize_type(
     return *this;
 }
 
+Cdr::member_index::member_index(
+        Cdr& cdr,
+        EncodingAlgorithmFlag type_encoding)
+    : cdr_(cdr)
+    , type_encoding_(type_encoding)
+{
+    if (!(CdrVersion::XCDRv1 == cdr_.cdr_version_ && EncodingAlgorithmFlag::PL_CDR == type_encoding) &&
+            !(CdrVersion::XCDRv2 == cdr_.cdr_version_ && EncodingAlgorithmFlag::PL_CDR2 == type_encoding))
+    {
+        cdr_.report_error(CDR_ERROR_BAD_PARAM, "Only mutable types can be indexed");
+        return;
+    }
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == type_encoding_)
+    {
+        uint32_t dheader {0};
+        cdr_.deserialize(dheader);
+
+        if (CDR_ERROR_NONE == cdr_.error_)
+        {
+            if ((cdr_.end_ - cdr_.offset_) >= dheader)
+            {
+                begin_ = cdr_.offset_ - cdr_.cdr_buffer_.begin();
+                end_ = begin_ + dheader;
+                origin_ = cdr_.origin_ - cdr_.cdr_buffer_.begin();
+                cdr_.jump(dheader);
+                valid_ = true;
+            }
+            else
+            {
+                cdr_.report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+            }
+        }
+    }
+    else
+    {
+        // Without DHEADER the end of the type is only known after scanning the member headers.
+        begin_ = cdr_.offset_ - cdr_.cdr_buffer_.begin();
+        valid_ = build();
+        end_ = cdr_.offset_ - cdr_.cdr_buffer_.begin();
+    }
+}
+
+bool Cdr::member_index::contains(
+        const MemberId& member_id)
+{
+    return nullptr != find(member_id);
+}
+
+size_t Cdr::member_index::size()
+{
+    return ensure_index() ? members_.size() : 0;
+}
+
+bool Cdr::member_index::build()
+{
+    built_ = true;
+    Cdr::state member_state(cdr_);
+    MemberId member_id;
+
+    auto add_member = [&]() -> bool
+            {
+                location member;
+                member.offset = cdr_.offset_ - cdr_.cdr_buffer_.begin();
+                member.size = member_state.member_size_;
+
+                if (!cdr_.jump(member.size))
+                {
+                    cdr_.report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                    return false;
+                }
+
+                // When a member is repeated the last one is kept, as sequential decoding does.
+                members_.emplace_hint(members_.end(), member_id.id, member)->second = member;
+                return true;
+            };
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == type_encoding_)
+    {
+        while (CDR_ERROR_NONE == cdr_.error_ && cdr_.offset_ - cdr_.cdr_buffer_.begin() != end_)
+        {
+            if (cdr_.offset_ - cdr_.cdr_buffer_.begin() > end_)
+            {
+                cdr_.report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+                return false;
+            }
+
+            cdr_.xcdr2_deserialize_member_header(member_id, member_state);
+
+            if (CDR_ERROR_NONE == cdr_.error_ && !add_member())
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        while (cdr_.xcdr1_deserialize_member_header(member_id, member_state))
+        {
+            if (!add_member())
+            {
+                return false;
+            }
+        }
+    }
+
+    return CDR_ERROR_NONE == cdr_.error_;
+}
+
+bool Cdr::member_index::ensure_index()
+{
+    if (valid_ && !built_)
+    {
+        Cdr::state previous_state(cdr_);
+        cdr_.offset_ = cdr_.cdr_buffer_.begin();
+        cdr_.offset_ += begin_;
+        cdr_.origin_ = cdr_.cdr_buffer_.begin();
+        cdr_.origin_ += origin_;
+
+        FASTCDR_TRY
+        {
+            valid_ = build();
+        }
+        FASTCDR_CATCH(exception::Exception&)
+        {
+            valid_ = false;
+            restore(previous_state);
+            FASTCDR_RETHROW;
+        }
+
+        restore(previous_state);
+    }
+
+    return valid_;
+}
+
+const Cdr::member_index::location* Cdr::member_index::find(
+        const MemberId& member_id)
+{
+    const location* ret_value {nullptr};
+
+    if (ensure_index())
+    {
+        auto it = members_.find(member_id.id);
+
+        if (members_.end() != it)
+        {
+            ret_value = &it->second;
+        }
+    }
+
+    return ret_value;
+}
+
+void Cdr::member_index::move_to(
+        const MemberId& member_id,
+        const location& member)
+{
+    cdr_.offset_ = cdr_.cdr_buffer_.begin();
+    cdr_.offset_ += member.offset;
+
+    if (EncodingAlgorithmFlag::PL_CDR == type_encoding_)
+    {
+        // XCDRv1 aligns the member value from the end of its member header.
+        cdr_.origin_ = cdr_.offset_;
+    }
+    else
+    {
+        cdr_.origin_ = cdr_.cdr_buffer_.begin();
+        cdr_.origin_ += origin_;
+    }
+
+    cdr_.last_data_size_ = 0;
+    cdr_.current_encoding_ = type_encoding_;
+    cdr_.next_member_id_ = member_id;
+}
+
+void Cdr::member_index::restore(
+        const Cdr::state& previous_state)
+{
+    cdr_.set_state(previous_state);
+    cdr_.current_encoding_ = previous_state.previous_encoding_;
+}
+
+bool Cdr::member_index::check_and_restore(
+        const location& member,
+        const Cdr::state& previous_state)
+{
+    const size_t decoded_size {cdr_.offset_ - cdr_.cdr_buffer_.begin() - member.offset};
+    restore(previous_state);
+
+    if (CDR_ERROR_NONE != cdr_.error_)
+    {
+        return false;
+    }
+
+    if (member.size != decoded_size)
+    {
+        cdr_.report_error(CDR_ERROR_BAD_PARAM,
+                "Member size provided by member header is not equal to the real decoded size");
+        return false;
+    }
+
+    return true;
+}
+
+Cdr& Cdr::skip(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type,
+        bool validate)
+{
+    skip_value(description, type, validate ? SkipMode::VALIDATE : SkipMode::JUMP);
+    return *this;
+}
+
+Cdr& Cdr::transcode_endianness(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type)
+{
+    skip_value(description, type, SkipMode::SWAP);
+    return *this;
+}
+
+bool Cdr::jump_primitives(
+        TypeKind kind,
+        size_t num_elements)
+{
+    return skip_primitives(kind, num_elements, SkipMode::JUMP);
+}
+
+Cdr& Cdr::serialize_with_plan(
+        const SerializationPlan& plan,
+        const void* data)
+{
+    if (plan.align64() != align64_ ||
+            (offset_ - origin_) % plan.max_alignment() !=
+            plan.initial_alignment() % plan.max_alignment())
+    {
+        return report_error(CDR_ERROR_BAD_PARAM, "Serialization plan doesn't match the current state in Cdr::serialize_with_plan");
+    }
+
+    const size_t size {plan.serialized_size()};
+
+    if (0 == size)
+    {
+        return *this;
+    }
+
+    if (((end_ - offset_) >= size) || resize(size))
+    {
+        const char* src {static_cast<const char*>(data)};
+        char* dst {&offset_};
+        size_t position {0};
+
+        for (const SerializationPlan::Operation& operation : plan.operations())
+        {
+            // Padding bytes are zeroed, so the previous contents of the buffer are not leaked.
+            memset(dst + position, 0, operation.wire_offset - position);
+            position = operation.wire_offset + operation.width * operation.num_elements;
+
+            if (swap_bytes_ && operation.swap)
+            {
+                copy_swapped(dst + operation.wire_offset, src + operation.source_offset, operation.width,
+                        operation.num_elements);
+            }
+            else
+            {
+                memcpy(dst + operation.wire_offset, src + operation.source_offset,
+                        operation.width * operation.num_elements);
+            }
+        }
+
+        const SerializationPlan::Operation& last = plan.operations().back();
+        offset_ += size;
+        last_data_size_ = 8 == last.width ? align64_ : last.width;
+        return *this;
+    }
+
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+}
+
+Cdr& Cdr::deserialize_with_plan(
+        const SerializationPlan& plan,
+        void* data)
+{
+    if (plan.align64() != align64_ ||
+            (offset_ - origin_) % plan.max_alignment() !=
+            plan.initial_alignment() % plan.max_alignment())
+    {
+        return report_error(CDR_ERROR_BAD_PARAM, "Serialization plan doesn't match the current state in Cdr::deserialize_with_plan");
+    }
+
+    const size_t size {plan.serialized_size()};
+
+    if (0 == size)
+    {
+        return *this;
+    }
+
+    if ((end_ - offset_) >= size)
+    {
+        const char* src {&offset_};
+        char* dst {static_cast<char*>(data)};
+
+        for (const SerializationPlan::Operation& operation : plan.operations())
+        {
+            if (operation.boolean && !are_encoded_bools(src + operation.wire_offset, operation.num_elements))
+            {
+                return report_error(CDR_ERROR_BAD_PARAM, "Unexpected byte value in Cdr::deserialize_with_plan, expected 0 or 1");
+            }
+        }
+
+        for (const SerializationPlan::Operation& operation : plan.operations())
+        {
+            if (swap_bytes_ && operation.swap)
+            {
+                copy_swapped(dst + operation.source_offset, src + operation.wire_offset, operation.width,
+                        operation.num_elements);
+            }
+            else
+            {
+                memcpy(dst + operation.source_offset, src + operation.wire_offset,
+                        operation.width * operation.num_elements);
+            }
+        }
+
+        const SerializationPlan::Operation& last = plan.operations().back();
+        offset_ += size;
+        last_data_size_ = 8 == last.width ? align64_ : last.width;
+        return *this;
+    }
+
+    return report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+}
+
+bool Cdr::skip_primitives(
+        TypeKind kind,
+        size_t num_elements,
+        SkipMode mode)
+{
+    if (0 == num_elements)
+    {
+        return true;
+    }
+
+    const size_t size {TypeDescription::primitive_size(kind)};
+    const size_t align_size {8 <= size ? align64_ : size};
+    const size_t align {alignment(align_size)};
+
+    if ((end_ - offset_) < align || (end_ - offset_ - align) / size < num_elements)
+    {
+        report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return false;
+    }
+
+    if (SkipMode::JUMP != mode && TypeKind::BOOLEAN == kind && !are_encoded_bools(&offset_ + align, num_elements))
+    {
+        report_error(CDR_ERROR_BAD_PARAM, "Unexpected byte value in Cdr::skip, expected 0 or 1");
+        return false;
+    }
+
+    make_alignment(align);
+
+    if (SkipMode::SWAP == mode && 1 < size)
+    {
+        copy_swapped(&offset_, &offset_, size, num_elements);
+    }
+
+    offset_ += size * num_elements;
+    last_data_size_ = align_size;
+    return true;
+}
+
+bool Cdr::skip_dheader(
+        uint32_t& dheader,
+        SkipMode mode)
+{
+    deserialize(dheader);
+
+    if (CDR_ERROR_NONE != error_)
+    {
+        return false;
+    }
+
+    if (SkipMode::SWAP == mode)
+    {
+        copy_swapped(&offset_ - sizeof(uint32_t), &offset_ - sizeof(uint32_t), sizeof(uint32_t), 1);
+    }
+
+    if ((end_ - offset_) < dheader)
+    {
+        report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return false;
+    }
+
+    return true;
+}
+
+bool Cdr::skip_length(
+        uint32_t& length,
+        uint32_t bound,
+        SkipMode mode)
+{
+    deserialize(length);
+
+    if (CDR_ERROR_NONE != error_)
+    {
+        return false;
+    }
+
+    if (SkipMode::SWAP == mode)
+    {
+        copy_swapped(&offset_ - sizeof(uint32_t), &offset_ - sizeof(uint32_t), sizeof(uint32_t), 1);
+    }
+
+    if (0 < bound && bound < length)
+    {
+        report_error(CDR_ERROR_BAD_PARAM, "Length exceeds the bound of the type");
+        return false;
+    }
+
+    return true;
+}
+
+bool Cdr::skip_xcdr1_member_header(
+        MemberId& member_id,
+        Cdr::state& current_state,
+        SkipMode mode)
+{
+    char* header {&offset_ + alignment(4)};
+    const bool ret_value {xcdr1_deserialize_member_header(member_id, current_state)};
+
+    if (SkipMode::SWAP == mode && CDR_ERROR_NONE == error_)
+    {
+        // Short headers and the sentinel are two 16 bits values, and long headers add two 32 bits values.
+        copy_swapped(header, header, sizeof(uint16_t), 2);
+
+        if (&offset_ - header > 4)
+        {
+            copy_swapped(header + 4, header + 4, sizeof(uint32_t), 2);
+        }
+    }
+
+    return ret_value;
+}
+
+bool Cdr::skip_plain_member(
+        const TypeDescription& description,
+        const TypeDescription::Member& member,
+        SkipMode mode)
+{
+    if (member.optional && CdrVersion::XCDRv2 == cdr_version_)
+    {
+        bool is_present {false};
+        deserialize(is_present);
+
+        if (CDR_ERROR_NONE != error_)
+        {
+            return false;
+        }
+
+        return !is_present || skip_value(description, member.type, mode);
+    }
+    else if (member.optional && CdrVersion::XCDRv1 == cdr_version_)
+    {
+        Cdr::state current_state(*this);
+        MemberId member_id;
+        skip_xcdr1_member_header(member_id, current_state, mode);
+
+        if (CDR_ERROR_NONE != error_)
+        {
+            return false;
+        }
+
+        auto prev_offset = offset_;
+
+        if (0 < current_state.member_size_ && !skip_value(description, member.type, mode))
+        {
+            return false;
+        }
+
+        const size_t diff {offset_ - prev_offset};
+
+        if (current_state.member_size_ < diff)
+        {
+            report_error(CDR_ERROR_BAD_PARAM,
+                    "Member size provided by member header is lower than real decoded member size");
+            return false;
+        }
+
+        if (!jump(current_state.member_size_ - diff))
+        {
+            report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+            return false;
+        }
+
+        return true;
+    }
+
+    return skip_value(description, member.type, mode);
+}
+
+bool Cdr::skip_structure(
+        const TypeDescription& description,
+        const TypeDescription::Type& type,
+        SkipMode mode)
+{
+    if (CdrVersion::XCDRv2 == cdr_version_ && Extensibility::FINAL != type.extensibility)
+    {
+        uint32_t dheader {0};
+
+        if (!skip_dheader(dheader, mode))
+        {
+            return false;
+        }
+
+        if (SkipMode::JUMP == mode)
+        {
+            jump(dheader);
+            return true;
+        }
+
+        auto begin = offset_;
+
+        if (Extensibility::APPENDABLE == type.extensibility)
+        {
+            for (uint32_t position {0}; position < type.member_count && offset_ - begin < dheader; ++position)
+            {
+                if (!skip_plain_member(description, description.member(type, position), mode))
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            Cdr::state current_state(*this);
+            MemberId member_id;
+
+            while (offset_ - begin < dheader)
+            {
+                char* header {&offset_ + alignment(4)};
+                xcdr2_deserialize_member_header(member_id, current_state);
+
+                if (CDR_ERROR_NONE != error_)
+                {
+                    return false;
+                }
+
+                if (SkipMode::SWAP == mode)
+                {
+                    // The NEXTINT is only part of the header when its LC is 4, otherwise it is swapped with the value.
+                    copy_swapped(header, header, sizeof(uint32_t), static_cast<size_t>(&offset_ - header) / 4);
+                }
+
+                auto member_begin = offset_;
+                const TypeDescription::Member* member {description.find_member(type, member_id.id)};
+
+                if (nullptr != member)
+                {
+                    if (!skip_value(description, member->type, mode))
+                    {
+                        return false;
+                    }
+
+                    if (current_state.member_size_ != offset_ - member_begin)
+                    {
+                        report_error(CDR_ERROR_BAD_PARAM,
+                                "Member size provided by member header is not equal to the real decoded size");
+                        return false;
+                    }
+                }
+                else if (SkipMode::SWAP == mode)
+                {
+                    report_error(CDR_ERROR_BAD_PARAM, "Cannot swap the endianness of an unknown member");
+                    return false;
+                }
+                else if (member_id.must_understand)
+                {
+                    report_error(CDR_ERROR_BAD_PARAM, "Cannot deserialize a member with flag must_understand");
+                    return false;
+                }
+                else if (!jump(current_state.member_size_))
+                {
+                    report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                    return false;
+                }
+            }
+        }
+
+        if (offset_ - begin > dheader)
+        {
+            report_error(CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+            return false;
+        }
+
+        if (SkipMode::SWAP == mode && offset_ - begin < dheader)
+        {
+            report_error(CDR_ERROR_BAD_PARAM, "Cannot swap the endianness of an unknown member");
+            return false;
+        }
+
+        // Members appended by a newer version of an appendable type are skipped.
+        jump(dheader - (offset_ - begin));
+    }
+    else if (CdrVersion::XCDRv1 == cdr_version_ && Extensibility::MUTABLE == type.extensibility)
+    {
+        Cdr::state current_state(*this);
+        MemberId member_id;
+
+        while (skip_xcdr1_member_header(member_id, current_state, mode))
+        {
+            auto member_begin = offset_;
+            const TypeDescription::Member* member {
+                SkipMode::JUMP != mode ? description.find_member(type, member_id.id) : nullptr};
+
+            if (nullptr != member)
+            {
+                if (!skip_value(description, member->type, mode))
+                {
+                    return false;
+                }
+
+                if (current_state.member_size_ != offset_ - member_begin)
+                {
+                    report_error(CDR_ERROR_BAD_PARAM,
+                            "Member size provided by member header is not equal to the real decoded member size");
+                    return false;
+                }
+            }
+            else if (SkipMode::SWAP == mode)
+            {
+                report_error(CDR_ERROR_BAD_PARAM, "Cannot swap the endianness of an unknown member");
+                return false;
+            }
+            else if (SkipMode::JUMP != mode && member_id.must_understand)
+            {
+                report_error(CDR_ERROR_BAD_PARAM, "Cannot deserialize a member with flag must_understand");
+                return false;
+            }
+            else if (!jump(current_state.member_size_))
+            {
+                report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                return false;
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t position {0}; position < type.member_count; ++position)
+        {
+            if (!skip_plain_member(description, description.member(type, position), mode))
+            {
+                return false;
+            }
+        }
+    }
+
+    return CDR_ERROR_NONE == error_;
+}
+
+bool Cdr::skip_value(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex index,
+        SkipMode mode)
+{
+    nesting_scope scope(*this);
+
+    if (!scope)
+    {
+        return false;
+    }
+
+    const TypeDescription::Type& type = description.type(index);
+    uint32_t length {0};
+
+    switch (type.kind)
+    {
+        case TypeKind::STRING8:
+            if (!skip_length(length, 0 < type.bound ? type.bound + 1 : 0, mode))
+            {
+                return false;
+            }
+
+            if ((end_ - offset_) < length)
+            {
+                report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                return false;
+            }
+
+            if (SkipMode::JUMP != mode && 0 < length &&
+                    ('\0' != (&offset_)[length - 1] || nullptr != memchr(&offset_, '\0', length - 1)))
+            {
+                report_error(CDR_ERROR_BAD_PARAM, "String without terminator or with null characters");
+                return false;
+            }
+
+            offset_ += length;
+            last_data_size_ = sizeof(uint8_t);
+            return true;
+        case TypeKind::STRING16:
+            return skip_length(length, type.bound, mode) && skip_primitives(TypeKind::CHAR16, length, mode);
+        case TypeKind::SEQUENCE:
+        case TypeKind::ARRAY:
+        case TypeKind::MAP:
+        {
+            const bool is_primitive_element {TypeKind::ARRAY == type.kind ?
+                                              description.is_multi_array_primitive(index) :
+                                              TypeDescription::is_primitive(description.type(type.element).kind)};
+
+            if (TypeKind::ARRAY == type.kind && is_primitive_element)
+            {
+                // Nested arrays of primitives are contiguous.
+                const TypeDescription::Type* element {&type};
+                size_t num_elements {1};
+
+                while (TypeKind::ARRAY == element->kind)
+                {
+                    num_elements *= element->bound;
+                    element = &description.type(element->element);
+                }
+
+                return skip_primitives(element->kind, num_elements, mode);
+            }
+
+            uint32_t dheader {0};
+            const bool has_dheader {CdrVersion::XCDRv2 == cdr_version_ && !is_primitive_element};
+
+            if (has_dheader)
+            {
+                if (!skip_dheader(dheader, mode))
+                {
+                    return false;
+                }
+
+                if (SkipMode::JUMP == mode)
+                {
+                    jump(dheader);
+                    return true;
+                }
+            }
+
+            auto begin = offset_;
+
+            if (TypeKind::ARRAY == type.kind)
+            {
+                length = type.bound;
+            }
+            else if (!skip_length(length, type.bound, mode))
+            {
+                return false;
+            }
+            else if (TypeKind::SEQUENCE == type.kind && is_primitive_element)
+            {
+                return skip_primitives(description.type(type.element).kind, length, mode);
+            }
+            else if (TypeKind::SEQUENCE == type.kind && 0 < length &&
+                    is_encoded_in_zero_bytes(description, type.element, cdr_version_))
+            {
+                // The length would be looped over without consuming the buffer.
+                report_error(CDR_ERROR_BAD_PARAM, "Non-empty sequence of values encoded in zero bytes");
+                return false;
+            }
+            else if (has_dheader && (offset_ - begin > dheader || dheader - (offset_ - begin) < length))
+            {
+                report_error(CDR_ERROR_BAD_PARAM, "Collection length exceeds the size specified by DHEADER");
+                return false;
+            }
+            else if (!has_dheader && (end_ - offset_) < length)
+            {
+                report_error(CDR_ERROR_NOT_ENOUGH_MEMORY);
+                return false;
+            }
+
+            for (uint32_t count {0}; count < length; ++count)
+            {
+                if (has_dheader && offset_ - begin > dheader)
+                {
+                    break;
+                }
+
+                if ((TypeKind::MAP == type.kind && !skip_value(description, type.key, mode)) ||
+                        !skip_value(description, type.element, mode))
+                {
+                    return false;
+                }
+            }
+
+            if (has_dheader && offset_ - begin != dheader)
+            {
+                report_error(CDR_ERROR_BAD_PARAM, "Member size differs from the size specified by DHEADER");
+                return false;
+            }
+
+            return true;
+        }
+        case TypeKind::STRUCTURE:
+            return skip_structure(description, type, mode);
+        default:
+            return skip_primitives(type.kind, 1, mode);
+    }
+}
+
 Cdr& Cdr::cdr_begin_serialize_member(
         const MemberId&,
         bool,
@@ -3418,6 +4851,7 @@ Cdr::state Cdr::allocate_xcdrv2_dheader()
 
     if (CdrVersion::XCDRv2 == cdr_version_)
     {
+        begin_patched_region();
         // Serialize DHEADER
         uint32_t dheader {0};
         serialize(dheader);
@@ -3438,6 +4872,7 @@ void Cdr::set_xcdrv2_dheader(
         serialize(static_cast<uint32_t>(dheader));
         set_state(state_after);
         serialized_member_size_ = SERIALIZED_MEMBER_SIZE;
+        end_patched_region();
     }
 }
 
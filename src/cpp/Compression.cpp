@@ -0,0 +1,519 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/Compression.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Size of the encapsulation of a payload.
+static constexpr size_t ENCAPSULATION_SIZE {4};
+
+//! Size of the fields storing the size of the decompressed data and the header of each segment.
+static constexpr size_t SIZE_FIELD_SIZE {4};
+
+//! Flag of a segment header telling the segment is stored without compressing it.
+static constexpr uint32_t STORED_SEGMENT {0x80000000u};
+
+//! Minimum length of a match.
+static constexpr size_t MIN_MATCH {4};
+
+//! Maximum value of a length stored in a nibble of a token.
+static constexpr size_t TOKEN_LENGTH_MASK {15};
+
+//! Number of bits of the hash of four bytes.
+static constexpr unsigned HASH_BITS {12};
+
+static void write_uint32(
+        unsigned char* data,
+        uint32_t value)
+{
+    data[0] = static_cast<unsigned char>(value);
+    data[1] = static_cast<unsigned char>(value >> 8);
+    data[2] = static_cast<unsigned char>(value >> 16);
+    data[3] = static_cast<unsigned char>(value >> 24);
+}
+
+static uint32_t read_uint32(
+        const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+           static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+static uint32_t read_word(
+        const unsigned char* data)
+{
+    uint32_t word {0};
+    memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+static size_t hash_word(
+        uint32_t word)
+{
+    return (word * 2654435761u) >> (32 - HASH_BITS);
+}
+
+//! Writes the bytes extending a length which doesn't fit in the nibble of a token.
+static unsigned char* write_length_extension(
+        unsigned char* out,
+        size_t length)
+{
+    if (TOKEN_LENGTH_MASK <= length)
+    {
+        length -= TOKEN_LENGTH_MASK;
+
+        while (255 <= length)
+        {
+            *out++ = 255;
+            length -= 255;
+        }
+
+        *out++ = static_cast<unsigned char>(length);
+    }
+
+    return out;
+}
+
+//! Reads the bytes extending a length which doesn't fit in the nibble of a token.
+static bool read_length_extension(
+        const unsigned char*& in,
+        const unsigned char* in_end,
+        size_t& length)
+{
+    if (TOKEN_LENGTH_MASK == length)
+    {
+        unsigned char byte {0};
+
+        do
+        {
+            if (in == in_end)
+            {
+                return false;
+            }
+
+            byte = *in++;
+            length += byte;
+        } while (255 == byte);
+    }
+
+    return true;
+}
+
+/*!
+ * @brief Writes a sequence: a token with the lengths, the literals and, unless match_length is zero, the match.
+ * @return Position after the sequence, or nullptr when it doesn't fit.
+ */
+static unsigned char* write_sequence(
+        unsigned char* out,
+        const unsigned char* out_end,
+        const unsigned char* literals,
+        size_t literal_length,
+        size_t offset,
+        size_t match_length)
+{
+    const size_t needed {1 + literal_length + literal_length / 255 + 1 +
+                         (0 < match_length ? 2 + match_length / 255 + 1 : 0)};
+
+    if (static_cast<size_t>(out_end - out) < needed)
+    {
+        return nullptr;
+    }
+
+    const size_t match_code {0 < match_length ? match_length - MIN_MATCH : 0};
+    *out++ = static_cast<unsigned char>((std::min(literal_length, TOKEN_LENGTH_MASK) << 4) |
+            std::min(match_code, TOKEN_LENGTH_MASK));
+    out = write_length_extension(out, literal_length);
+    memcpy(out, literals, literal_length);
+    out += literal_length;
+
+    if (0 < match_length)
+    {
+        *out++ = static_cast<unsigned char>(offset);
+        *out++ = static_cast<unsigned char>(offset >> 8);
+        out = write_length_extension(out, match_code);
+    }
+
+    return out;
+}
+
+/*!
+ * @brief Compresses a segment.
+ * @return Size of the compressed segment, or zero when it doesn't fit in the capacity.
+ */
+static size_t compress_segment(
+        const unsigned char* source,
+        size_t size,
+        unsigned char* destination,
+        size_t capacity)
+{
+    // Positions plus one of the last occurrence of each hash of four bytes. Zero when there is none.
+    std::array<uint32_t, size_t{1} << HASH_BITS> table;
+    table.fill(0);
+
+    unsigned char* out {destination};
+    const unsigned char* out_end {destination + capacity};
+    size_t anchor {0};
+    size_t position {0};
+
+    while (position + MIN_MATCH <= size)
+    {
+        const uint32_t word {read_word(source + position)};
+        uint32_t& entry {table[hash_word(word)]};
+        const size_t candidate {entry};
+        entry = static_cast<uint32_t>(position + 1);
+
+        // Segments are not longer than 64KiB, so any previous position is in reach of a 16 bits offset.
+        if (0 < candidate && read_word(source + candidate - 1) == word)
+        {
+            const size_t match {candidate - 1};
+            size_t length {MIN_MATCH};
+
+            while (position + length < size && source[match + length] == source[position + length])
+            {
+                ++length;
+            }
+
+            out = write_sequence(out, out_end, source + anchor, position - anchor, position - match, length);
+
+            if (nullptr == out)
+            {
+                return 0;
+            }
+
+            position += length;
+            anchor = position;
+        }
+        else
+        {
+            // Data without matches is skipped faster the longer it is.
+            position += 1 + ((position - anchor) >> 6);
+        }
+    }
+
+    if (anchor < size)
+    {
+        out = write_sequence(out, out_end, source + anchor, size - anchor, 0, 0);
+
+        if (nullptr == out)
+        {
+            return 0;
+        }
+    }
+
+    return static_cast<size_t>(out - destination);
+}
+
+//! Decompresses a segment, returning false when it is corrupted.
+static bool decompress_segment(
+        const unsigned char* in,
+        size_t in_size,
+        unsigned char* out,
+        size_t out_size)
+{
+    const unsigned char* in_end {in + in_size};
+    size_t produced {0};
+
+    while (produced < out_size)
+    {
+        if (in == in_end)
+        {
+            return false;
+        }
+
+        const unsigned char token {*in++};
+        size_t literal_length {static_cast<size_t>(token >> 4)};
+
+        if (!read_length_extension(in, in_end, literal_length) ||
+                literal_length > static_cast<size_t>(in_end - in) || literal_length > out_size - produced)
+        {
+            return false;
+        }
+
+        memcpy(out + produced, in, literal_length);
+        in += literal_length;
+        produced += literal_length;
+
+        if (produced == out_size)
+        {
+            break;
+        }
+
+        if (2 > in_end - in)
+        {
+            return false;
+        }
+
+        const size_t offset {static_cast<size_t>(in[0]) | static_cast<size_t>(in[1]) << 8};
+        in += 2;
+        size_t match_length {token & TOKEN_LENGTH_MASK};
+
+        if (!read_length_extension(in, in_end, match_length))
+        {
+            return false;
+        }
+
+        match_length += MIN_MATCH;
+
+        if (0 == offset || offset > produced || match_length > out_size - produced)
+        {
+            return false;
+        }
+
+        if (offset >= match_length)
+        {
+            memcpy(out + produced, out + produced - offset, match_length);
+        }
+        else
+        {
+            // Overlapping match repeating the last offset bytes.
+            for (size_t i = 0; i < match_length; ++i)
+            {
+                out[produced + i] = out[produced - offset + i];
+            }
+        }
+
+        produced += match_length;
+    }
+
+    return in == in_end;
+}
+
+bool is_compressed_payload(
+        const char* payload,
+        size_t size)
+{
+    return ENCAPSULATION_SIZE <= size &&
+           0 != (static_cast<uint8_t>(payload[2]) & COMPRESSED_PAYLOAD_OPTION);
+}
+
+size_t calculate_compressed_max_size(
+        size_t size)
+{
+    const size_t data_size {ENCAPSULATION_SIZE < size ? size - ENCAPSULATION_SIZE : 0};
+    const size_t num_segments {(data_size + COMPRESSION_SEGMENT_SIZE - 1) / COMPRESSION_SEGMENT_SIZE};
+    return ENCAPSULATION_SIZE + SIZE_FIELD_SIZE + num_segments * SIZE_FIELD_SIZE + data_size;
+}
+
+PayloadCompressor::PayloadCompressor(
+        char* destination,
+        size_t destination_size)
+    : destination_(destination)
+    , destination_size_(destination_size)
+    , length_(ENCAPSULATION_SIZE + SIZE_FIELD_SIZE)
+    , overflow_(length_ > destination_size)
+{
+    // Reserved once, so completing segments doesn't allocate.
+    pending_.reserve(COMPRESSION_SEGMENT_SIZE);
+}
+
+void PayloadCompressor::update(
+        const char* data,
+        size_t size)
+{
+    data_size_ += size;
+
+    if (!pending_.empty())
+    {
+        const size_t taken {std::min(size, COMPRESSION_SEGMENT_SIZE - pending_.size())};
+        pending_.insert(pending_.end(), data, data + taken);
+        data += taken;
+        size -= taken;
+
+        if (COMPRESSION_SEGMENT_SIZE == pending_.size())
+        {
+            write_segment(pending_.data(), pending_.size());
+            pending_.clear();
+        }
+    }
+
+    // Whole segments are compressed from where they were added, without copying them.
+    while (COMPRESSION_SEGMENT_SIZE <= size)
+    {
+        write_segment(data, COMPRESSION_SEGMENT_SIZE);
+        data += COMPRESSION_SEGMENT_SIZE;
+        size -= COMPRESSION_SEGMENT_SIZE;
+    }
+
+    pending_.insert(pending_.end(), data, data + size);
+}
+
+size_t PayloadCompressor::finish(
+        const char* encapsulation)
+{
+    if (is_compressed_payload(encapsulation, ENCAPSULATION_SIZE))
+    {
+        FASTCDR_THROW(exception::BadParamException("Payload already compressed"));
+    }
+
+    if (std::numeric_limits<uint32_t>::max() < data_size_)
+    {
+        FASTCDR_THROW(exception::BadParamException("Payload too big to be compressed"));
+    }
+
+    if (!pending_.empty())
+    {
+        write_segment(pending_.data(), pending_.size());
+        pending_.clear();
+    }
+
+    if (overflow_)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    unsigned char* out {reinterpret_cast<unsigned char*>(destination_)};
+    memcpy(out, encapsulation, ENCAPSULATION_SIZE);
+    out[2] = static_cast<unsigned char>(out[2] | COMPRESSED_PAYLOAD_OPTION);
+    write_uint32(out + ENCAPSULATION_SIZE, static_cast<uint32_t>(data_size_));
+    return length_;
+}
+
+void PayloadCompressor::write_segment(
+        const char* segment,
+        size_t segment_size)
+{
+    if (overflow_ || SIZE_FIELD_SIZE > destination_size_ - length_)
+    {
+        overflow_ = true;
+        return;
+    }
+
+    const unsigned char* in {reinterpret_cast<const unsigned char*>(segment)};
+    unsigned char* out {reinterpret_cast<unsigned char*>(destination_) + length_};
+    const size_t available {destination_size_ - length_ - SIZE_FIELD_SIZE};
+
+    // Compressing is only worth when the segment shrinks.
+    size_t segment_length {compress_segment(in, segment_size, out + SIZE_FIELD_SIZE,
+                               std::min(available, segment_size - 1))};
+    uint32_t header {static_cast<uint32_t>(segment_length)};
+
+    if (0 == segment_length)
+    {
+        if (segment_size > available)
+        {
+            overflow_ = true;
+            return;
+        }
+
+        memcpy(out + SIZE_FIELD_SIZE, in, segment_size);
+        segment_length = segment_size;
+        header = static_cast<uint32_t>(segment_size) | STORED_SEGMENT;
+    }
+
+    write_uint32(out, header);
+    length_ += SIZE_FIELD_SIZE + segment_length;
+}
+
+size_t compress_payload(
+        const char* payload,
+        size_t size,
+        char* destination,
+        size_t destination_size)
+{
+    if (ENCAPSULATION_SIZE > size)
+    {
+        FASTCDR_THROW(exception::BadParamException("Payload without encapsulation"));
+    }
+
+    PayloadCompressor compressor(destination, destination_size);
+    compressor.update(payload + ENCAPSULATION_SIZE, size - ENCAPSULATION_SIZE);
+    return compressor.finish(payload);
+}
+
+size_t calculate_decompressed_size(
+        const char* payload,
+        size_t size)
+{
+    if (!is_compressed_payload(payload, size) || ENCAPSULATION_SIZE + SIZE_FIELD_SIZE > size)
+    {
+        FASTCDR_THROW(exception::BadParamException("Payload not compressed"));
+    }
+
+    return ENCAPSULATION_SIZE +
+           read_uint32(reinterpret_cast<const unsigned char*>(payload) + ENCAPSULATION_SIZE);
+}
+
+size_t decompress_payload(
+        const char* payload,
+        size_t size,
+        char* destination,
+        size_t destination_size)
+{
+    const size_t decompressed_size {calculate_decompressed_size(payload, size)};
+
+    if (decompressed_size > destination_size)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    const unsigned char* in {reinterpret_cast<const unsigned char*>(payload)};
+    unsigned char* out {reinterpret_cast<unsigned char*>(destination)};
+
+    memcpy(out, in, ENCAPSULATION_SIZE);
+    out[2] = static_cast<unsigned char>(out[2] & ~COMPRESSED_PAYLOAD_OPTION);
+    size_t position {ENCAPSULATION_SIZE + SIZE_FIELD_SIZE};
+
+    for (size_t produced = ENCAPSULATION_SIZE; produced < decompressed_size;)
+    {
+        if (SIZE_FIELD_SIZE > size - position)
+        {
+            FASTCDR_THROW(exception::BadParamException("Compressed payload is truncated"));
+        }
+
+        const uint32_t header {read_uint32(in + position)};
+        position += SIZE_FIELD_SIZE;
+        const size_t segment_size {std::min(COMPRESSION_SEGMENT_SIZE, decompressed_size - produced)};
+        const size_t segment_length {header & ~STORED_SEGMENT};
+
+        if (segment_length > size - position)
+        {
+            FASTCDR_THROW(exception::BadParamException("Compressed payload is truncated"));
+        }
+
+        if (0 != (header & STORED_SEGMENT))
+        {
+            if (segment_length != segment_size)
+            {
+                FASTCDR_THROW(exception::BadParamException("Stored segment of wrong size"));
+            }
+
+            memcpy(out + produced, in + position, segment_size);
+        }
+        else if (!decompress_segment(in + position, segment_length, out + produced, segment_size))
+        {
+            FASTCDR_THROW(exception::BadParamException("Compressed segment is corrupted"));
+        }
+
+        position += segment_length;
+        produced += segment_size;
+    }
+
+    return decompressed_size;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
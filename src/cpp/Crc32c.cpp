@@ -0,0 +1,182 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+// The SSE4.2 instructions are used after checking at runtime the processor supports them, so the library doesn't have
+// to be built for SSE4.2.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <nmmintrin.h>
+#define FASTCDR_SSE42_CRC32C 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define FASTCDR_ARM_CRC32C 1
+#endif // if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+
+#include <fastcdr/Crc32c.hpp>
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Reversed Castagnoli polynomial.
+static constexpr uint32_t CRC32C_POLYNOMIAL {0x82F63B78u};
+
+//! Tables processing eight bytes at a time. Table k gives the CRC of a byte followed by k zero bytes.
+struct Crc32cTables
+{
+    Crc32cTables()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc {i};
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ ((0u - (crc & 1u)) & CRC32C_POLYNOMIAL);
+            }
+            table[0][i] = crc;
+        }
+
+        for (size_t k = 1; k < 8; ++k)
+        {
+            for (size_t i = 0; i < 256; ++i)
+            {
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+            }
+        }
+    }
+
+    uint32_t table[8][256];
+};
+
+static const Crc32cTables& crc32c_tables()
+{
+    static const Crc32cTables tables;
+    return tables;
+}
+
+static inline uint32_t load_le32(
+        const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+           static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+static uint32_t crc32c_table(
+        uint32_t crc,
+        const unsigned char* data,
+        size_t size)
+{
+    const auto& t = crc32c_tables().table;
+
+    while (8 <= size)
+    {
+        const uint32_t low {crc ^ load_le32(data)};
+        const uint32_t high {load_le32(data + 4)};
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+                t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+        data += 8;
+        size -= 8;
+    }
+
+    while (0 < size--)
+    {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+    }
+
+    return crc;
+}
+
+#if FASTCDR_SSE42_CRC32C
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hardware(
+        uint32_t crc,
+        const unsigned char* data,
+        size_t size)
+{
+    uint64_t crc64 {crc};
+
+    while (8 <= size)
+    {
+        uint64_t word {0};
+        memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+
+    crc = static_cast<uint32_t>(crc64);
+
+    while (0 < size--)
+    {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+
+    return crc;
+}
+
+static bool crc32c_hardware_supported()
+{
+    static const bool supported {0 != __builtin_cpu_supports("sse4.2")};
+    return supported;
+}
+
+#elif FASTCDR_ARM_CRC32C
+static uint32_t crc32c_hardware(
+        uint32_t crc,
+        const unsigned char* data,
+        size_t size)
+{
+    while (8 <= size)
+    {
+        uint64_t word {0};
+        memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+        data += 8;
+        size -= 8;
+    }
+
+    while (0 < size--)
+    {
+        crc = __crc32cb(crc, *data++);
+    }
+
+    return crc;
+}
+
+static bool crc32c_hardware_supported()
+{
+    return true;
+}
+
+#endif // if FASTCDR_SSE42_CRC32C
+
+void Crc32c::update(
+        const char* data,
+        size_t size)
+{
+    const unsigned char* bytes {reinterpret_cast<const unsigned char*>(data)};
+
+#if FASTCDR_SSE42_CRC32C || FASTCDR_ARM_CRC32C
+    if (crc32c_hardware_supported())
+    {
+        crc_ = crc32c_hardware(crc_, bytes, size);
+        return;
+    }
+#endif // if FASTCDR_SSE42_CRC32C || FASTCDR_ARM_CRC32C
+
+    crc_ = crc32c_table(crc_, bytes, size);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
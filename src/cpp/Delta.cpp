@@ -0,0 +1,352 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/Delta.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <fastcdr/config.h>
+#include <fastcdr/Crc32c.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Size of the header of a delta: the size and checksum of the previous sample and the size of the new one.
+static constexpr size_t HEADER_SIZE {12};
+
+//! Unchanged runs shorter than this are kept inside the changed range, as a new range would take as many bytes.
+static constexpr size_t MERGE_GAP {8};
+
+//! Maximum size of a varint storing a 32 bits value.
+static constexpr size_t MAX_VARINT_SIZE {5};
+
+static void write_uint32(
+        unsigned char* data,
+        uint32_t value)
+{
+    data[0] = static_cast<unsigned char>(value);
+    data[1] = static_cast<unsigned char>(value >> 8);
+    data[2] = static_cast<unsigned char>(value >> 16);
+    data[3] = static_cast<unsigned char>(value >> 24);
+}
+
+static uint32_t read_uint32(
+        const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+           static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+static size_t varint_size(
+        size_t value)
+{
+    size_t size {1};
+
+    while (0x80u <= value)
+    {
+        value >>= 7;
+        ++size;
+    }
+
+    return size;
+}
+
+static unsigned char* write_varint(
+        unsigned char* data,
+        size_t value)
+{
+    while (0x80u <= value)
+    {
+        *data++ = static_cast<unsigned char>(value | 0x80u);
+        value >>= 7;
+    }
+
+    *data++ = static_cast<unsigned char>(value);
+    return data;
+}
+
+//! Reads a varint storing a 32 bits value, returning false when it is truncated or too long.
+static bool read_varint(
+        const unsigned char*& data,
+        const unsigned char* end,
+        size_t& value)
+{
+    value = 0;
+
+    for (unsigned shift {0}; MAX_VARINT_SIZE * 7 > shift; shift += 7)
+    {
+        if (end == data)
+        {
+            return false;
+        }
+
+        const unsigned char byte {*data++};
+        value |= static_cast<size_t>(byte & 0x7Fu) << shift;
+
+        if (0 == (byte & 0x80u))
+        {
+            return std::numeric_limits<uint32_t>::max() >= value;
+        }
+    }
+
+    return false;
+}
+
+//! Returns the first position in [position, end) where the samples differ, or end.
+static size_t find_difference(
+        const char* previous,
+        const char* sample,
+        size_t position,
+        size_t end)
+{
+    while (end - position >= sizeof(uint64_t))
+    {
+        uint64_t previous_word {0};
+        uint64_t sample_word {0};
+        memcpy(&previous_word, previous + position, sizeof(previous_word));
+        memcpy(&sample_word, sample + position, sizeof(sample_word));
+
+        if (previous_word != sample_word)
+        {
+            break;
+        }
+
+        position += sizeof(uint64_t);
+    }
+
+    while (end > position && previous[position] == sample[position])
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+//! Returns the first position in [position, end) where the samples are equal, or end.
+static size_t find_equality(
+        const char* previous,
+        const char* sample,
+        size_t position,
+        size_t end)
+{
+    while (end > position && previous[position] != sample[position])
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+/*!
+ * Calls the visitor with the begin and end of each range of the new sample which has to be sent, in order. The bytes
+ * beyond the end of the previous sample are always sent.
+ */
+template<class _Visitor>
+static void visit_changed_ranges(
+        const char* previous,
+        size_t previous_size,
+        const char* sample,
+        size_t size,
+        _Visitor visitor)
+{
+    const size_t common_size {std::min(previous_size, size)};
+    size_t position {find_difference(previous, sample, 0, common_size)};
+
+    while (common_size > position)
+    {
+        const size_t begin {position};
+        size_t end {0};
+
+        do
+        {
+            end = find_equality(previous, sample, position, common_size);
+            position = find_difference(previous, sample, end, common_size);
+        } while (common_size > position && MERGE_GAP > position - end);
+
+        if (common_size == position && size > common_size && MERGE_GAP > common_size - end)
+        {
+            visitor(begin, size);
+            return;
+        }
+
+        visitor(begin, end);
+    }
+
+    if (size > common_size)
+    {
+        visitor(common_size, size);
+    }
+}
+
+size_t calculate_delta_max_size(
+        size_t size)
+{
+    return HEADER_SIZE + 1 + varint_size(size) + size;
+}
+
+size_t encode_delta(
+        const char* previous,
+        size_t previous_size,
+        const char* sample,
+        size_t size,
+        char* destination,
+        size_t destination_size)
+{
+    if (std::numeric_limits<uint32_t>::max() < previous_size || std::numeric_limits<uint32_t>::max() < size)
+    {
+        FASTCDR_THROW(exception::BadParamException("Samples greater than 4 GiB can't be delta encoded"));
+    }
+
+    size_t delta_size {HEADER_SIZE};
+    size_t last_end {0};
+    visit_changed_ranges(previous, previous_size, sample, size,
+            [&delta_size, &last_end](size_t begin, size_t end)
+            {
+                delta_size += varint_size(begin - last_end) + varint_size(end - begin) + end - begin;
+                last_end = end;
+            });
+
+    // Sends the whole sample when the changed ranges would take more.
+    const size_t whole_size {0 < size ? HEADER_SIZE + 1 + varint_size(size) + size : HEADER_SIZE};
+    const bool whole_sample {whole_size < delta_size};
+
+    if (whole_sample)
+    {
+        delta_size = whole_size;
+    }
+
+    if (destination_size < delta_size)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    Crc32c checksum;
+    checksum.update(previous, previous_size);
+    unsigned char* out {reinterpret_cast<unsigned char*>(destination)};
+    write_uint32(out, static_cast<uint32_t>(previous_size));
+    write_uint32(out + 4, checksum.value());
+    write_uint32(out + 8, static_cast<uint32_t>(size));
+    out += HEADER_SIZE;
+
+    if (whole_sample)
+    {
+        out = write_varint(out, 0);
+        out = write_varint(out, size);
+        memcpy(out, sample, size);
+    }
+    else
+    {
+        last_end = 0;
+        visit_changed_ranges(previous, previous_size, sample, size,
+                [&out, &last_end, sample](size_t begin, size_t end)
+                {
+                    out = write_varint(out, begin - last_end);
+                    out = write_varint(out, end - begin);
+                    memcpy(out, sample + begin, end - begin);
+                    out += end - begin;
+                    last_end = end;
+                });
+    }
+
+    return delta_size;
+}
+
+size_t calculate_delta_sample_size(
+        const char* delta,
+        size_t delta_size)
+{
+    if (HEADER_SIZE > delta_size)
+    {
+        FASTCDR_THROW(exception::BadParamException("The delta is truncated"));
+    }
+
+    return read_uint32(reinterpret_cast<const unsigned char*>(delta) + 8);
+}
+
+size_t apply_delta(
+        const char* delta,
+        size_t delta_size,
+        char* sample,
+        size_t size,
+        size_t capacity)
+{
+    const size_t new_size {calculate_delta_sample_size(delta, delta_size)};
+    const unsigned char* const begin {reinterpret_cast<const unsigned char*>(delta)};
+    const unsigned char* const end {begin + delta_size};
+
+    Crc32c checksum;
+    checksum.update(sample, size);
+
+    if (read_uint32(begin) != size || read_uint32(begin + 4) != checksum.value())
+    {
+        FASTCDR_THROW(exception::BadParamException("The delta was not calculated from this sample"));
+    }
+
+    if (capacity < new_size)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    // Checks the whole delta before modifying the sample. The skipped bytes are kept from the previous sample, so
+    // they have to be inside it.
+    const unsigned char* in {begin + HEADER_SIZE};
+    size_t position {0};
+
+    while (end != in)
+    {
+        size_t skip {0};
+        size_t length {0};
+
+        if (!read_varint(in, end, skip) || !read_varint(in, end, length) || 0 == length ||
+                size < position + skip || new_size < position + skip || new_size - position - skip < length ||
+                static_cast<size_t>(end - in) < length)
+        {
+            FASTCDR_THROW(exception::BadParamException("The delta is corrupted"));
+        }
+
+        in += length;
+        position += skip + length;
+    }
+
+    if (size < new_size && new_size != position)
+    {
+        FASTCDR_THROW(exception::BadParamException("The delta is corrupted"));
+    }
+
+    in = begin + HEADER_SIZE;
+    position = 0;
+
+    while (end != in)
+    {
+        size_t skip {0};
+        size_t length {0};
+        read_varint(in, end, skip);
+        read_varint(in, end, length);
+        position += skip;
+        memcpy(sample + position, in, length);
+        in += length;
+        position += length;
+    }
+
+    return new_size;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
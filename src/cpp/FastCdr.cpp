@@ -12,6 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FASTCDR_SSE2 1
+#endif // if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <algorithm>
+
 #include <fastcdr/FastCdr.h>
 #include <fastcdr/exceptions/BadParamException.h>
 #include <string.h>
@@ -19,6 +26,92 @@
 using namespace eprosima::fastcdr;
 using namespace ::exception;
 
+//! Returns how many of the leading bytes, up to a limit, are varints of one byte.
+static size_t count_single_byte_varints(
+        const char* data,
+        size_t limit)
+{
+    size_t count = 0;
+
+#if FASTCDR_SSE2
+    while (count + 16 <= limit)
+    {
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count))));
+
+        if (0 != mask)
+        {
+#if defined(__GNUC__)
+            return count + static_cast<size_t>(__builtin_ctz(mask));
+#else
+            while (0 == (mask & 1u))
+            {
+                mask >>= 1;
+                ++count;
+            }
+            return count;
+#endif // if defined(__GNUC__)
+        }
+
+        count += 16;
+    }
+#endif // if FASTCDR_SSE2
+
+    while (count + 8 <= limit)
+    {
+        uint64_t word = 0;
+        memcpy(&word, data + count, sizeof(word));
+
+        if (0 != (word & 0x8080808080808080ull))
+        {
+            break;
+        }
+
+        count += 8;
+    }
+
+    while (count < limit && 0 == (data[count] & 0x80))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+//! Converts a decoded varint to the integer type, reverting the zigzag encoding of signed types.
+template<class _T>
+static inline _T varint_to_integer(
+        uint64_t value,
+        std::true_type /*is_signed*/)
+{
+    return FastCdr::zigzag_decode<_T>(static_cast<typename std::make_unsigned<_T>::type>(value));
+}
+
+template<class _T>
+static inline _T varint_to_integer(
+        uint64_t value,
+        std::false_type /*is_signed*/)
+{
+    return static_cast<_T>(value);
+}
+
+//! Converts an integer to the value encoded as varint, applying the zigzag encoding to signed types.
+template<class _T>
+static inline uint64_t integer_to_varint(
+        _T value,
+        std::true_type /*is_signed*/)
+{
+    return FastCdr::zigzag_encode(value);
+}
+
+template<class _T>
+static inline uint64_t integer_to_varint(
+        _T value,
+        std::false_type /*is_signed*/)
+{
+    return value;
+}
+
 FastCdr::state::state(
         const FastCdr& fastcdr)
     : current_position_(fastcdr.current_position_)
@@ -39,6 +132,21 @@ FastCdr::FastCdr(
 {
 }
 
+FastCdr::FastCdr(
+        FastBuffer& cdr_buffer,
+        IntegerEncoding integer_encoding)
+    : cdr_buffer_(cdr_buffer)
+    , current_position_(cdr_buffer.begin())
+    , last_position_(cdr_buffer.end())
+    , integer_encoding_(integer_encoding)
+{
+}
+
+FastCdr::IntegerEncoding FastCdr::get_integer_encoding() const
+{
+    return integer_encoding_;
+}
+
 bool FastCdr::jump(
         size_t num_bytes)
 {
@@ -87,6 +195,166 @@ bool FastCdr::resize(
     return false;
 }
 
+FastCdr& FastCdr::serialize_varint(
+        uint64_t value)
+{
+    size_t size = varint_size(value);
+
+    if (((last_position_ - current_position_) >= size) || resize(size))
+    {
+        char* data = &current_position_;
+
+        while (0x80u <= value)
+        {
+            *data++ = static_cast<char>(value | 0x80u);
+            value >>= 7;
+        }
+
+        *data = static_cast<char>(value);
+        current_position_ += size;
+
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+uint64_t FastCdr::deserialize_varint(
+        uint64_t max_value)
+{
+    const char* data = &current_position_;
+    size_t available = last_position_ - current_position_;
+    uint64_t value = 0;
+    size_t size = 0;
+
+    for (unsigned int shift = 0;; shift += 7)
+    {
+        if (size == available)
+        {
+            throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+        }
+
+        uint8_t byte = static_cast<uint8_t>(data[size++]);
+
+        if (63 < shift || (63 == shift && 1 < byte))
+        {
+            throw BadParamException("Varint exceeds 64 bits");
+        }
+
+        value |= static_cast<uint64_t>(byte & 0x7Fu) << shift;
+
+        if (0 == (byte & 0x80u))
+        {
+            break;
+        }
+    }
+
+    if (value > max_value)
+    {
+        throw BadParamException("Varint exceeds the range of its type");
+    }
+
+    current_position_ += size;
+    return value;
+}
+
+template<class _T>
+FastCdr& FastCdr::serialize_varints(
+        const _T* values,
+        size_t num_elements)
+{
+    size_t total_size = 0;
+
+    for (size_t count = 0; count < num_elements; ++count)
+    {
+        total_size += varint_size(integer_to_varint(values[count], std::is_signed<_T>()));
+    }
+
+    if (((last_position_ - current_position_) >= total_size) || resize(total_size))
+    {
+        char* data = &current_position_;
+
+        for (size_t count = 0; count < num_elements; ++count)
+        {
+            uint64_t value = integer_to_varint(values[count], std::is_signed<_T>());
+
+            while (0x80u <= value)
+            {
+                *data++ = static_cast<char>(value | 0x80u);
+                value >>= 7;
+            }
+
+            *data++ = static_cast<char>(value);
+        }
+
+        current_position_ += total_size;
+        return *this;
+    }
+
+    throw NotEnoughMemoryException(NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+}
+
+template<class _T>
+FastCdr& FastCdr::deserialize_varints(
+        _T* values,
+        size_t num_elements)
+{
+    using unsigned_type = typename std::make_unsigned<_T>::type;
+    state state_before_error(*this);
+
+    try
+    {
+        size_t count = 0;
+
+        while (count < num_elements)
+        {
+            const char* data = &current_position_;
+            size_t available = last_position_ - current_position_;
+            size_t run = count_single_byte_varints(data, std::min(available, num_elements - count));
+
+            for (size_t idx = 0; idx < run; ++idx)
+            {
+                values[count + idx] = varint_to_integer<_T>(static_cast<uint8_t>(data[idx]), std::is_signed<_T>());
+            }
+
+            current_position_ += run;
+            count += run;
+
+            if (count < num_elements)
+            {
+                values[count++] = varint_to_integer<_T>(deserialize_varint(std::numeric_limits<unsigned_type>::max()),
+                                std::is_signed<_T>());
+            }
+        }
+    }
+    catch (eprosima::fastcdr::exception::Exception& ex)
+    {
+        set_state(state_before_error);
+        ex.raise();
+    }
+
+    return *this;
+}
+
+template FastCdr& FastCdr::serialize_varints<uint16_t>(
+        const uint16_t*,
+        size_t);
+template FastCdr& FastCdr::serialize_varints<uint32_t>(
+        const uint32_t*,
+        size_t);
+template FastCdr& FastCdr::serialize_varints<uint64_t>(
+        const uint64_t*,
+        size_t);
+template FastCdr& FastCdr::deserialize_varints<uint16_t>(
+        uint16_t*,
+        size_t);
+template FastCdr& FastCdr::deserialize_varints<uint32_t>(
+        uint32_t*,
+        size_t);
+template FastCdr& FastCdr::deserialize_varints<uint64_t>(
+        uint64_t*,
+        size_t);
+
 FastCdr& FastCdr::serialize(
         const bool bool_t)
 {
@@ -152,7 +420,22 @@ FastCdr& FastCdr::serialize(
         bytes_length = size_to_uint32(wstrlen * 4);
     }
 
-    if (bytes_length > 0)
+    if (bytes_length > 0 && IntegerEncoding::VARINT == integer_encoding_)
+    {
+        FastCdr::state state_(*this);
+        serialize(size_to_uint32(wstrlen));
+
+        try
+        {
+            serialize_array(string_t, wstrlen);
+        }
+        catch (eprosima::fastcdr::exception::Exception& ex)
+        {
+            set_state(state_);
+            ex.raise();
+        }
+    }
+    else if (bytes_length > 0)
     {
         FastCdr::state state_(*this);
         serialize(size_to_uint32(wstrlen));
@@ -225,6 +508,11 @@ FastCdr& FastCdr::serialize_array(
         const int16_t* short_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return serialize_varints(short_t, num_elements);
+    }
+
     size_t total_size = sizeof(*short_t) * num_elements;
 
     if (((last_position_ - current_position_) >= total_size) || resize(total_size))
@@ -242,6 +530,11 @@ FastCdr& FastCdr::serialize_array(
         const int32_t* long_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return serialize_varints(long_t, num_elements);
+    }
+
     size_t total_size = sizeof(*long_t) * num_elements;
 
     if (((last_position_ - current_position_) >= total_size) || resize(total_size))
@@ -270,6 +563,11 @@ FastCdr& FastCdr::serialize_array(
         const int64_t* longlong_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return serialize_varints(longlong_t, num_elements);
+    }
+
     size_t total_size = sizeof(*longlong_t) * num_elements;
 
     if (((last_position_ - current_position_) >= total_size) || resize(total_size))
@@ -424,6 +722,27 @@ FastCdr& FastCdr::deserialize(
         string_t = NULL;
         return *this;
     }
+    else if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        // Each character takes one byte at least.
+        if ((last_position_ - current_position_) >= length)
+        {
+            string_t = reinterpret_cast<wchar_t*>(calloc(length + 1, sizeof(wchar_t)));
+
+            try
+            {
+                deserialize_array(string_t, length);
+                return *this;
+            }
+            catch (eprosima::fastcdr::exception::Exception& ex)
+            {
+                free(string_t);
+                string_t = NULL;
+                set_state(state_before_error);
+                ex.raise();
+            }
+        }
+    }
     else if ((last_position_ - current_position_) >= length)
     {
         // Allocate memory.
@@ -484,7 +803,8 @@ std::wstring FastCdr::read_wstring(
     state state_(*this);
 
     *this >> length;
-    uint32_t bytes_length = length * 4;
+    // Each character takes one byte at least when encoded as varint.
+    uint32_t bytes_length = IntegerEncoding::VARINT == integer_encoding_ ? length : length * 4;
 
     if (bytes_length == 0)
     {
@@ -494,7 +814,17 @@ std::wstring FastCdr::read_wstring(
     {
 
         ret_value.resize(length);
-        deserialize_array(const_cast<wchar_t*>(ret_value.c_str()), length);
+
+        try
+        {
+            deserialize_array(const_cast<wchar_t*>(ret_value.c_str()), length);
+        }
+        catch (eprosima::fastcdr::exception::Exception& ex)
+        {
+            set_state(state_);
+            ex.raise();
+        }
+
         if (ret_value[length - 1] == L'\0')
         {
             --length;
@@ -557,6 +887,11 @@ FastCdr& FastCdr::deserialize_array(
         int16_t* short_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return deserialize_varints(short_t, num_elements);
+    }
+
     size_t total_size = sizeof(*short_t) * num_elements;
 
     if ((last_position_ - current_position_) >= total_size)
@@ -574,6 +909,11 @@ FastCdr& FastCdr::deserialize_array(
         int32_t* long_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return deserialize_varints(long_t, num_elements);
+    }
+
     size_t total_size = sizeof(*long_t) * num_elements;
 
     if ((last_position_ - current_position_) >= total_size)
@@ -604,6 +944,11 @@ FastCdr& FastCdr::deserialize_array(
         int64_t* longlong_t,
         size_t num_elements)
 {
+    if (IntegerEncoding::VARINT == integer_encoding_)
+    {
+        return deserialize_varints(longlong_t, num_elements);
+    }
+
     size_t total_size = sizeof(*longlong_t) * num_elements;
 
     if ((last_position_ - current_position_) >= total_size)
@@ -696,7 +1041,7 @@ FastCdr& FastCdr::serialize_bool_sequence(
 {
     state state_before_error(*this);
 
-    *this << static_cast<int32_t>(vector_t.size());
+    *this << static_cast<uint32_t>(vector_t.size());
 
     size_t total_size = vector_t.size() * sizeof(bool);
 
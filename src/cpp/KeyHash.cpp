@@ -0,0 +1,236 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/KeyHash.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+//! Sines of RFC 1321.
+static const uint32_t MD5_SINES[64] {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+//! Shifts of each round of RFC 1321.
+static const uint32_t MD5_SHIFTS[16] {
+    7, 12, 17, 22,
+    5, 9, 14, 20,
+    4, 11, 16, 23,
+    6, 10, 15, 21
+};
+
+//! Alignment of the window kept between members, the greatest one of the encoding.
+static constexpr size_t WINDOW_ALIGNMENT {8};
+
+//! Initial size of the window.
+static constexpr size_t WINDOW_SIZE {256};
+
+KeyHash::KeyHash(
+        size_t max_serialized_key_size)
+    : use_md5_(HASH_SIZE < max_serialized_key_size)
+    , window_(WINDOW_SIZE, 0)
+    , window_buffer_(window_.data(), window_.size())
+{
+    reset();
+}
+
+void KeyHash::finish(
+        std::array<uint8_t, HASH_SIZE>& key_hash)
+{
+    if (use_md5_)
+    {
+        const uint64_t length_in_bits {length_ * 8};
+        const uint8_t padding {0x80};
+        update(&padding, 1);
+
+        while (56 != length_ % 64)
+        {
+            const uint8_t zero {0};
+            update(&zero, 1);
+        }
+
+        for (size_t byte {0}; byte < 8; ++byte)
+        {
+            block_[56 + byte] = static_cast<uint8_t>(length_in_bits >> (byte * 8));
+        }
+
+        transform(block_.data());
+
+        for (size_t word {0}; word < md5_state_.size(); ++word)
+        {
+            for (size_t byte {0}; byte < 4; ++byte)
+            {
+                key_hash[word * 4 + byte] = static_cast<uint8_t>(md5_state_[word] >> (byte * 8));
+            }
+        }
+    }
+    else
+    {
+        memcpy(key_hash.data(), block_.data(), HASH_SIZE);
+    }
+
+    reset();
+}
+
+void KeyHash::reset()
+{
+    // A member which threw while being encoded may have left its bytes in the window.
+    memset(window_.data(), 0, window_.size());
+    hashed_ = 0;
+    length_ = 0;
+    md5_state_ = {{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476}};
+    block_.fill(0);
+}
+
+bool KeyHash::consume(
+        Cdr& cdr)
+{
+    const size_t serialized_length {cdr.get_serialized_data_length()};
+
+    if (Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY == cdr.get_error())
+    {
+        // The member is encoded again from the same alignment into a greater window.
+        window_.assign(window_.size() * 2, 0);
+        window_buffer_ = FastBuffer(window_.data(), window_.size());
+        return false;
+    }
+    else if (Cdr::CDR_ERROR_NONE != cdr.get_error())
+    {
+        const char* message {cdr.get_error_message()};
+        reset();
+        FASTCDR_THROW(exception::BadParamException(message));
+    }
+
+    update(reinterpret_cast<const uint8_t*>(window_.data()) + hashed_, serialized_length - hashed_);
+
+    // Padding is not written by the encoder, so the window is zeroed for the next member. It is rewound keeping the
+    // position of the next member relative to the greatest alignment.
+    memset(window_.data(), 0, serialized_length);
+    hashed_ = serialized_length % WINDOW_ALIGNMENT;
+    return true;
+}
+
+void KeyHash::update(
+        const uint8_t* data,
+        size_t size)
+{
+    if (!use_md5_)
+    {
+        if (HASH_SIZE - length_ < size)
+        {
+            reset();
+            FASTCDR_THROW(exception::BadParamException("Serialized key greater than its maximum size"));
+        }
+
+        memcpy(block_.data() + length_, data, size);
+        length_ += size;
+        return;
+    }
+
+    while (0 < size)
+    {
+        const size_t position {length_ % 64};
+        const size_t copied {std::min(size, block_.size() - position)};
+        memcpy(block_.data() + position, data, copied);
+        length_ += copied;
+        data += copied;
+        size -= copied;
+
+        if (0 == length_ % 64)
+        {
+            transform(block_.data());
+        }
+    }
+}
+
+void KeyHash::transform(
+        const uint8_t* block)
+{
+    uint32_t words[16];
+
+    for (size_t word {0}; word < 16; ++word)
+    {
+        words[word] = static_cast<uint32_t>(block[word * 4]) |
+                (static_cast<uint32_t>(block[word * 4 + 1]) << 8) |
+                (static_cast<uint32_t>(block[word * 4 + 2]) << 16) |
+                (static_cast<uint32_t>(block[word * 4 + 3]) << 24);
+    }
+
+    uint32_t a {md5_state_[0]};
+    uint32_t b {md5_state_[1]};
+    uint32_t c {md5_state_[2]};
+    uint32_t d {md5_state_[3]};
+
+    for (size_t step {0}; step < 64; ++step)
+    {
+        uint32_t function {0};
+        size_t word {0};
+
+        switch (step / 16)
+        {
+            case 0:
+                function = (b & c) | (~b & d);
+                word = step;
+                break;
+            case 1:
+                function = (d & b) | (~d & c);
+                word = (5 * step + 1) % 16;
+                break;
+            case 2:
+                function = b ^ c ^ d;
+                word = (3 * step + 5) % 16;
+                break;
+            default:
+                function = c ^ (b | ~d);
+                word = (7 * step) % 16;
+                break;
+        }
+
+        function += a + MD5_SINES[step] + words[word];
+        a = d;
+        d = c;
+        c = b;
+        const uint32_t shift {MD5_SHIFTS[(step / 16) * 4 + step % 4]};
+        b += (function << shift) | (function >> (32 - shift));
+    }
+
+    md5_state_[0] += a;
+    md5_state_[1] += b;
+    md5_state_[2] += c;
+    md5_state_[3] += d;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
@@ -0,0 +1,74 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/SerializationPlan.hpp>
+
+namespace eprosima {
+namespace fastcdr {
+
+SerializationPlan::SerializationPlan(
+        CdrVersion cdr_version,
+        size_t initial_alignment)
+    : align64_(CdrVersion::XCDRv2 == cdr_version ? 4 : 8)
+    , initial_alignment_(initial_alignment)
+{
+}
+
+void SerializationPlan::add(
+        size_t source_offset,
+        size_t width,
+        size_t num_elements,
+        bool boolean)
+{
+    if (0 == num_elements)
+    {
+        // Empty arrays are not aligned.
+        return;
+    }
+
+    const size_t data_size {8 == width ? align64_ : width};
+    const size_t position {initial_alignment_ + serialized_size_};
+    const size_t padding {(data_size - (position % data_size)) & (data_size - 1)};
+
+    if (max_alignment_ < data_size)
+    {
+        max_alignment_ = data_size;
+    }
+
+    if (0 == padding && !operations_.empty())
+    {
+        Operation& last = operations_.back();
+
+        if (last.width == width && last.boolean == boolean &&
+                last.source_offset + last.width * last.num_elements == source_offset)
+        {
+            last.num_elements += num_elements;
+            serialized_size_ += width * num_elements;
+            return;
+        }
+    }
+
+    Operation operation;
+    operation.source_offset = source_offset;
+    operation.wire_offset = serialized_size_ + padding;
+    operation.width = width;
+    operation.num_elements = num_elements;
+    operation.swap = 1 < width;
+    operation.boolean = boolean;
+    operations_.push_back(operation);
+    serialized_size_ += padding + width * num_elements;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
@@ -0,0 +1,53 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/Comparison.hpp>
+
+namespace eprosima {
+namespace fastcdr {
+
+bool equals(
+        const char* first,
+        size_t first_size,
+        const char* second,
+        size_t second_size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type)
+{
+    FastBuffer first_buffer(const_cast<char*>(first), first_size);
+    Cdr first_cdr(first_buffer);
+    interpreter.read_encapsulation(first_cdr, type);
+
+    FastBuffer second_buffer(const_cast<char*>(second), second_size);
+    Cdr second_cdr(second_buffer);
+    interpreter.read_encapsulation(second_cdr, type);
+
+    return interpreter.equals(first_cdr, second_cdr, type);
+}
+
+uint64_t hash(
+        const char* buffer,
+        size_t size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type)
+{
+    FastBuffer fast_buffer(const_cast<char*>(buffer), size);
+    Cdr cdr(fast_buffer);
+    interpreter.read_encapsulation(cdr, type);
+
+    return interpreter.hash(cdr, type);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
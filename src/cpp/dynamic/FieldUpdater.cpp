@@ -0,0 +1,304 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/FieldUpdater.hpp>
+
+#include <cstring>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+namespace {
+
+//! Size of the encapsulation of a payload.
+constexpr size_t ENCAPSULATION_SIZE {4};
+
+//! Returns the offset once aligned, relative to the end of the encapsulation.
+size_t align(
+        size_t offset,
+        size_t alignment)
+{
+    return offset + ((alignment - (offset % alignment)) & (alignment - 1));
+}
+
+//! Returns the kind and the total number of primitives of an array of primitives, looking through nested arrays.
+TypeKind flatten_array(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex index,
+        size_t& num_elements)
+{
+    num_elements = 1;
+    const TypeDescription::Type* type {&description.type(index)};
+
+    while (TypeKind::ARRAY == type->kind)
+    {
+        num_elements *= type->bound;
+        type = &description.type(type->element);
+    }
+
+    return type->kind;
+}
+
+} // namespace
+
+FieldUpdater::FieldUpdater(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version)
+    : description_(description)
+    , type_(type)
+    , cdr_version_(cdr_version)
+{
+    if (CdrVersion::XCDRv1 != cdr_version && CdrVersion::XCDRv2 != cdr_version)
+    {
+        FASTCDR_THROW(exception::BadParamException("Only XCDRv1 and XCDRv2 payloads can be updated"));
+    }
+
+    if (description_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("The type doesn't exist"));
+    }
+
+    encoding_ = TypeDescription::encoding(cdr_version, TypeKind::STRUCTURE == description_.type(type).kind ?
+                    description_.type(type).extensibility : Extensibility::FINAL);
+    serialized_size_ = ENCAPSULATION_SIZE + skip_type(type, 0);
+}
+
+const FieldUpdater::Location& FieldUpdater::locate(
+        const std::vector<uint32_t>& path)
+{
+    auto cached = locations_.find(path);
+
+    if (locations_.end() != cached)
+    {
+        return cached->second;
+    }
+
+    TypeDescription::TypeIndex index {type_};
+    size_t offset {0};
+
+    for (const uint32_t step : path)
+    {
+        const TypeDescription::Type& type {description_.type(index)};
+
+        if (TypeKind::STRUCTURE == type.kind)
+        {
+            if (CdrVersion::XCDRv2 == cdr_version_ && Extensibility::APPENDABLE == type.extensibility)
+            {
+                // DHEADER
+                offset = align(offset, 4) + 4;
+            }
+
+            const TypeDescription::Member* member {nullptr};
+
+            for (uint32_t position {0}; position < type.member_count; ++position)
+            {
+                const TypeDescription::Member& current {description_.member(type, position)};
+
+                if (current.id.id == step)
+                {
+                    member = &current;
+                    break;
+                }
+
+                offset = skip_type(current.type, offset);
+            }
+
+            if (nullptr == member)
+            {
+                FASTCDR_THROW(exception::BadParamException(
+                            "The structure has no member with the identifier of the path"));
+            }
+
+            index = member->type;
+        }
+        else if (TypeKind::ARRAY == type.kind)
+        {
+            if (type.bound <= step)
+            {
+                FASTCDR_THROW(exception::BadParamException("The index of the path is out of the bounds of the array"));
+            }
+
+            if (CdrVersion::XCDRv2 == cdr_version_ && !description_.is_multi_array_primitive(index))
+            {
+                // DHEADER
+                offset = align(offset, 4) + 4;
+            }
+
+            for (uint32_t position {0}; position < step; ++position)
+            {
+                offset = skip_type(type.element, offset);
+            }
+
+            index = type.element;
+        }
+        else
+        {
+            FASTCDR_THROW(exception::BadParamException(
+                        "The path goes into a type which is neither a structure nor an array"));
+        }
+    }
+
+    Location location;
+
+    if (TypeDescription::is_primitive(description_.type(index).kind))
+    {
+        location.kind = description_.type(index).kind;
+    }
+    else if (TypeKind::ARRAY == description_.type(index).kind && description_.is_multi_array_primitive(index))
+    {
+        location.kind = flatten_array(description_, index, location.num_elements);
+    }
+    else
+    {
+        FASTCDR_THROW(exception::BadParamException("Only primitives and arrays of primitives can be updated"));
+    }
+
+    location.offset = ENCAPSULATION_SIZE + align(offset, primitive_alignment(location.kind));
+    return locations_.emplace(path, location).first->second;
+}
+
+void FieldUpdater::write(
+        char* payload,
+        size_t size,
+        const Location& location,
+        const char* values,
+        size_t width,
+        size_t num_elements) const
+{
+    if (TypeDescription::primitive_size(location.kind) != width || location.num_elements != num_elements)
+    {
+        FASTCDR_THROW(exception::BadParamException("The values don't match the field"));
+    }
+
+    if (size < location.offset + width * num_elements)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    // The encapsulation byte follows the dummy byte written by Cdr::serialize_encapsulation.
+    const uint8_t encapsulation {static_cast<uint8_t>(payload[1])};
+
+    if (encoding_ != (encapsulation & 0xFEu))
+    {
+        FASTCDR_THROW(exception::BadParamException("Encapsulation doesn't match the CDR version and the type"));
+    }
+
+#if FASTCDR_IS_BIG_ENDIAN_TARGET
+    const bool swap {0 != (encapsulation & 0x1u)};
+#else
+    const bool swap {0 == (encapsulation & 0x1u)};
+#endif // if FASTCDR_IS_BIG_ENDIAN_TARGET
+    char* field {payload + location.offset};
+
+    if (!swap || 1 == width)
+    {
+        memcpy(field, values, width * num_elements);
+        return;
+    }
+
+    for (size_t element {0}; element < num_elements; ++element)
+    {
+        for (size_t byte {0}; byte < width; ++byte)
+        {
+            field[byte] = values[width - 1 - byte];
+        }
+
+        field += width;
+        values += width;
+    }
+}
+
+size_t FieldUpdater::primitive_alignment(
+        TypeKind kind) const
+{
+    const size_t size {TypeDescription::primitive_size(kind)};
+
+    if (8 > size)
+    {
+        return size;
+    }
+
+    // 64 bits members and long doubles are aligned to 4 in XCDRv2.
+    return CdrVersion::XCDRv2 == cdr_version_ ? 4 : 8;
+}
+
+size_t FieldUpdater::skip_type(
+        TypeDescription::TypeIndex index,
+        size_t offset) const
+{
+    const TypeDescription::Type& type {description_.type(index)};
+
+    if (TypeDescription::is_primitive(type.kind))
+    {
+        return align(offset, primitive_alignment(type.kind)) + TypeDescription::primitive_size(type.kind);
+    }
+
+    if (TypeKind::ARRAY == type.kind)
+    {
+        if (description_.is_multi_array_primitive(index))
+        {
+            size_t num_elements {0};
+            const TypeKind kind {flatten_array(description_, index, num_elements)};
+            return align(offset, primitive_alignment(kind)) + num_elements * TypeDescription::primitive_size(kind);
+        }
+
+        if (CdrVersion::XCDRv2 == cdr_version_)
+        {
+            // DHEADER
+            offset = align(offset, 4) + 4;
+        }
+
+        for (uint32_t position {0}; position < type.bound; ++position)
+        {
+            offset = skip_type(type.element, offset);
+        }
+
+        return offset;
+    }
+
+    if (TypeKind::STRUCTURE == type.kind && Extensibility::MUTABLE != type.extensibility)
+    {
+        if (CdrVersion::XCDRv2 == cdr_version_ && Extensibility::APPENDABLE == type.extensibility)
+        {
+            // DHEADER
+            offset = align(offset, 4) + 4;
+        }
+
+        for (uint32_t position {0}; position < type.member_count; ++position)
+        {
+            const TypeDescription::Member& member {description_.member(type, position)};
+
+            if (member.optional)
+            {
+                FASTCDR_THROW(exception::BadParamException("Types with optional members have no fixed layout"));
+            }
+
+            offset = skip_type(member.type, offset);
+        }
+
+        return offset;
+    }
+
+    FASTCDR_THROW(exception::BadParamException(
+                "Only primitives, arrays and final and appendable structures have a fixed layout"));
+}
+
+} // namespace fastcdr
+} // namespace eprosima
@@ -0,0 +1,338 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/PayloadView.hpp>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+TypeKind ValueView::kind() const
+{
+    if (nullptr == payload_)
+    {
+        FASTCDR_THROW(exception::BadParamException("The view is empty"));
+    }
+
+    return payload_->interpreter_.description().type(type_).kind;
+}
+
+const char* ValueView::get_string(
+        size_t& length) const
+{
+    if (TypeKind::STRING8 != kind())
+    {
+        FASTCDR_THROW(exception::BadParamException("The value is not a string"));
+    }
+
+    return payload_->read_string(*this, length);
+}
+
+ValueView ValueView::member(
+        uint32_t id) const
+{
+    if (TypeKind::STRUCTURE != kind())
+    {
+        FASTCDR_THROW(exception::BadParamException("The value is not a structure"));
+    }
+
+    return payload_->member(*this, id);
+}
+
+size_t ValueView::size() const
+{
+    kind();
+    return payload_->size(*this);
+}
+
+ValueView ValueView::element(
+        size_t index) const
+{
+    kind();
+    return payload_->element(*this, index, false);
+}
+
+ValueView ValueView::key(
+        size_t index) const
+{
+    if (TypeKind::MAP != kind())
+    {
+        FASTCDR_THROW(exception::BadParamException("The value is not a map"));
+    }
+
+    return payload_->element(*this, index, true);
+}
+
+PayloadView::PayloadView(
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type,
+        const char* buffer,
+        size_t size)
+    : interpreter_(interpreter)
+    , fast_buffer_(const_cast<char*>(buffer), size)
+    , cdr_(fast_buffer_)
+{
+    interpreter_.read_encapsulation(cdr_, type);
+    root_ = ValueView(this, type, position().offset);
+}
+
+void PayloadView::move_to(
+        const ValueView& value)
+{
+    cdr_.set_state(states_.find(value.offset_)->second);
+}
+
+PayloadView::Position PayloadView::position()
+{
+    Position current;
+    current.offset = static_cast<size_t>(cdr_.get_current_position() - fast_buffer_.getBuffer());
+    states_.emplace(current.offset, cdr_.get_state());
+    return current;
+}
+
+const char* PayloadView::read_string(
+        const ValueView& value,
+        size_t& length)
+{
+    move_to(value);
+    uint32_t encoded_length {0};
+    cdr_.deserialize(encoded_length);
+
+    const char* characters {cdr_.get_current_position()};
+
+    if (static_cast<size_t>(fast_buffer_.getBuffer() + fast_buffer_.getBufferSize() - characters) < encoded_length)
+    {
+        FASTCDR_THROW(exception::NotEnoughMemoryException(
+                    exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT));
+    }
+
+    // The length includes the null terminator, which some implementations don't send for empty strings.
+    length = 0 < encoded_length ? encoded_length - 1 : 0;
+    return characters;
+}
+
+ValueView PayloadView::member(
+        const ValueView& structure,
+        uint32_t id)
+{
+    const TypeInterpreter::Instruction& instruction {interpreter_.instructions_[structure.type_]};
+    const TypeInterpreter::MemberInstruction* member {interpreter_.find_member(instruction, id)};
+
+    if (nullptr == member)
+    {
+        return ValueView();
+    }
+
+    auto cached = members_.find(std::make_tuple(structure.offset_, structure.type_, id));
+
+    if (members_.end() == cached)
+    {
+        // Every member found on the way is kept, so the members before the requested one are not looked up again.
+        move_to(structure);
+        uint32_t dheader {0};
+        const TypeInterpreter::StructureState members_state {interpreter_.begin_structure(cdr_, instruction, dheader)};
+        Position not_present;
+        not_present.present = false;
+
+        const EncodingAlgorithmFlag encoding {interpreter_.encoding(instruction, cdr_.get_cdr_version())};
+
+        if (EncodingAlgorithmFlag::PL_CDR == encoding || EncodingAlgorithmFlag::PL_CDR2 == encoding)
+        {
+            uint32_t member_size {0};
+            MemberId member_id;
+
+            while (interpreter_.next_member_header(cdr_, members_state, dheader, member_id, member_size))
+            {
+                const size_t value_begin {cdr_.get_serialized_data_length()};
+
+                if (nullptr != interpreter_.find_member(instruction, member_id.id))
+                {
+                    members_.emplace(std::make_tuple(structure.offset_, structure.type_, member_id.id), position());
+                }
+
+                if (id == member_id.id)
+                {
+                    break;
+                }
+
+                interpreter_.end_member_value(cdr_, member_size, value_begin);
+            }
+        }
+        else
+        {
+            for (uint32_t position_in_type {0}; position_in_type < instruction.member_count; ++position_in_type)
+            {
+                const TypeInterpreter::MemberInstruction& current {
+                    interpreter_.members_[instruction.first_member + position_in_type]};
+
+                // Members missing at the end of an appendable type are not present.
+                if (!interpreter_.has_next_member(cdr_, members_state, dheader))
+                {
+                    break;
+                }
+
+                uint32_t member_size {0};
+                const bool present {!current.optional || interpreter_.deserialize_presence(cdr_, member_size)};
+                const size_t value_begin {cdr_.get_serialized_data_length()};
+                members_.emplace(std::make_tuple(structure.offset_, structure.type_, current.id.id),
+                        present ? position() : not_present);
+
+                if (id == current.id.id)
+                {
+                    break;
+                }
+
+                if (present)
+                {
+                    cdr_.skip(interpreter_.description(), current.instruction);
+                }
+
+                if (current.optional)
+                {
+                    interpreter_.end_optional_member(cdr_, member_size, value_begin);
+                }
+            }
+        }
+
+        cached = members_.emplace(std::make_tuple(structure.offset_, structure.type_, id), not_present).first;
+    }
+
+    if (!cached->second.present)
+    {
+        return ValueView();
+    }
+
+    return ValueView(this, member->instruction, cached->second.offset);
+}
+
+size_t PayloadView::size(
+        const ValueView& collection)
+{
+    const TypeInterpreter::Instruction& instruction {interpreter_.instructions_[collection.type_]};
+
+    switch (instruction.op)
+    {
+        case TypeInterpreter::OpCode::PRIMITIVE_ARRAY:
+        case TypeInterpreter::OpCode::ARRAY:
+            return interpreter_.description().type(collection.type_).bound;
+        case TypeInterpreter::OpCode::PRIMITIVE_SEQUENCE:
+        case TypeInterpreter::OpCode::SEQUENCE:
+        case TypeInterpreter::OpCode::MAP:
+        {
+            move_to(collection);
+            uint32_t dheader {0};
+            size_t elements_begin {0};
+            uint32_t length {0};
+            interpreter_.begin_collection(cdr_, instruction, dheader, elements_begin, length);
+            return length;
+        }
+        case TypeInterpreter::OpCode::STRING8:
+        {
+            size_t length {0};
+            collection.get_string(length);
+            return length;
+        }
+        case TypeInterpreter::OpCode::STRING16:
+        {
+            move_to(collection);
+            uint32_t length {0};
+            cdr_.deserialize(length);
+            return length;
+        }
+        default:
+            FASTCDR_THROW(exception::BadParamException("The value is not a collection"));
+    }
+}
+
+ValueView PayloadView::element(
+        const ValueView& collection,
+        size_t index,
+        bool key)
+{
+    const TypeInterpreter::Instruction& instruction {interpreter_.instructions_[collection.type_]};
+    const TypeDescription::Type& type {interpreter_.description().type(collection.type_)};
+
+    if (TypeInterpreter::OpCode::PRIMITIVE_ARRAY == instruction.op ||
+            TypeInterpreter::OpCode::PRIMITIVE_SEQUENCE == instruction.op)
+    {
+        // The elements are located by arithmetic. The elements of a multidimensional array are arrays themselves.
+        const size_t num_elements {TypeInterpreter::OpCode::PRIMITIVE_ARRAY == instruction.op ?
+                                   instruction.count / type.bound : 1};
+
+        if (size(collection) <= index)
+        {
+            FASTCDR_THROW(exception::BadParamException("The index is out of the bounds of the collection"));
+        }
+
+        move_to(collection);
+
+        if (TypeInterpreter::OpCode::PRIMITIVE_SEQUENCE == instruction.op)
+        {
+            uint32_t length {0};
+            cdr_.deserialize(length);
+        }
+
+        cdr_.jump_primitives(instruction.kind, index * num_elements);
+        return ValueView(this, type.element, position().offset);
+    }
+
+    if (TypeInterpreter::OpCode::ARRAY != instruction.op && TypeInterpreter::OpCode::SEQUENCE != instruction.op &&
+            TypeInterpreter::OpCode::MAP != instruction.op)
+    {
+        FASTCDR_THROW(exception::BadParamException("The value is not a collection"));
+    }
+
+    // Maps store their keys and values alternately.
+    const bool is_map {TypeInterpreter::OpCode::MAP == instruction.op};
+    const size_t position_in_collection {is_map ? index * 2 + (key ? 0 : 1) : index};
+    const TypeDescription::TypeIndex element_type {key ? type.key : type.element};
+    std::vector<Position>& elements {elements_[std::make_pair(collection.offset_, collection.type_)]};
+
+    if (elements.size() <= position_in_collection)
+    {
+        const size_t length {size(collection)};
+
+        if (length <= index)
+        {
+            FASTCDR_THROW(exception::BadParamException("The index is out of the bounds of the collection"));
+        }
+
+        if (elements.empty())
+        {
+            move_to(collection);
+            uint32_t dheader {0};
+            size_t elements_begin {0};
+            uint32_t encoded_length {0};
+            interpreter_.begin_collection(cdr_, instruction, dheader, elements_begin, encoded_length);
+            elements.push_back(position());
+        }
+
+        while (elements.size() <= position_in_collection)
+        {
+            const Position& last {elements.back()};
+            move_to(ValueView(this, collection.type_, last.offset));
+            cdr_.skip(interpreter_.description(), is_map && 1 == elements.size() % 2 ? type.key : type.element);
+            elements.push_back(position());
+        }
+    }
+
+    const Position& element_position {elements[position_in_collection]};
+    return ValueView(this, element_type, element_position.offset);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
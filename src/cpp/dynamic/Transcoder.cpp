@@ -0,0 +1,124 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/Transcoder.hpp>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+namespace {
+
+//! Returns the encoding of the encapsulation of a type in a CDR version.
+EncodingAlgorithmFlag encapsulation_encoding(
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version)
+{
+    return TypeDescription::encoding(cdr_version, TypeKind::STRUCTURE == description.type(type).kind ?
+                   description.type(type).extensibility : Extensibility::FINAL);
+}
+
+} // namespace
+
+ValidationResult transcode_endianness(
+        char* buffer,
+        size_t size,
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type)
+{
+    FastBuffer fast_buffer(buffer, size);
+    Cdr cdr(fast_buffer);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+    cdr.read_encapsulation();
+
+    if (Cdr::CDR_ERROR_NONE == cdr.get_error() && TypeKind::STRUCTURE == description.type(type).kind &&
+            TypeDescription::encoding(cdr.get_cdr_version(), description.type(type).extensibility) !=
+            cdr.get_encoding_flag())
+    {
+        ValidationResult result;
+        result.error = Cdr::CDR_ERROR_BAD_PARAM;
+        result.length = cdr.get_serialized_data_length();
+        result.message = "Encapsulation doesn't match the extensibility of the type";
+        return result;
+    }
+
+    cdr.transcode_endianness(description, type);
+
+    ValidationResult result;
+    result.error = cdr.get_error();
+    result.length = cdr.get_serialized_data_length();
+    result.message = cdr.get_error_message();
+
+    if (Cdr::CDR_ERROR_NONE == result.error)
+    {
+        // The encapsulation byte follows the dummy byte written by Cdr::serialize_encapsulation.
+        buffer[1] = static_cast<char>(buffer[1] ^ 0x1);
+    }
+
+    return result;
+}
+
+size_t calculate_transcoded_size(
+        const char* buffer,
+        size_t size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version)
+{
+    FastBuffer fast_buffer(const_cast<char*>(buffer), size);
+    Cdr source(fast_buffer);
+    interpreter.read_encapsulation(source, type);
+
+    CdrSizeCalculator calculator(cdr_version, encapsulation_encoding(interpreter.description(), type, cdr_version));
+    size_t current_alignment {0};
+
+    // Encapsulation
+    return 4 + interpreter.calculate_transcoded_size(source, calculator, type, current_alignment);
+}
+
+size_t transcode_cdr_version(
+        const char* buffer,
+        size_t size,
+        char* destination,
+        size_t destination_size,
+        const TypeInterpreter& interpreter,
+        TypeDescription::TypeIndex type,
+        CdrVersion cdr_version)
+{
+    if (CdrVersion::XCDRv1 != cdr_version && CdrVersion::XCDRv2 != cdr_version)
+    {
+        FASTCDR_THROW(exception::BadParamException("Only XCDRv1 and XCDRv2 payloads can be transcoded"));
+    }
+
+    FastBuffer source_buffer(const_cast<char*>(buffer), size);
+    Cdr source(source_buffer);
+    interpreter.read_encapsulation(source, type);
+
+    FastBuffer destination_buffer(destination, destination_size);
+    Cdr cdr(destination_buffer, source.endianness(), cdr_version);
+    cdr.set_encoding_flag(encapsulation_encoding(interpreter.description(), type, cdr_version));
+    cdr.serialize_encapsulation();
+
+    interpreter.transcode(source, cdr, type);
+    cdr.set_dds_cdr_options(source.get_dds_cdr_options());
+
+    return cdr.get_serialized_data_length();
+}
+
+} // namespace fastcdr
+} // namespace eprosima
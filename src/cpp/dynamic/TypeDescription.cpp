@@ -0,0 +1,224 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/TypeDescription.hpp>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+TypeDescription::TypeDescription()
+{
+    for (uint8_t kind {0}; kind <= static_cast<uint8_t>(TypeKind::STRING16); ++kind)
+    {
+        Type type;
+        type.kind = static_cast<TypeKind>(kind);
+        types_.push_back(type);
+    }
+}
+
+TypeDescription::TypeIndex TypeDescription::add_string(
+        TypeKind kind,
+        uint32_t bound)
+{
+    if (TypeKind::STRING8 != kind && TypeKind::STRING16 != kind)
+    {
+        FASTCDR_THROW(exception::BadParamException("Not a string kind"));
+    }
+
+    Type type;
+    type.kind = kind;
+    type.bound = bound;
+    return add(type);
+}
+
+TypeDescription::TypeIndex TypeDescription::add_sequence(
+        TypeIndex element,
+        uint32_t bound)
+{
+    check_index(element);
+    Type type;
+    type.kind = TypeKind::SEQUENCE;
+    type.element = element;
+    type.bound = bound;
+    return add(type);
+}
+
+TypeDescription::TypeIndex TypeDescription::add_array(
+        TypeIndex element,
+        uint32_t length)
+{
+    check_index(element);
+    Type type;
+    type.kind = TypeKind::ARRAY;
+    type.element = element;
+    type.bound = length;
+    return add(type);
+}
+
+TypeDescription::TypeIndex TypeDescription::add_map(
+        TypeIndex key,
+        TypeIndex value,
+        uint32_t bound)
+{
+    check_index(key);
+    check_index(value);
+    Type type;
+    type.kind = TypeKind::MAP;
+    type.key = key;
+    type.element = value;
+    type.bound = bound;
+    return add(type);
+}
+
+TypeDescription::TypeIndex TypeDescription::declare_structure(
+        Extensibility extensibility)
+{
+    Type type;
+    type.kind = TypeKind::STRUCTURE;
+    type.extensibility = extensibility;
+    type.first_member = static_cast<uint32_t>(members_.size());
+    return add(type);
+}
+
+void TypeDescription::set_members(
+        TypeIndex structure,
+        const std::vector<Member>& members)
+{
+    check_index(structure);
+    Type& type = types_[structure];
+
+    if (TypeKind::STRUCTURE != type.kind || 0 < type.member_count)
+    {
+        FASTCDR_THROW(exception::BadParamException("Not a structure without members"));
+    }
+
+    for (const Member& member : members)
+    {
+        check_index(member.type);
+    }
+
+    type.first_member = static_cast<uint32_t>(members_.size());
+    type.member_count = static_cast<uint32_t>(members.size());
+    members_.insert(members_.end(), members.begin(), members.end());
+}
+
+TypeDescription::TypeIndex TypeDescription::add_structure(
+        Extensibility extensibility,
+        const std::vector<Member>& members)
+{
+    TypeIndex structure {declare_structure(extensibility)};
+    set_members(structure, members);
+    return structure;
+}
+
+const TypeDescription::Member* TypeDescription::find_member(
+        const Type& structure,
+        uint32_t id) const
+{
+    for (uint32_t position {0}; position < structure.member_count; ++position)
+    {
+        const Member& current = members_[structure.first_member + position];
+
+        if (current.id.id == id)
+        {
+            return &current;
+        }
+    }
+
+    return nullptr;
+}
+
+size_t TypeDescription::primitive_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TypeKind::BOOLEAN:
+        case TypeKind::CHAR8:
+        case TypeKind::INT8:
+        case TypeKind::UINT8:
+            return 1;
+        case TypeKind::CHAR16:
+        case TypeKind::INT16:
+        case TypeKind::UINT16:
+            return 2;
+        case TypeKind::INT32:
+        case TypeKind::UINT32:
+        case TypeKind::FLOAT32:
+            return 4;
+        case TypeKind::INT64:
+        case TypeKind::UINT64:
+        case TypeKind::FLOAT64:
+            return 8;
+        case TypeKind::FLOAT128:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool TypeDescription::is_multi_array_primitive(
+        TypeIndex index) const
+{
+    const Type* current {&types_[index]};
+
+    while (TypeKind::ARRAY == current->kind)
+    {
+        current = &types_[current->element];
+    }
+
+    return is_primitive(current->kind);
+}
+
+TypeDescription::TypeIndex TypeDescription::add(
+        const Type& type)
+{
+    types_.push_back(type);
+    return static_cast<TypeIndex>(types_.size() - 1);
+}
+
+void TypeDescription::check_index(
+        TypeIndex index) const
+{
+    if (types_.size() <= index)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+}
+
+EncodingAlgorithmFlag TypeDescription::encoding(
+        CdrVersion cdr_version,
+        Extensibility extensibility)
+{
+    if (CdrVersion::XCDRv2 == cdr_version)
+    {
+        switch (extensibility)
+        {
+            case Extensibility::MUTABLE:
+                return EncodingAlgorithmFlag::PL_CDR2;
+            case Extensibility::APPENDABLE:
+                return EncodingAlgorithmFlag::DELIMIT_CDR2;
+            default:
+                return EncodingAlgorithmFlag::PLAIN_CDR2;
+        }
+    }
+
+    return Extensibility::MUTABLE == extensibility ? EncodingAlgorithmFlag::PL_CDR : EncodingAlgorithmFlag::PLAIN_CDR;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
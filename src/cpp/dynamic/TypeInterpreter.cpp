@@ -0,0 +1,2339 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/TypeInterpreter.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastcdr/config.h>
+#include <fastcdr/exceptions/BadParamException.h>
+
+namespace eprosima {
+namespace fastcdr {
+
+template<>
+void serialize(
+        Cdr& cdr,
+        const TypeInterpreter::BoundValue& data)
+{
+    data.interpreter->serialize(cdr, data);
+}
+
+template<>
+size_t calculate_serialized_size(
+        CdrSizeCalculator& calculator,
+        const TypeInterpreter::BoundValue& data,
+        size_t& current_alignment)
+{
+    return data.interpreter->calculate_serialized_size(calculator, data, current_alignment);
+}
+
+template<>
+void serialize(
+        Cdr& cdr,
+        const TypeInterpreter::TranscodedValue& data)
+{
+    data.interpreter->serialize(cdr, data);
+}
+
+template<>
+size_t calculate_serialized_size(
+        CdrSizeCalculator& calculator,
+        const TypeInterpreter::TranscodedValue& data,
+        size_t& current_alignment)
+{
+    return data.interpreter->calculate_serialized_size(calculator, data, current_alignment);
+}
+
+//! FNV-1a 64 bits offset basis.
+static constexpr uint64_t FNV_OFFSET_BASIS {0xcbf29ce484222325ull};
+
+//! FNV-1a 64 bits prime.
+static constexpr uint64_t FNV_PRIME {0x100000001b3ull};
+
+//! Adds bytes to a FNV-1a hash.
+static void hash_bytes(
+        uint64_t& hash,
+        const char* bytes,
+        size_t size)
+{
+    for (size_t count {0}; count < size; ++count)
+    {
+        hash = (hash ^ static_cast<uint8_t>(bytes[count])) * FNV_PRIME;
+    }
+}
+
+//! Hashes an integer in little endianness.
+static void hash_integer(
+        uint64_t& hash,
+        uint64_t value,
+        size_t size)
+{
+    for (size_t count {0}; count < size; ++count)
+    {
+        hash = (hash ^ ((value >> (count * 8)) & 0xFF)) * FNV_PRIME;
+    }
+}
+
+//! Finalizer of MurmurHash3, spreading the hashes of the members of mutable types before adding them.
+static uint64_t mix(
+        uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/*!
+ * @brief Calls the visitor with a null pointer to the native type of a primitive kind.
+ */
+template<class _Visitor>
+static void visit_primitive(
+        TypeKind kind,
+        _Visitor&& visitor)
+{
+    switch (kind)
+    {
+        case TypeKind::BOOLEAN:
+            visitor(static_cast<bool*>(nullptr));
+            break;
+        case TypeKind::CHAR8:
+            visitor(static_cast<char*>(nullptr));
+            break;
+        case TypeKind::CHAR16:
+            visitor(static_cast<wchar_t*>(nullptr));
+            break;
+        case TypeKind::INT8:
+            visitor(static_cast<int8_t*>(nullptr));
+            break;
+        case TypeKind::UINT8:
+            visitor(static_cast<uint8_t*>(nullptr));
+            break;
+        case TypeKind::INT16:
+            visitor(static_cast<int16_t*>(nullptr));
+            break;
+        case TypeKind::UINT16:
+            visitor(static_cast<uint16_t*>(nullptr));
+            break;
+        case TypeKind::INT32:
+            visitor(static_cast<int32_t*>(nullptr));
+            break;
+        case TypeKind::UINT32:
+            visitor(static_cast<uint32_t*>(nullptr));
+            break;
+        case TypeKind::INT64:
+            visitor(static_cast<int64_t*>(nullptr));
+            break;
+        case TypeKind::UINT64:
+            visitor(static_cast<uint64_t*>(nullptr));
+            break;
+        case TypeKind::FLOAT32:
+            visitor(static_cast<float*>(nullptr));
+            break;
+        case TypeKind::FLOAT64:
+            visitor(static_cast<double*>(nullptr));
+            break;
+        case TypeKind::FLOAT128:
+            visitor(static_cast<long double*>(nullptr));
+            break;
+        default:
+            break;
+    }
+}
+
+struct PrimitiveResizer
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        value.resize_primitives<_T>(count);
+    }
+
+    DynamicValue& value;
+
+    size_t count;
+};
+
+struct PrimitiveEncoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        cdr.serialize(value.get<_T>());
+    }
+
+    Cdr& cdr;
+
+    const DynamicValue& value;
+};
+
+struct PrimitiveArrayEncoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        if (value.primitive_count<_T>() != count)
+        {
+            FASTCDR_THROW(exception::BadParamException("Wrong number of array elements"));
+        }
+
+        cdr.serialize_array(value.primitives<_T>(), count);
+    }
+
+    Cdr& cdr;
+
+    const DynamicValue& value;
+
+    size_t count;
+};
+
+struct PrimitiveSequenceEncoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        if (0 < bound && bound < value.primitive_count<_T>())
+        {
+            FASTCDR_THROW(exception::BadParamException("Sequence length exceeds its bound"));
+        }
+
+        cdr.serialize_sequence(value.primitives<_T>(), value.primitive_count<_T>());
+    }
+
+    Cdr& cdr;
+
+    const DynamicValue& value;
+
+    size_t bound;
+};
+
+struct PrimitiveDecoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        _T primitive;
+        cdr.deserialize(primitive);
+        value.set(primitive);
+    }
+
+    Cdr& cdr;
+
+    DynamicValue& value;
+};
+
+struct PrimitiveArrayDecoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        value.resize_primitives<_T>(count);
+        cdr.deserialize_array(value.primitives<_T>(), count);
+    }
+
+    Cdr& cdr;
+
+    DynamicValue& value;
+
+    size_t count;
+};
+
+struct PrimitiveSizeCalculator
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        calculated_size = calculator.calculate_serialized_size(value.get<_T>(), current_alignment);
+    }
+
+    CdrSizeCalculator& calculator;
+
+    const DynamicValue& value;
+
+    size_t& current_alignment;
+
+    size_t calculated_size;
+};
+
+struct PrimitiveArraySizeCalculator
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        if (sequence)
+        {
+            count = value.primitive_count<_T>();
+        }
+        else if (value.primitive_count<_T>() != count)
+        {
+            FASTCDR_THROW(exception::BadParamException("Wrong number of array elements"));
+        }
+
+        calculated_size = calculator.calculate_array_serialized_size(value.primitives<_T>(), count,
+                        current_alignment);
+        element_size = sizeof(_T);
+    }
+
+    CdrSizeCalculator& calculator;
+
+    const DynamicValue& value;
+
+    //! Whether the number of elements is the one of the value.
+    bool sequence;
+
+    size_t count;
+
+    size_t& current_alignment;
+
+    size_t calculated_size;
+
+    size_t element_size;
+};
+
+struct PrimitiveTranscoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        _T primitive;
+        source.deserialize(primitive);
+        destination.serialize(primitive);
+    }
+
+    Cdr& source;
+
+    Cdr& destination;
+};
+
+struct PrimitiveArrayTranscoder
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        // Elements are copied through a small block on the stack, so nothing is allocated.
+        _T block[256 / sizeof(_T)];
+        size_t remaining {count};
+
+        // Empty arrays are also aligned, as when they are encoded at once.
+        do
+        {
+            const size_t block_count {std::min(remaining, sizeof(block) / sizeof(_T))};
+            source.deserialize_array(block, block_count);
+            destination.serialize_array(block, block_count);
+            remaining -= block_count;
+        } while (0 < remaining);
+
+        element_size = sizeof(_T);
+    }
+
+    Cdr& source;
+
+    Cdr& destination;
+
+    size_t count;
+
+    size_t element_size;
+};
+
+struct PrimitiveTranscodedSizeCalculator
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        _T primitive;
+        source.deserialize(primitive);
+        calculated_size = calculator.calculate_serialized_size(primitive, current_alignment);
+    }
+
+    Cdr& source;
+
+    CdrSizeCalculator& calculator;
+
+    size_t& current_alignment;
+
+    size_t calculated_size;
+};
+
+struct PrimitiveArrayTranscodedSizeCalculator
+{
+    template<class _T>
+    void operator ()(
+            _T*)
+    {
+        // The size of arrays of primitives doesn't depend on their values, but booleans are only sized one by one.
+        using sized_type = typename std::conditional<std::is_same<_T, bool>::value, uint8_t, _T>::type;
+        calculated_size = calculator.calculate_array_serialized_size(static_cast<const sized_type*>(nullptr), count,
+                        current_alignment);
+        element_size = sizeof(_T);
+    }
+
+    CdrSizeCalculator& calculator;
+
+    size_t count;
+
+    size_t& current_alignment;
+
+    size_t calculated_size;
+
+    size_t element_size;
+};
+
+TypeInterpreter::TypeInterpreter(
+        const TypeDescription& description)
+    : description_(description)
+    , instructions_(description.size())
+{
+    for (TypeDescription::TypeIndex index {0}; index < description_.size(); ++index)
+    {
+        const TypeDescription::Type& type = description_.type(index);
+        Instruction& instruction = instructions_[index];
+        instruction.element = type.element;
+        instruction.key = type.key;
+        instruction.count = type.bound;
+
+        switch (type.kind)
+        {
+            case TypeKind::STRING8:
+                instruction.op = OpCode::STRING8;
+                break;
+            case TypeKind::STRING16:
+                instruction.op = OpCode::STRING16;
+                break;
+            case TypeKind::SEQUENCE:
+                if (TypeDescription::is_primitive(description_.type(type.element).kind))
+                {
+                    instruction.op = OpCode::PRIMITIVE_SEQUENCE;
+                    instruction.kind = description_.type(type.element).kind;
+                }
+                else
+                {
+                    instruction.op = OpCode::SEQUENCE;
+                    instruction.dheader = true;
+                }
+                break;
+            case TypeKind::ARRAY:
+                if (description_.is_multi_array_primitive(index))
+                {
+                    // Multidimensional arrays of primitives are flattened into a single block.
+                    const TypeDescription::Type* element {&type};
+                    while (TypeKind::ARRAY == element->kind)
+                    {
+                        if (element != &type)
+                        {
+                            instruction.count *= element->bound;
+                        }
+                        element = &description_.type(element->element);
+                    }
+                    instruction.op = OpCode::PRIMITIVE_ARRAY;
+                    instruction.kind = element->kind;
+                }
+                else
+                {
+                    instruction.op = OpCode::ARRAY;
+                    instruction.dheader = true;
+                }
+                break;
+            case TypeKind::MAP:
+                instruction.op = OpCode::MAP;
+                instruction.dheader = !TypeDescription::is_primitive(description_.type(type.element).kind);
+                break;
+            case TypeKind::STRUCTURE:
+            {
+                instruction.op = OpCode::STRUCTURE;
+                switch (type.extensibility)
+                {
+                    case Extensibility::MUTABLE:
+                        instruction.xcdrv1_encoding = EncodingAlgorithmFlag::PL_CDR;
+                        instruction.xcdrv2_encoding = EncodingAlgorithmFlag::PL_CDR2;
+                        break;
+                    case Extensibility::APPENDABLE:
+                        instruction.xcdrv2_encoding = EncodingAlgorithmFlag::DELIMIT_CDR2;
+                        break;
+                    default:
+                        break;
+                }
+                instruction.first_member = static_cast<uint32_t>(members_.size());
+                instruction.member_count = type.member_count;
+
+                for (uint32_t position {0}; position < type.member_count; ++position)
+                {
+                    const TypeDescription::Member& member = description_.member(type, position);
+                    MemberInstruction member_instruction;
+                    member_instruction.id = member.id;
+                    member_instruction.instruction = member.type;
+                    member_instruction.optional = member.optional;
+                    members_.push_back(member_instruction);
+                    member_ids_.emplace_back(member.id.id, position);
+                }
+
+                std::sort(member_ids_.begin() + instruction.first_member, member_ids_.end());
+                break;
+            }
+            default:
+                instruction.op = OpCode::PRIMITIVE;
+                instruction.kind = type.kind;
+                break;
+        }
+    }
+}
+
+DynamicValue TypeInterpreter::make_value(
+        TypeDescription::TypeIndex type) const
+{
+    const Instruction& instruction = instructions_.at(type);
+    DynamicValue value(description_.type(type).kind);
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE_ARRAY:
+            visit_primitive(instruction.kind, PrimitiveResizer{value, instruction.count});
+            break;
+        case OpCode::ARRAY:
+            value.elements.assign(instruction.count, make_value(instruction.element));
+            break;
+        case OpCode::STRUCTURE:
+            value.elements.reserve(instruction.member_count);
+            for (uint32_t position {0}; position < instruction.member_count; ++position)
+            {
+                const MemberInstruction& member = members_[instruction.first_member + position];
+                if (member.optional)
+                {
+                    // Not expanded, so recursive types through optional members are allowed.
+                    value.elements.emplace_back(description_.type(member.instruction).kind);
+                    value.elements.back().present = false;
+                }
+                else
+                {
+                    value.elements.push_back(make_value(member.instruction));
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    return value;
+}
+
+void TypeInterpreter::serialize(
+        Cdr& cdr,
+        TypeDescription::TypeIndex type,
+        const DynamicValue& value) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    serialize_value(cdr, type, value);
+}
+
+void TypeInterpreter::deserialize(
+        Cdr& cdr,
+        TypeDescription::TypeIndex type,
+        DynamicValue& value) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    deserialize_value(cdr, type, value);
+}
+
+void TypeInterpreter::skip(
+        Cdr& cdr,
+        TypeDescription::TypeIndex type) const
+{
+    cdr.skip(description_, type);
+}
+
+size_t TypeInterpreter::calculate_serialized_size(
+        CdrSizeCalculator& calculator,
+        TypeDescription::TypeIndex type,
+        const DynamicValue& value,
+        size_t& current_alignment) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    return calculate_value_size(calculator, type, value, current_alignment);
+}
+
+void TypeInterpreter::serialize(
+        Cdr& cdr,
+        const BoundValue& bound) const
+{
+    serialize_value(cdr, bound.instruction, *bound.value);
+}
+
+size_t TypeInterpreter::calculate_serialized_size(
+        CdrSizeCalculator& calculator,
+        const BoundValue& bound,
+        size_t& current_alignment) const
+{
+    return calculate_value_size(calculator, bound.instruction, *bound.value, current_alignment);
+}
+
+void TypeInterpreter::transcode(
+        Cdr& source,
+        Cdr& destination,
+        TypeDescription::TypeIndex type) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    transcode_value(source, destination, type);
+}
+
+size_t TypeInterpreter::calculate_transcoded_size(
+        Cdr& source,
+        CdrSizeCalculator& calculator,
+        TypeDescription::TypeIndex type,
+        size_t& current_alignment) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    return calculate_transcoded_value_size(source, calculator, type, current_alignment);
+}
+
+void TypeInterpreter::serialize(
+        Cdr& cdr,
+        const TranscodedValue& transcoded) const
+{
+    transcode_value(*transcoded.source, cdr, transcoded.instruction);
+}
+
+size_t TypeInterpreter::calculate_serialized_size(
+        CdrSizeCalculator& calculator,
+        const TranscodedValue& transcoded,
+        size_t& current_alignment) const
+{
+    return calculate_transcoded_value_size(*transcoded.source, calculator, transcoded.instruction, current_alignment);
+}
+
+void TypeInterpreter::read_encapsulation(
+        Cdr& cdr,
+        TypeDescription::TypeIndex type) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    cdr.read_encapsulation();
+
+    if (Cdr::CDR_ERROR_NONE == cdr.get_error() && OpCode::STRUCTURE == instructions_[type].op &&
+            encoding(instructions_[type], cdr.get_cdr_version()) != cdr.get_encoding_flag())
+    {
+        cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Encapsulation doesn't match the extensibility of the type");
+    }
+}
+
+bool TypeInterpreter::equals(
+        Cdr& first,
+        Cdr& second,
+        TypeDescription::TypeIndex type) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    return equal_value(first, second, type) && Cdr::CDR_ERROR_NONE == first.get_error() &&
+           Cdr::CDR_ERROR_NONE == second.get_error();
+}
+
+uint64_t TypeInterpreter::hash(
+        Cdr& cdr,
+        TypeDescription::TypeIndex type) const
+{
+    if (instructions_.size() <= type)
+    {
+        FASTCDR_THROW(exception::BadParamException("Unknown type index"));
+    }
+
+    uint64_t hash {FNV_OFFSET_BASIS};
+    hash_value(cdr, type, hash);
+    return hash;
+}
+
+void TypeInterpreter::serialize_value(
+        Cdr& cdr,
+        uint32_t index,
+        const DynamicValue& value) const
+{
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+            visit_primitive(instruction.kind, PrimitiveEncoder{cdr, value});
+            break;
+        case OpCode::PRIMITIVE_ARRAY:
+            visit_primitive(instruction.kind, PrimitiveArrayEncoder{cdr, value, instruction.count});
+            break;
+        case OpCode::PRIMITIVE_SEQUENCE:
+            visit_primitive(instruction.kind, PrimitiveSequenceEncoder{cdr, value, instruction.count});
+            break;
+        case OpCode::STRING8:
+            if (0 < instruction.count && instruction.count < value.string8.size())
+            {
+                FASTCDR_THROW(exception::BadParamException("String length exceeds its bound"));
+            }
+            cdr.serialize(value.string8);
+            break;
+        case OpCode::STRING16:
+            if (0 < instruction.count && instruction.count < value.string16.size())
+            {
+                FASTCDR_THROW(exception::BadParamException("String length exceeds its bound"));
+            }
+            cdr.serialize(value.string16);
+            break;
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            size_t length {value.elements.size()};
+
+            if (OpCode::ARRAY == instruction.op && instruction.count != length)
+            {
+                FASTCDR_THROW(exception::BadParamException("Wrong number of array elements"));
+            }
+            else if (OpCode::MAP == instruction.op)
+            {
+                if (0 != length % 2)
+                {
+                    FASTCDR_THROW(exception::BadParamException("Map without value for its last key"));
+                }
+                length /= 2;
+            }
+
+            if (OpCode::ARRAY != instruction.op && 0 < instruction.count && instruction.count < length)
+            {
+                FASTCDR_THROW(exception::BadParamException("Sequence length exceeds its bound"));
+            }
+
+            Cdr::state dheader_state {instruction.dheader ? cdr.allocate_xcdrv2_dheader() : Cdr::state(cdr)};
+
+            FASTCDR_TRY
+            {
+                if (OpCode::ARRAY != instruction.op)
+                {
+                    cdr.serialize(static_cast<int32_t>(length));
+                }
+
+                for (size_t count {0}; count < value.elements.size(); ++count)
+                {
+                    serialize_value(cdr, OpCode::MAP == instruction.op && 0 == count % 2 ?
+                            instruction.key : instruction.element, value.elements[count]);
+                }
+            }
+            FASTCDR_CATCH(exception::Exception&)
+            {
+                cdr.set_state(dheader_state);
+                FASTCDR_RETHROW;
+            }
+
+            if (instruction.dheader)
+            {
+                cdr.set_xcdrv2_dheader(dheader_state);
+            }
+            break;
+        }
+        case OpCode::STRUCTURE:
+            serialize_structure(cdr, instruction, value);
+            break;
+    }
+}
+
+void TypeInterpreter::serialize_structure(
+        Cdr& cdr,
+        const Instruction& instruction,
+        const DynamicValue& value) const
+{
+    if (instruction.member_count != value.elements.size())
+    {
+        FASTCDR_THROW(exception::BadParamException("Wrong number of structure members"));
+    }
+
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, encoding(instruction, cdr.get_cdr_version()));
+
+    for (uint32_t position {0}; position < instruction.member_count; ++position)
+    {
+        const MemberInstruction& member = members_[instruction.first_member + position];
+        BoundValue bound;
+        bound.interpreter = this;
+        bound.instruction = member.instruction;
+        bound.value = &value.elements[position];
+
+        if (member.optional)
+        {
+            cdr.serialize_member(member.id, bound.value->present ? optional<BoundValue>(bound) :
+                    optional<BoundValue>());
+        }
+        else
+        {
+            cdr.serialize_member(member.id, bound);
+        }
+    }
+
+    cdr.end_serialize_type(current_state);
+}
+
+void TypeInterpreter::deserialize_value(
+        Cdr& cdr,
+        uint32_t index,
+        DynamicValue& value) const
+{
+    Cdr::nesting_scope scope(cdr);
+
+    if (!scope)
+    {
+        return;
+    }
+
+    const Instruction& instruction = instructions_[index];
+    value.kind = description_.type(index).kind;
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+            visit_primitive(instruction.kind, PrimitiveDecoder{cdr, value});
+            break;
+        case OpCode::PRIMITIVE_ARRAY:
+            visit_primitive(instruction.kind, PrimitiveArrayDecoder{cdr, value, instruction.count});
+            break;
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            Cdr::state state_before_error(cdr);
+            uint32_t length {0};
+            cdr.deserialize(length);
+
+            if (0 < instruction.count && instruction.count < length)
+            {
+                cdr.set_state(state_before_error);
+                cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Sequence length exceeds its bound");
+                break;
+            }
+
+            if (cdr.get_remaining_length() < length)
+            {
+                cdr.set_state(state_before_error);
+                cdr.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+                break;
+            }
+
+            FASTCDR_TRY
+            {
+                visit_primitive(instruction.kind, PrimitiveArrayDecoder{cdr, value, length});
+            }
+            FASTCDR_CATCH(exception::Exception&)
+            {
+                cdr.set_state(state_before_error);
+                FASTCDR_RETHROW;
+            }
+            break;
+        }
+        case OpCode::STRING8:
+        case OpCode::STRING16:
+        {
+            Cdr::state state_before_error(cdr);
+
+            if (OpCode::STRING8 == instruction.op)
+            {
+                cdr.deserialize(value.string8);
+            }
+            else
+            {
+                cdr.deserialize(value.string16);
+            }
+
+            if (0 < instruction.count && instruction.count <
+                    (OpCode::STRING8 == instruction.op ? value.string8.size() : value.string16.size()))
+            {
+                cdr.set_state(state_before_error);
+                cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "String length exceeds its bound");
+            }
+            break;
+        }
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            Cdr::state state_before_error(cdr);
+            const bool delimited {instruction.dheader && CdrVersion::XCDRv2 == cdr.get_cdr_version()};
+            uint32_t dheader {0};
+
+            if (delimited)
+            {
+                cdr.deserialize(dheader);
+            }
+
+            const size_t offset {cdr.get_serialized_data_length()};
+            uint32_t length {instruction.count};
+
+            if (OpCode::ARRAY != instruction.op)
+            {
+                cdr.deserialize(length);
+
+                if (0 < instruction.count && instruction.count < length)
+                {
+                    cdr.set_state(state_before_error);
+                    cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Sequence length exceeds its bound");
+                    break;
+                }
+            }
+
+            const size_t num_elements {OpCode::MAP == instruction.op ? size_t(length) * 2 : size_t(length)};
+
+            if (OpCode::ARRAY == instruction.op)
+            {
+                value.elements.assign(num_elements, make_value(instruction.element));
+            }
+            else
+            {
+                // Elements are added while decoded, so a corrupt length doesn't allocate memory in advance.
+                value.elements.clear();
+            }
+
+            size_t count {0};
+            while (count < num_elements && (!delimited || (cdr.get_serialized_data_length() - offset) < dheader))
+            {
+                const uint32_t element {OpCode::MAP == instruction.op && 0 == count % 2 ?
+                                        instruction.key : instruction.element};
+
+                if (OpCode::ARRAY != instruction.op)
+                {
+                    value.elements.emplace_back();
+                }
+
+                deserialize_value(cdr, element, value.elements[count]);
+                ++count;
+            }
+
+            if (delimited && (cdr.get_serialized_data_length() - offset) != dheader)
+            {
+                cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Member size differs from the size specified by DHEADER");
+            }
+            break;
+        }
+        case OpCode::STRUCTURE:
+            deserialize_structure(cdr, instruction, value);
+            break;
+    }
+}
+
+void TypeInterpreter::deserialize_structure(
+        Cdr& cdr,
+        const Instruction& instruction,
+        DynamicValue& value) const
+{
+    value = make_value(static_cast<TypeDescription::TypeIndex>(&instruction - instructions_.data()));
+    const EncodingAlgorithmFlag type_encoding {encoding(instruction, cdr.get_cdr_version())};
+    const bool by_id {EncodingAlgorithmFlag::PL_CDR == type_encoding ||
+                      EncodingAlgorithmFlag::PL_CDR2 == type_encoding};
+
+    cdr.deserialize_type(type_encoding, [this, &instruction, &value, by_id](Cdr& dcdr, const MemberId& mid) -> bool
+            {
+                const MemberInstruction* member {decoded_member(instruction, mid, by_id)};
+
+                if (nullptr == member)
+                {
+                    return false;
+                }
+
+                const size_t position {static_cast<size_t>(member - &members_[instruction.first_member])};
+                return deserialize_member(dcdr, *member, value.elements[position]);
+            });
+}
+
+bool TypeInterpreter::deserialize_member(
+        Cdr& cdr,
+        const MemberInstruction& member,
+        DynamicValue& value) const
+{
+    if (!member.optional)
+    {
+        deserialize_value(cdr, member.instruction, value);
+        return true;
+    }
+
+    uint32_t member_size {0};
+    value.present = deserialize_presence(cdr, member_size);
+    const size_t value_begin {cdr.get_serialized_data_length()};
+
+    if (value.present)
+    {
+        deserialize_value(cdr, member.instruction, value);
+    }
+
+    end_optional_member(cdr, member_size, value_begin);
+    return true;
+}
+
+bool TypeInterpreter::deserialize_presence(
+        Cdr& cdr,
+        uint32_t& member_size) const
+{
+    if (EncodingAlgorithmFlag::PLAIN_CDR == cdr.get_current_encoding_flag())
+    {
+        // XCDRv1 encodes a member header before optional members, as Cdr::deserialize_member does.
+        MemberId member_id;
+        cdr.deserialize_member_header(member_id, member_size);
+        return 0 < member_size;
+    }
+
+    bool is_present {true};
+
+    if (CdrVersion::XCDRv2 == cdr.get_cdr_version() &&
+            EncodingAlgorithmFlag::PL_CDR2 != cdr.get_current_encoding_flag())
+    {
+        cdr.deserialize(is_present);
+    }
+
+    return is_present;
+}
+
+void TypeInterpreter::end_optional_member(
+        Cdr& cdr,
+        uint32_t member_size,
+        size_t value_begin) const
+{
+    if (EncodingAlgorithmFlag::PLAIN_CDR != cdr.get_current_encoding_flag())
+    {
+        return;
+    }
+
+    const size_t diff {cdr.get_serialized_data_length() - value_begin};
+
+    if (member_size < diff)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM,
+                "Member size provided by member header is lower than real decoded member size");
+        return;
+    }
+
+    if (!cdr.jump(member_size - diff))
+    {
+        cdr.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+    }
+}
+
+void TypeInterpreter::transcode_value(
+        Cdr& source,
+        Cdr& destination,
+        uint32_t index) const
+{
+    Cdr::nesting_scope scope(source);
+
+    if (!scope)
+    {
+        return;
+    }
+
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+            visit_primitive(instruction.kind, PrimitiveTranscoder{source, destination});
+            break;
+        case OpCode::PRIMITIVE_ARRAY:
+            visit_primitive(instruction.kind, PrimitiveArrayTranscoder{source, destination, instruction.count, 0});
+            break;
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            uint32_t length {0};
+
+            if (!deserialize_length(source, instruction, length))
+            {
+                break;
+            }
+
+            destination.serialize(static_cast<int32_t>(length));
+            PrimitiveArrayTranscoder visitor {source, destination, length, 0};
+            visit_primitive(instruction.kind, visitor);
+
+            destination.set_encoded_primitive_sequence(visitor.element_size);
+            break;
+        }
+        case OpCode::STRING8:
+        {
+            uint32_t length {0};
+            source.deserialize(length);
+
+            if (source.get_remaining_length() < length)
+            {
+                source.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+                break;
+            }
+
+            // The length includes the null terminator, which some implementations don't send for empty strings.
+            const char* characters {source.get_current_position()};
+            const size_t string_length {0 < length ? length - 1 : 0};
+
+            if (0 < length && '\0' != characters[string_length])
+            {
+                source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "String without null terminator");
+                break;
+            }
+
+            if (0 < instruction.count && instruction.count < string_length)
+            {
+                source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "String length exceeds its bound");
+                break;
+            }
+
+            destination.serialize_string(characters, string_length);
+            source.jump(length);
+            break;
+        }
+        case OpCode::STRING16:
+        {
+            uint32_t length {0};
+            source.deserialize(length);
+
+            if (0 < instruction.count && instruction.count < length)
+            {
+                source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "String length exceeds its bound");
+                break;
+            }
+
+            if (source.get_remaining_length() / 2 < length)
+            {
+                source.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+                break;
+            }
+
+            destination.serialize(length);
+            visit_primitive(TypeKind::CHAR16, PrimitiveArrayTranscoder{source, destination, length, 0});
+            break;
+        }
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            uint32_t dheader {0};
+            size_t elements_begin {0};
+            uint32_t length {0};
+
+            if (!begin_collection(source, instruction, dheader, elements_begin, length))
+            {
+                break;
+            }
+
+            const size_t num_elements {OpCode::MAP == instruction.op ? size_t(length) * 2 : size_t(length)};
+            Cdr::state dheader_state {instruction.dheader ? destination.allocate_xcdrv2_dheader() :
+                                      Cdr::state(destination)};
+
+            FASTCDR_TRY
+            {
+                if (OpCode::ARRAY != instruction.op)
+                {
+                    destination.serialize(static_cast<int32_t>(length));
+                }
+
+                for (size_t count {0}; count < num_elements && Cdr::CDR_ERROR_NONE == source.get_error(); ++count)
+                {
+                    transcode_value(source, destination, OpCode::MAP == instruction.op && 0 == count % 2 ?
+                            instruction.key : instruction.element);
+                }
+            }
+            FASTCDR_CATCH(exception::Exception&)
+            {
+                destination.set_state(dheader_state);
+                FASTCDR_RETHROW;
+            }
+
+            if (end_collection(source, instruction, dheader, elements_begin) && instruction.dheader)
+            {
+                destination.set_xcdrv2_dheader(dheader_state);
+            }
+            break;
+        }
+        case OpCode::STRUCTURE:
+            transcode_structure(source, destination, instruction);
+            break;
+    }
+}
+
+void TypeInterpreter::transcode_structure(
+        Cdr& source,
+        Cdr& destination,
+        const Instruction& instruction) const
+{
+    const EncodingAlgorithmFlag source_encoding {encoding(instruction, source.get_cdr_version())};
+    const EncodingAlgorithmFlag destination_encoding {encoding(instruction, destination.get_cdr_version())};
+    const bool by_id {EncodingAlgorithmFlag::PL_CDR == source_encoding ||
+                      EncodingAlgorithmFlag::PL_CDR2 == source_encoding};
+    uint32_t transcoded_members {0};
+
+    Cdr::state current_state(destination);
+    destination.begin_serialize_type(current_state, destination_encoding);
+
+    source.deserialize_type(source_encoding,
+            [this, &instruction, &destination, &transcoded_members, by_id](Cdr& scdr, const MemberId& mid) -> bool
+            {
+                const MemberInstruction* member {decoded_member(instruction, mid, by_id)};
+
+                if (nullptr == member)
+                {
+                    return false;
+                }
+
+                transcode_member(scdr, destination, *member);
+                ++transcoded_members;
+                return true;
+            });
+
+    // Types without member headers can only miss their last members when they are appendable.
+    if (!by_id && transcoded_members < instruction.member_count &&
+            EncodingAlgorithmFlag::DELIMIT_CDR2 != destination_encoding)
+    {
+        source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Members required by the destination encoding are missing");
+        return;
+    }
+
+    destination.end_serialize_type(current_state);
+}
+
+void TypeInterpreter::transcode_member(
+        Cdr& source,
+        Cdr& destination,
+        const MemberInstruction& member) const
+{
+    TranscodedValue transcoded;
+    transcoded.interpreter = this;
+    transcoded.instruction = member.instruction;
+    transcoded.source = &source;
+
+    if (!member.optional)
+    {
+        destination.serialize_member(member.id, transcoded);
+        return;
+    }
+
+    uint32_t member_size {0};
+    const bool present {deserialize_presence(source, member_size)};
+    const size_t value_begin {source.get_serialized_data_length()};
+    destination.serialize_member(member.id, present ? optional<TranscodedValue>(transcoded) :
+            optional<TranscodedValue>());
+    end_optional_member(source, member_size, value_begin);
+}
+
+size_t TypeInterpreter::calculate_transcoded_value_size(
+        Cdr& source,
+        CdrSizeCalculator& calculator,
+        uint32_t index,
+        size_t& current_alignment) const
+{
+    Cdr::nesting_scope scope(source);
+
+    if (!scope)
+    {
+        return 0;
+    }
+
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+        {
+            PrimitiveTranscodedSizeCalculator visitor {source, calculator, current_alignment, 0};
+            visit_primitive(instruction.kind, visitor);
+            return visitor.calculated_size;
+        }
+        case OpCode::PRIMITIVE_ARRAY:
+        {
+            PrimitiveArrayTranscodedSizeCalculator visitor {calculator, instruction.count, current_alignment, 0, 0};
+            visit_primitive(instruction.kind, visitor);
+            source.jump_primitives(instruction.kind, instruction.count);
+            return visitor.calculated_size;
+        }
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            uint32_t length {0};
+
+            if (!deserialize_length(source, instruction, length) ||
+                    !source.jump_primitives(instruction.kind, length))
+            {
+                return 0;
+            }
+
+            size_t initial_alignment {current_alignment};
+            current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            size_t calculated_size {current_alignment - initial_alignment};
+
+            PrimitiveArrayTranscodedSizeCalculator visitor {calculator, length, current_alignment, 0, 0};
+            visit_primitive(instruction.kind, visitor);
+            calculated_size += visitor.calculated_size;
+
+            if (CdrVersion::XCDRv2 == calculator.cdr_version_)
+            {
+                // Same rule as CdrSizeCalculator::get_serialized_member_size.
+                calculator.serialized_member_size_ = 1 == visitor.element_size ?
+                        CdrSizeCalculator::SERIALIZED_MEMBER_SIZE :
+                        (4 == visitor.element_size ? CdrSizeCalculator::SERIALIZED_MEMBER_SIZE_4 :
+                        (8 == visitor.element_size ? CdrSizeCalculator::SERIALIZED_MEMBER_SIZE_8 :
+                        CdrSizeCalculator::NO_SERIALIZED_MEMBER_SIZE));
+            }
+
+            return calculated_size;
+        }
+        case OpCode::STRING8:
+        case OpCode::STRING16:
+        {
+            uint32_t length {0};
+            source.deserialize(length);
+            const bool narrow {OpCode::STRING8 == instruction.op};
+            const size_t string_length {narrow && 0 < length ? length - 1 : length};
+
+            if (0 < instruction.count && instruction.count < string_length)
+            {
+                source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "String length exceeds its bound");
+                return 0;
+            }
+
+            if (source.get_remaining_length() / (narrow ? 1 : 2) < length)
+            {
+                source.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+                return 0;
+            }
+
+            source.jump(narrow ? length : length * size_t(2));
+
+            // Same sizes as the ones of std::string and std::wstring.
+            size_t calculated_size {4 + calculator.alignment(current_alignment, 4) +
+                                    (narrow ? string_length + 1 : string_length * 2)};
+            current_alignment += calculated_size;
+
+            if (narrow)
+            {
+                calculator.serialized_member_size_ = CdrSizeCalculator::SERIALIZED_MEMBER_SIZE;
+            }
+
+            return calculated_size;
+        }
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            uint32_t dheader {0};
+            size_t elements_begin {0};
+            uint32_t length {0};
+
+            if (!begin_collection(source, instruction, dheader, elements_begin, length))
+            {
+                return 0;
+            }
+
+            const bool delimited {instruction.dheader && CdrVersion::XCDRv2 == calculator.cdr_version_};
+            size_t initial_alignment {current_alignment};
+
+            if (delimited)
+            {
+                // DHEADER
+                current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            }
+
+            if (OpCode::ARRAY != instruction.op)
+            {
+                current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            }
+
+            size_t calculated_size {current_alignment - initial_alignment};
+            const size_t num_elements {OpCode::MAP == instruction.op ? size_t(length) * 2 : size_t(length)};
+
+            for (size_t count {0}; count < num_elements && Cdr::CDR_ERROR_NONE == source.get_error(); ++count)
+            {
+                calculated_size += calculate_transcoded_value_size(source, calculator,
+                                OpCode::MAP == instruction.op && 0 == count % 2 ? instruction.key : instruction.element,
+                                current_alignment);
+            }
+
+            if (!end_collection(source, instruction, dheader, elements_begin))
+            {
+                return 0;
+            }
+
+            if (delimited)
+            {
+                // Inform DHEADER can be joined with NEXTINT
+                calculator.serialized_member_size_ = CdrSizeCalculator::SERIALIZED_MEMBER_SIZE;
+            }
+
+            return calculated_size;
+        }
+        case OpCode::STRUCTURE:
+            return calculate_transcoded_structure_size(source, calculator, instruction, current_alignment);
+    }
+
+    return 0;
+}
+
+size_t TypeInterpreter::calculate_transcoded_structure_size(
+        Cdr& source,
+        CdrSizeCalculator& calculator,
+        const Instruction& instruction,
+        size_t& current_alignment) const
+{
+    const EncodingAlgorithmFlag source_encoding {encoding(instruction, source.get_cdr_version())};
+    const EncodingAlgorithmFlag destination_encoding {encoding(instruction, calculator.get_cdr_version())};
+    const bool by_id {EncodingAlgorithmFlag::PL_CDR == source_encoding ||
+                      EncodingAlgorithmFlag::PL_CDR2 == source_encoding};
+    uint32_t transcoded_members {0};
+
+    EncodingAlgorithmFlag previous_encoding {calculator.get_encoding()};
+    size_t calculated_size {calculator.begin_calculate_type_serialized_size(destination_encoding, current_alignment)};
+
+    source.deserialize_type(source_encoding,
+            [this, &instruction, &calculator, &calculated_size, &current_alignment, &transcoded_members, by_id](
+                Cdr& scdr, const MemberId& mid) -> bool
+            {
+                const MemberInstruction* member {decoded_member(instruction, mid, by_id)};
+
+                if (nullptr == member)
+                {
+                    return false;
+                }
+
+                calculated_size += calculate_transcoded_member_size(scdr, calculator, *member, current_alignment);
+                ++transcoded_members;
+                return true;
+            });
+
+    if (!by_id && transcoded_members < instruction.member_count &&
+            EncodingAlgorithmFlag::DELIMIT_CDR2 != destination_encoding)
+    {
+        source.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Members required by the destination encoding are missing");
+        return 0;
+    }
+
+    calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
+
+    return calculated_size;
+}
+
+size_t TypeInterpreter::calculate_transcoded_member_size(
+        Cdr& source,
+        CdrSizeCalculator& calculator,
+        const MemberInstruction& member,
+        size_t& current_alignment) const
+{
+    TranscodedValue transcoded;
+    transcoded.interpreter = this;
+    transcoded.instruction = member.instruction;
+    transcoded.source = &source;
+
+    if (!member.optional)
+    {
+        return calculator.calculate_member_serialized_size(member.id, transcoded, current_alignment);
+    }
+
+    uint32_t member_size {0};
+    const bool present {deserialize_presence(source, member_size)};
+    const size_t value_begin {source.get_serialized_data_length()};
+    const size_t calculated_size {calculator.calculate_member_serialized_size(member.id,
+                                      present ? optional<TranscodedValue>(transcoded) : optional<TranscodedValue>(),
+                                      current_alignment)};
+    end_optional_member(source, member_size, value_begin);
+    return calculated_size;
+}
+
+bool TypeInterpreter::deserialize_length(
+        Cdr& cdr,
+        const Instruction& instruction,
+        uint32_t& length) const
+{
+    cdr.deserialize(length);
+
+    if (Cdr::CDR_ERROR_NONE != cdr.get_error())
+    {
+        return false;
+    }
+
+    if (0 < instruction.count && instruction.count < length)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Sequence length exceeds its bound");
+        return false;
+    }
+
+    if (cdr.get_remaining_length() < length)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return false;
+    }
+
+    return true;
+}
+
+bool TypeInterpreter::begin_collection(
+        Cdr& cdr,
+        const Instruction& instruction,
+        uint32_t& dheader,
+        size_t& elements_begin,
+        uint32_t& length) const
+{
+    if (instruction.dheader && CdrVersion::XCDRv2 == cdr.get_cdr_version())
+    {
+        cdr.deserialize(dheader);
+    }
+
+    elements_begin = cdr.get_serialized_data_length();
+    length = instruction.count;
+
+    return Cdr::CDR_ERROR_NONE == cdr.get_error() &&
+           (OpCode::ARRAY == instruction.op || deserialize_length(cdr, instruction, length));
+}
+
+bool TypeInterpreter::end_collection(
+        Cdr& cdr,
+        const Instruction& instruction,
+        uint32_t dheader,
+        size_t elements_begin) const
+{
+    if (instruction.dheader && CdrVersion::XCDRv2 == cdr.get_cdr_version() &&
+            (cdr.get_serialized_data_length() - elements_begin) != dheader)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Member size differs from the size specified by DHEADER");
+        return false;
+    }
+
+    return Cdr::CDR_ERROR_NONE == cdr.get_error();
+}
+
+TypeInterpreter::StructureState TypeInterpreter::begin_structure(
+        Cdr& cdr,
+        const Instruction& instruction,
+        uint32_t& dheader) const
+{
+    const EncodingAlgorithmFlag type_encoding {encoding(instruction, cdr.get_cdr_version())};
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == type_encoding || EncodingAlgorithmFlag::DELIMIT_CDR2 == type_encoding)
+    {
+        cdr.deserialize(dheader);
+
+        if (Cdr::CDR_ERROR_NONE == cdr.get_error() && cdr.get_remaining_length() < dheader)
+        {
+            cdr.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+        }
+    }
+
+    StructureState members_state(cdr);
+    members_state.previous_encoding = cdr.get_current_encoding_flag();
+    cdr.set_current_encoding_flag(type_encoding);
+    return members_state;
+}
+
+void TypeInterpreter::end_structure(
+        Cdr& cdr,
+        const StructureState& members_state,
+        uint32_t dheader) const
+{
+    if (Cdr::CDR_ERROR_NONE == cdr.get_error() &&
+            (EncodingAlgorithmFlag::PL_CDR2 == cdr.get_current_encoding_flag() ||
+            EncodingAlgorithmFlag::DELIMIT_CDR2 == cdr.get_current_encoding_flag()))
+    {
+        // Skip the members not found in the description.
+        const size_t decoded_size {cdr.get_serialized_data_length() - members_state.members_begin};
+
+        if (dheader < decoded_size)
+        {
+            cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+        }
+        else
+        {
+            cdr.jump(dheader - decoded_size);
+        }
+    }
+
+    cdr.set_current_encoding_flag(members_state.previous_encoding);
+}
+
+bool TypeInterpreter::has_next_member(
+        const Cdr& cdr,
+        const StructureState& members_state,
+        uint32_t dheader) const
+{
+    // Same condition as Cdr::deserialize_type.
+    if (EncodingAlgorithmFlag::DELIMIT_CDR2 == cdr.get_current_encoding_flag())
+    {
+        return (cdr.get_serialized_data_length() - members_state.members_begin) < dheader;
+    }
+
+    return 0 < cdr.get_remaining_length();
+}
+
+bool TypeInterpreter::next_member_header(
+        Cdr& cdr,
+        const StructureState& members_state,
+        uint32_t dheader,
+        MemberId& member_id,
+        uint32_t& member_size) const
+{
+    if (Cdr::CDR_ERROR_NONE != cdr.get_error())
+    {
+        return false;
+    }
+
+    if (EncodingAlgorithmFlag::PL_CDR2 == cdr.get_current_encoding_flag())
+    {
+        const size_t decoded_size {cdr.get_serialized_data_length() - members_state.members_begin};
+
+        if (dheader == decoded_size)
+        {
+            return false;
+        }
+        else if (dheader < decoded_size)
+        {
+            cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM, "Member size greater than size specified by DHEADER");
+            return false;
+        }
+    }
+
+    if (!cdr.deserialize_member_header(member_id, member_size))
+    {
+        // Sentinel found, or the header could not be decoded.
+        return false;
+    }
+
+    if (cdr.get_remaining_length() < member_size)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_NOT_ENOUGH_MEMORY);
+        return false;
+    }
+
+    return true;
+}
+
+bool TypeInterpreter::end_member_value(
+        Cdr& cdr,
+        uint32_t member_size,
+        size_t value_begin) const
+{
+    const size_t decoded_size {cdr.get_serialized_data_length() - value_begin};
+
+    if (Cdr::CDR_ERROR_NONE != cdr.get_error())
+    {
+        return false;
+    }
+
+    if (member_size < decoded_size)
+    {
+        cdr.report_error(Cdr::CDR_ERROR_BAD_PARAM,
+                "Member size provided by member header is lower than real decoded member size");
+        return false;
+    }
+
+    return cdr.jump(member_size - decoded_size);
+}
+
+bool TypeInterpreter::find_encoded_member(
+        Cdr& cdr,
+        const StructureState& members_state,
+        uint32_t dheader,
+        uint32_t id,
+        uint32_t& member_size) const
+{
+    cdr.set_state(members_state.members);
+    MemberId member_id;
+
+    while (next_member_header(cdr, members_state, dheader, member_id, member_size))
+    {
+        if (id == member_id.id)
+        {
+            return true;
+        }
+
+        const size_t value_begin {cdr.get_serialized_data_length()};
+
+        if (!end_member_value(cdr, member_size, value_begin))
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+bool TypeInterpreter::equal_primitives(
+        Cdr& first,
+        Cdr& second,
+        TypeKind kind,
+        size_t num_elements) const
+{
+    if (!first.jump_primitives(kind, num_elements) || !second.jump_primitives(kind, num_elements))
+    {
+        return false;
+    }
+
+    const size_t size {TypeDescription::primitive_size(kind)};
+    const char* first_bytes {first.get_current_position() - size * num_elements};
+    const char* second_bytes {second.get_current_position() - size * num_elements};
+
+    if (1 == size || first.endianness() == second.endianness())
+    {
+        return 0 == memcmp(first_bytes, second_bytes, size * num_elements);
+    }
+
+    for (size_t element {0}; element < num_elements; ++element)
+    {
+        for (size_t byte {0}; byte < size; ++byte)
+        {
+            if (first_bytes[byte] != second_bytes[size - 1 - byte])
+            {
+                return false;
+            }
+        }
+
+        first_bytes += size;
+        second_bytes += size;
+    }
+
+    return true;
+}
+
+bool TypeInterpreter::equal_value(
+        Cdr& first,
+        Cdr& second,
+        uint32_t index) const
+{
+    Cdr::nesting_scope scope(first);
+
+    if (!scope)
+    {
+        return false;
+    }
+
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+            return equal_primitives(first, second, instruction.kind, 1);
+        case OpCode::PRIMITIVE_ARRAY:
+            return equal_primitives(first, second, instruction.kind, instruction.count);
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            uint32_t first_length {0};
+            uint32_t second_length {0};
+            return deserialize_length(first, instruction, first_length) &&
+                   deserialize_length(second, instruction, second_length) && first_length == second_length &&
+                   equal_primitives(first, second, instruction.kind, first_length);
+        }
+        case OpCode::STRING8:
+        {
+            uint32_t first_length {0};
+            uint32_t second_length {0};
+            first.deserialize(first_length);
+            second.deserialize(second_length);
+
+            // The length includes the null terminator, which some implementations don't send for empty strings.
+            const uint32_t string_length {0 < first_length ? first_length - 1 : 0};
+
+            if ((0 < second_length ? second_length - 1 : 0) != string_length ||
+                    !equal_primitives(first, second, TypeKind::CHAR8, string_length))
+            {
+                return false;
+            }
+
+            return (0 == first_length || first.jump(1)) && (0 == second_length || second.jump(1));
+        }
+        case OpCode::STRING16:
+        {
+            uint32_t first_length {0};
+            uint32_t second_length {0};
+            first.deserialize(first_length);
+            second.deserialize(second_length);
+            return first_length == second_length &&
+                   equal_primitives(first, second, TypeKind::CHAR16, first_length);
+        }
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            uint32_t first_dheader {0};
+            uint32_t second_dheader {0};
+            size_t first_begin {0};
+            size_t second_begin {0};
+            uint32_t first_length {0};
+            uint32_t second_length {0};
+
+            if (!begin_collection(first, instruction, first_dheader, first_begin, first_length) ||
+                    !begin_collection(second, instruction, second_dheader, second_begin, second_length) ||
+                    first_length != second_length)
+            {
+                return false;
+            }
+
+            const size_t num_elements {OpCode::MAP == instruction.op ? size_t(first_length) * 2 :
+                                       size_t(first_length)};
+
+            for (size_t count {0}; count < num_elements; ++count)
+            {
+                if (!equal_value(first, second, OpCode::MAP == instruction.op && 0 == count % 2 ?
+                        instruction.key : instruction.element))
+                {
+                    return false;
+                }
+            }
+
+            return end_collection(first, instruction, first_dheader, first_begin) &&
+                   end_collection(second, instruction, second_dheader, second_begin);
+        }
+        case OpCode::STRUCTURE:
+            return equal_structure(first, second, instruction);
+    }
+
+    return false;
+}
+
+bool TypeInterpreter::equal_structure(
+        Cdr& first,
+        Cdr& second,
+        const Instruction& instruction) const
+{
+    uint32_t first_dheader {0};
+    uint32_t second_dheader {0};
+    const StructureState first_members {begin_structure(first, instruction, first_dheader)};
+    const StructureState second_members {begin_structure(second, instruction, second_dheader)};
+
+    if (Cdr::CDR_ERROR_NONE != first.get_error() || Cdr::CDR_ERROR_NONE != second.get_error())
+    {
+        return false;
+    }
+
+    if (EncodingAlgorithmFlag::PL_CDR == first.get_current_encoding_flag() ||
+            EncodingAlgorithmFlag::PL_CDR2 == first.get_current_encoding_flag())
+    {
+        // Each known member of the first value is looked up in the second one, jumping the other values.
+        uint32_t first_member_size {0};
+        uint32_t second_member_size {0};
+        MemberId member_id;
+        uint32_t first_count {0};
+
+        while (next_member_header(first, first_members, first_dheader, member_id, first_member_size))
+        {
+            const size_t first_value {first.get_serialized_data_length()};
+            const MemberInstruction* member {find_member(instruction, member_id.id)};
+
+            if (nullptr != member)
+            {
+                ++first_count;
+
+                if (!find_encoded_member(second, second_members, second_dheader, member_id.id, second_member_size))
+                {
+                    return false;
+                }
+
+                const size_t second_value {second.get_serialized_data_length()};
+
+                if (!equal_value(first, second, member->instruction) ||
+                        !end_member_value(second, second_member_size, second_value))
+                {
+                    return false;
+                }
+            }
+
+            if (!end_member_value(first, first_member_size, first_value))
+            {
+                return false;
+            }
+        }
+
+        // Both values are equal when the second one has no other known member.
+        second.set_state(second_members.members);
+        uint32_t second_count {0};
+
+        while (next_member_header(second, second_members, second_dheader, member_id, second_member_size))
+        {
+            const size_t second_value {second.get_serialized_data_length()};
+
+            if (nullptr != find_member(instruction, member_id.id))
+            {
+                ++second_count;
+            }
+
+            if (!end_member_value(second, second_member_size, second_value))
+            {
+                return false;
+            }
+        }
+
+        if (first_count != second_count)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for (uint32_t position {0}; position < instruction.member_count; ++position)
+        {
+            const bool first_has_member {has_next_member(first, first_members, first_dheader)};
+
+            if (has_next_member(second, second_members, second_dheader) != first_has_member)
+            {
+                return false;
+            }
+            else if (!first_has_member)
+            {
+                break;
+            }
+            else if (!equal_member(first, second, members_[instruction.first_member + position]))
+            {
+                return false;
+            }
+        }
+    }
+
+    end_structure(first, first_members, first_dheader);
+    end_structure(second, second_members, second_dheader);
+    return Cdr::CDR_ERROR_NONE == first.get_error() && Cdr::CDR_ERROR_NONE == second.get_error();
+}
+
+bool TypeInterpreter::equal_member(
+        Cdr& first,
+        Cdr& second,
+        const MemberInstruction& member) const
+{
+    if (!member.optional)
+    {
+        return equal_value(first, second, member.instruction);
+    }
+
+    uint32_t first_member_size {0};
+    uint32_t second_member_size {0};
+    const bool first_present {deserialize_presence(first, first_member_size)};
+    const bool second_present {deserialize_presence(second, second_member_size)};
+    const size_t first_value {first.get_serialized_data_length()};
+    const size_t second_value {second.get_serialized_data_length()};
+
+    if (first_present != second_present || (first_present && !equal_value(first, second, member.instruction)))
+    {
+        return false;
+    }
+
+    end_optional_member(first, first_member_size, first_value);
+    end_optional_member(second, second_member_size, second_value);
+    return Cdr::CDR_ERROR_NONE == first.get_error() && Cdr::CDR_ERROR_NONE == second.get_error();
+}
+
+void TypeInterpreter::hash_primitives(
+        Cdr& cdr,
+        TypeKind kind,
+        size_t num_elements,
+        uint64_t& hash) const
+{
+    if (!cdr.jump_primitives(kind, num_elements))
+    {
+        return;
+    }
+
+    const size_t size {TypeDescription::primitive_size(kind)};
+    const char* bytes {cdr.get_current_position() - size * num_elements};
+
+    if (1 == size || Cdr::LITTLE_ENDIANNESS == cdr.endianness())
+    {
+        hash_bytes(hash, bytes, size * num_elements);
+        return;
+    }
+
+    for (size_t element {0}; element < num_elements; ++element)
+    {
+        for (size_t byte {size}; 0 < byte; --byte)
+        {
+            hash_bytes(hash, bytes + byte - 1, 1);
+        }
+
+        bytes += size;
+    }
+}
+
+void TypeInterpreter::hash_value(
+        Cdr& cdr,
+        uint32_t index,
+        uint64_t& hash) const
+{
+    Cdr::nesting_scope scope(cdr);
+
+    if (!scope)
+    {
+        return;
+    }
+
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+            hash_primitives(cdr, instruction.kind, 1, hash);
+            break;
+        case OpCode::PRIMITIVE_ARRAY:
+            hash_primitives(cdr, instruction.kind, instruction.count, hash);
+            break;
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            uint32_t length {0};
+
+            if (deserialize_length(cdr, instruction, length))
+            {
+                hash_integer(hash, length, sizeof(length));
+                hash_primitives(cdr, instruction.kind, length, hash);
+            }
+            break;
+        }
+        case OpCode::STRING8:
+        {
+            uint32_t length {0};
+            cdr.deserialize(length);
+
+            // The length includes the null terminator, which some implementations don't send for empty strings.
+            const uint32_t string_length {0 < length ? length - 1 : 0};
+            hash_integer(hash, string_length, sizeof(string_length));
+            hash_primitives(cdr, TypeKind::CHAR8, string_length, hash);
+
+            if (0 < length)
+            {
+                cdr.jump(1);
+            }
+            break;
+        }
+        case OpCode::STRING16:
+        {
+            uint32_t length {0};
+            cdr.deserialize(length);
+            hash_integer(hash, length, sizeof(length));
+            hash_primitives(cdr, TypeKind::CHAR16, length, hash);
+            break;
+        }
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            uint32_t dheader {0};
+            size_t elements_begin {0};
+            uint32_t length {0};
+
+            if (!begin_collection(cdr, instruction, dheader, elements_begin, length))
+            {
+                break;
+            }
+
+            if (OpCode::ARRAY != instruction.op)
+            {
+                hash_integer(hash, length, sizeof(length));
+            }
+
+            const size_t num_elements {OpCode::MAP == instruction.op ? size_t(length) * 2 : size_t(length)};
+
+            for (size_t count {0}; count < num_elements && Cdr::CDR_ERROR_NONE == cdr.get_error(); ++count)
+            {
+                hash_value(cdr, OpCode::MAP == instruction.op && 0 == count % 2 ? instruction.key : instruction.element,
+                        hash);
+            }
+
+            end_collection(cdr, instruction, dheader, elements_begin);
+            break;
+        }
+        case OpCode::STRUCTURE:
+            hash_structure(cdr, instruction, hash);
+            break;
+    }
+}
+
+void TypeInterpreter::hash_structure(
+        Cdr& cdr,
+        const Instruction& instruction,
+        uint64_t& hash) const
+{
+    uint32_t dheader {0};
+    const StructureState members_state {begin_structure(cdr, instruction, dheader)};
+
+    if (EncodingAlgorithmFlag::PL_CDR == cdr.get_current_encoding_flag() ||
+            EncodingAlgorithmFlag::PL_CDR2 == cdr.get_current_encoding_flag())
+    {
+        // Members are hashed apart and added, so their order doesn't matter.
+        uint32_t member_size {0};
+        MemberId member_id;
+        uint64_t members_hash {0};
+
+        while (next_member_header(cdr, members_state, dheader, member_id, member_size))
+        {
+            const size_t value_begin {cdr.get_serialized_data_length()};
+            const MemberInstruction* member {find_member(instruction, member_id.id)};
+
+            if (nullptr != member)
+            {
+                uint64_t member_hash {FNV_OFFSET_BASIS};
+                hash_integer(member_hash, member_id.id, sizeof(member_id.id));
+                hash_value(cdr, member->instruction, member_hash);
+                members_hash += mix(member_hash);
+            }
+
+            if (!end_member_value(cdr, member_size, value_begin))
+            {
+                break;
+            }
+        }
+
+        hash_integer(hash, members_hash, sizeof(members_hash));
+    }
+    else
+    {
+        for (uint32_t position {0}; position < instruction.member_count &&
+                has_next_member(cdr, members_state, dheader) && Cdr::CDR_ERROR_NONE == cdr.get_error(); ++position)
+        {
+            const MemberInstruction& member = members_[instruction.first_member + position];
+
+            if (!member.optional)
+            {
+                hash_value(cdr, member.instruction, hash);
+                continue;
+            }
+
+            uint32_t member_size {0};
+            const bool present {deserialize_presence(cdr, member_size)};
+            const size_t value_begin {cdr.get_serialized_data_length()};
+            hash_integer(hash, present ? 1 : 0, 1);
+
+            if (present)
+            {
+                hash_value(cdr, member.instruction, hash);
+            }
+
+            end_optional_member(cdr, member_size, value_begin);
+        }
+    }
+
+    end_structure(cdr, members_state, dheader);
+}
+
+const TypeInterpreter::MemberInstruction* TypeInterpreter::decoded_member(
+        const Instruction& instruction,
+        const MemberId& member_id,
+        bool by_id) const
+{
+    if (by_id)
+    {
+        return find_member(instruction, member_id.id);
+    }
+
+    return member_id.id < instruction.member_count ? &members_[instruction.first_member + member_id.id] : nullptr;
+}
+
+size_t TypeInterpreter::calculate_value_size(
+        CdrSizeCalculator& calculator,
+        uint32_t index,
+        const DynamicValue& value,
+        size_t& current_alignment) const
+{
+    const Instruction& instruction = instructions_[index];
+
+    switch (instruction.op)
+    {
+        case OpCode::PRIMITIVE:
+        {
+            PrimitiveSizeCalculator visitor {calculator, value, current_alignment, 0};
+            visit_primitive(instruction.kind, visitor);
+            return visitor.calculated_size;
+        }
+        case OpCode::PRIMITIVE_ARRAY:
+        {
+            PrimitiveArraySizeCalculator visitor {calculator, value, false, instruction.count, current_alignment, 0, 0};
+            visit_primitive(instruction.kind, visitor);
+            return visitor.calculated_size;
+        }
+        case OpCode::PRIMITIVE_SEQUENCE:
+        {
+            size_t initial_alignment {current_alignment};
+            current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            size_t calculated_size {current_alignment - initial_alignment};
+
+            PrimitiveArraySizeCalculator visitor {calculator, value, true, 0, current_alignment, 0, 0};
+            visit_primitive(instruction.kind, visitor);
+            calculated_size += visitor.calculated_size;
+
+            if (0 < instruction.count && instruction.count < visitor.count)
+            {
+                FASTCDR_THROW(exception::BadParamException("Sequence length exceeds its bound"));
+            }
+
+            if (CdrVersion::XCDRv2 == calculator.cdr_version_)
+            {
+                // Same rule as CdrSizeCalculator::get_serialized_member_size.
+                calculator.serialized_member_size_ = 1 == visitor.element_size ?
+                        CdrSizeCalculator::SERIALIZED_MEMBER_SIZE :
+                        (4 == visitor.element_size ? CdrSizeCalculator::SERIALIZED_MEMBER_SIZE_4 :
+                        (8 == visitor.element_size ? CdrSizeCalculator::SERIALIZED_MEMBER_SIZE_8 :
+                        CdrSizeCalculator::NO_SERIALIZED_MEMBER_SIZE));
+            }
+
+            return calculated_size;
+        }
+        case OpCode::STRING8:
+            if (0 < instruction.count && instruction.count < value.string8.size())
+            {
+                FASTCDR_THROW(exception::BadParamException("String length exceeds its bound"));
+            }
+            return calculator.calculate_serialized_size(value.string8, current_alignment);
+        case OpCode::STRING16:
+            if (0 < instruction.count && instruction.count < value.string16.size())
+            {
+                FASTCDR_THROW(exception::BadParamException("String length exceeds its bound"));
+            }
+            return calculator.calculate_serialized_size(value.string16, current_alignment);
+        case OpCode::SEQUENCE:
+        case OpCode::ARRAY:
+        case OpCode::MAP:
+        {
+            size_t length {value.elements.size()};
+
+            if (OpCode::ARRAY == instruction.op && instruction.count != length)
+            {
+                FASTCDR_THROW(exception::BadParamException("Wrong number of array elements"));
+            }
+            else if (OpCode::MAP == instruction.op)
+            {
+                if (0 != length % 2)
+                {
+                    FASTCDR_THROW(exception::BadParamException("Map without value for its last key"));
+                }
+                length /= 2;
+            }
+
+            if (OpCode::ARRAY != instruction.op && 0 < instruction.count && instruction.count < length)
+            {
+                FASTCDR_THROW(exception::BadParamException("Sequence length exceeds its bound"));
+            }
+
+            const bool delimited {instruction.dheader && CdrVersion::XCDRv2 == calculator.cdr_version_};
+            size_t initial_alignment {current_alignment};
+
+            if (delimited)
+            {
+                // DHEADER
+                current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            }
+
+            if (OpCode::ARRAY != instruction.op)
+            {
+                current_alignment += 4 + calculator.alignment(current_alignment, 4);
+            }
+
+            size_t calculated_size {current_alignment - initial_alignment};
+
+            for (size_t count {0}; count < value.elements.size(); ++count)
+            {
+                calculated_size += calculate_value_size(calculator, OpCode::MAP == instruction.op && 0 == count % 2 ?
+                                instruction.key : instruction.element, value.elements[count], current_alignment);
+            }
+
+            if (delimited)
+            {
+                // Inform DHEADER can be joined with NEXTINT
+                calculator.serialized_member_size_ = CdrSizeCalculator::SERIALIZED_MEMBER_SIZE;
+            }
+
+            return calculated_size;
+        }
+        case OpCode::STRUCTURE:
+            return calculate_structure_size(calculator, instruction, value, current_alignment);
+    }
+
+    return 0;
+}
+
+size_t TypeInterpreter::calculate_structure_size(
+        CdrSizeCalculator& calculator,
+        const Instruction& instruction,
+        const DynamicValue& value,
+        size_t& current_alignment) const
+{
+    if (instruction.member_count != value.elements.size())
+    {
+        FASTCDR_THROW(exception::BadParamException("Wrong number of structure members"));
+    }
+
+    EncodingAlgorithmFlag previous_encoding {calculator.get_encoding()};
+    size_t calculated_size {calculator.begin_calculate_type_serialized_size(
+                                encoding(instruction, calculator.get_cdr_version()), current_alignment)};
+
+    for (uint32_t position {0}; position < instruction.member_count; ++position)
+    {
+        const MemberInstruction& member = members_[instruction.first_member + position];
+        BoundValue bound;
+        bound.interpreter = this;
+        bound.instruction = member.instruction;
+        bound.value = &value.elements[position];
+
+        if (member.optional)
+        {
+            calculated_size += calculator.calculate_member_serialized_size(member.id,
+                            bound.value->present ? optional<BoundValue>(bound) : optional<BoundValue>(),
+                            current_alignment);
+        }
+        else
+        {
+            calculated_size += calculator.calculate_member_serialized_size(member.id, bound, current_alignment);
+        }
+    }
+
+    calculated_size += calculator.end_calculate_type_serialized_size(previous_encoding, current_alignment);
+
+    return calculated_size;
+}
+
+const TypeInterpreter::MemberInstruction* TypeInterpreter::find_member(
+        const Instruction& instruction,
+        uint32_t id) const
+{
+    auto begin = member_ids_.begin() + instruction.first_member;
+    auto end = begin + instruction.member_count;
+    auto it = std::lower_bound(begin, end, std::make_pair(id, uint32_t(0)));
+
+    if (end == it || it->first != id)
+    {
+        return nullptr;
+    }
+
+    return &members_[instruction.first_member + it->second];
+}
+
+} // namespace fastcdr
+} // namespace eprosima
@@ -0,0 +1,56 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastcdr/dynamic/Validator.hpp>
+
+namespace eprosima {
+namespace fastcdr {
+
+ValidationResult validate(
+        const char* buffer,
+        size_t size,
+        const TypeDescription& description,
+        TypeDescription::TypeIndex type,
+        uint32_t max_nesting_depth)
+{
+    // The buffer is only read.
+    FastBuffer fast_buffer(const_cast<char*>(buffer), size);
+    Cdr cdr(fast_buffer);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+    cdr.set_max_nesting_depth(max_nesting_depth);
+
+    cdr.read_encapsulation();
+
+    if (Cdr::CDR_ERROR_NONE == cdr.get_error() && TypeKind::STRUCTURE == description.type(type).kind &&
+            TypeDescription::encoding(cdr.get_cdr_version(), description.type(type).extensibility) !=
+            cdr.get_encoding_flag())
+    {
+        ValidationResult result;
+        result.error = Cdr::CDR_ERROR_BAD_PARAM;
+        result.length = cdr.get_serialized_data_length();
+        result.message = "Encapsulation doesn't match the extensibility of the type";
+        return result;
+    }
+
+    cdr.skip(description, type, true);
+
+    ValidationResult result;
+    result.error = cdr.get_error();
+    result.length = cdr.get_serialized_data_length();
+    result.message = cdr.get_error_message();
+    return result;
+}
+
+} // namespace fastcdr
+} // namespace eprosima
@@ -0,0 +1,102 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+
+using namespace eprosima::fastcdr;
+
+class BoolSequenceTests : public ::testing::TestWithParam<size_t>
+{
+};
+
+/*!
+ * @test Sequences and arrays of booleans are encoded as one byte per boolean and decoded back.
+ */
+TEST_P(BoolSequenceTests, encode_decode)
+{
+    const size_t size {GetParam()};
+    std::vector<bool> value(size);
+    std::unique_ptr<bool[]> array_value(new bool[size + 1]);
+    for (size_t count {0}; count < size; ++count)
+    {
+        value[count] = 0 != ((count * 7 + count / 5) % 3);
+        array_value[count] = !value[count];
+    }
+
+    std::vector<char> buffer(size * 3 + 16);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer);
+    cdr << value;
+    cdr.serialize_array(value);
+    cdr.serialize_array(array_value.get(), size);
+    ASSERT_EQ(4 + size * 3, cdr.get_serialized_data_length());
+    for (size_t count {0}; count < size; ++count)
+    {
+        ASSERT_EQ(value[count] ? 1 : 0, buffer[4 + count]);
+        ASSERT_EQ(value[count] ? 1 : 0, buffer[4 + size + count]);
+        ASSERT_EQ(value[count] ? 0 : 1, buffer[4 + size * 2 + count]);
+    }
+
+    std::vector<bool> dvalue(3, true);
+    std::vector<bool> darray_value(size, true);
+    std::unique_ptr<bool[]> dbool_array(new bool[size + 1]);
+    cdr.reset();
+    cdr >> dvalue;
+    cdr.deserialize_array(darray_value);
+    cdr.deserialize_array(dbool_array.get(), size);
+    ASSERT_EQ(value, dvalue);
+    ASSERT_EQ(value, darray_value);
+    for (size_t count {0}; count < size; ++count)
+    {
+        ASSERT_EQ(array_value[count], dbool_array[count]);
+    }
+    ASSERT_EQ(4 + size * 3, cdr.get_serialized_data_length());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BoolSequenceTests,
+    BoolSequenceTests,
+    ::testing::Values(0u, 1u, 7u, 8u, 9u, 63u, 64u, 65u, 1001u));
+
+/*!
+ * @test Decoding a byte which is not 0 or 1 into a sequence of booleans fails without consuming the sequence.
+ */
+TEST(BoolSequenceErrorTests, unexpected_value)
+{
+    char buffer[32] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+    cdr << static_cast<uint32_t>(20);
+    buffer[4 + 17] = 2;
+
+    std::vector<bool> value;
+    cdr.reset();
+    EXPECT_THROW(cdr >> value, exception::BadParamException);
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+
+    // Arrays of bool leave the elements with unexpected values unchanged.
+    std::array<bool, 24> array_value;
+    array_value.fill(true);
+    uint32_t length {0};
+    cdr >> length >> array_value;
+    for (size_t count {0}; count < array_value.size(); ++count)
+    {
+        ASSERT_EQ(17u == count, array_value[count]);
+    }
+}
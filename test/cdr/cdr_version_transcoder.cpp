@@ -0,0 +1,144 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/Transcoder.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class CdrVersionTranscoderTests : public ::testing::TestWithParam<std::tuple<Cdr::Endianness, Extensibility>>
+{
+public:
+
+    char buffer_xcdrv1[1024] {};
+
+    char buffer_xcdrv2[1024] {};
+
+    char transcoded[1024] {};
+};
+
+//! Compares two payloads, except the options of the encapsulation, whose padding bits are only set when transcoding.
+static bool same_payload(
+        const char* expected,
+        const char* payload,
+        size_t length)
+{
+    return 0 == memcmp(expected, payload, 2) && 0 == memcmp(expected + 4, payload + 4, length - 4);
+}
+
+/*!
+ * @test A payload transcoded to the other CDR version is the same as the payload directly encoded with it, and its
+ * calculated size is the transcoded length.
+ */
+TEST_P(CdrVersionTranscoderTests, same_as_other_version)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    const TypeInterpreter interpreter(description);
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length_xcdrv1 {encode_sample(sample, CdrVersion::XCDRv1, std::get<0>(GetParam()), buffer_xcdrv1,
+            sizeof(buffer_xcdrv1))};
+    const size_t length_xcdrv2 {encode_sample(sample, CdrVersion::XCDRv2, std::get<0>(GetParam()), buffer_xcdrv2,
+            sizeof(buffer_xcdrv2))};
+
+    ASSERT_EQ(length_xcdrv2, calculate_transcoded_size(buffer_xcdrv1, length_xcdrv1, interpreter, types.sample,
+            CdrVersion::XCDRv2));
+    ASSERT_EQ(length_xcdrv2, transcode_cdr_version(buffer_xcdrv1, length_xcdrv1, transcoded, sizeof(transcoded),
+            interpreter, types.sample, CdrVersion::XCDRv2));
+    ASSERT_TRUE(same_payload(buffer_xcdrv2, transcoded, length_xcdrv2));
+
+    // The padding is not written, so it keeps the bytes of the previous transcoding.
+    memset(transcoded, 0, sizeof(transcoded));
+    ASSERT_EQ(length_xcdrv1, calculate_transcoded_size(buffer_xcdrv2, length_xcdrv2, interpreter, types.sample,
+            CdrVersion::XCDRv1));
+    ASSERT_EQ(length_xcdrv1, transcode_cdr_version(buffer_xcdrv2, length_xcdrv2, transcoded, sizeof(transcoded),
+            interpreter, types.sample, CdrVersion::XCDRv1));
+    ASSERT_TRUE(same_payload(buffer_xcdrv1, transcoded, length_xcdrv1));
+}
+
+/*!
+ * @test Truncated payloads, too small destinations and wrong encapsulations are reported.
+ */
+TEST_P(CdrVersionTranscoderTests, errors)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    const TypeInterpreter interpreter(description);
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length_xcdrv1 {encode_sample(sample, CdrVersion::XCDRv1, std::get<0>(GetParam()), buffer_xcdrv1,
+            sizeof(buffer_xcdrv1))};
+    const size_t length_xcdrv2 {encode_sample(sample, CdrVersion::XCDRv2, std::get<0>(GetParam()), buffer_xcdrv2,
+            sizeof(buffer_xcdrv2))};
+
+    EXPECT_THROW(transcode_cdr_version(buffer_xcdrv1, length_xcdrv1 / 2, transcoded, sizeof(transcoded),
+            interpreter, types.sample, CdrVersion::XCDRv2), exception::Exception);
+    EXPECT_THROW(transcode_cdr_version(buffer_xcdrv1, length_xcdrv1, transcoded, length_xcdrv2 - 1,
+            interpreter, types.sample, CdrVersion::XCDRv2), exception::NotEnoughMemoryException);
+    EXPECT_THROW(transcode_cdr_version(buffer_xcdrv1, length_xcdrv1, transcoded, sizeof(transcoded),
+            interpreter, types.sample, CdrVersion::CORBA_CDR), exception::BadParamException);
+
+    // The encapsulation of the other extensibilities doesn't match the type.
+    TypeDescription other_description;
+    const DescribedSampleTypes other_types {describe_sample(other_description,
+                                            Extensibility::MUTABLE == std::get<1>(GetParam()) ?
+                                            Extensibility::FINAL : Extensibility::MUTABLE)};
+    const TypeInterpreter other_interpreter(other_description);
+    EXPECT_THROW(transcode_cdr_version(buffer_xcdrv2, length_xcdrv2, transcoded, sizeof(transcoded),
+            other_interpreter, other_types.sample, CdrVersion::XCDRv1), exception::BadParamException);
+}
+
+/*!
+ * @test A payload nesting a recursive type without end is refused once the maximum nesting depth is exceeded,
+ * instead of exhausting the stack.
+ */
+TEST(CdrVersionTranscoderRecursiveTests, nesting_depth)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    const TypeDescription::TypeIndex recursive {description.declare_structure(Extensibility::FINAL)};
+    Member next {MemberId(0), recursive};
+    next.optional = true;
+    description.set_members(recursive, {next});
+    const TypeInterpreter interpreter(description);
+
+    std::vector<char> buffer(200000, 1);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+    cdr.serialize_encapsulation();
+
+    std::vector<char> destination(buffer.size());
+    EXPECT_THROW(calculate_transcoded_size(buffer.data(), buffer.size(), interpreter, recursive, CdrVersion::XCDRv1),
+            exception::BadParamException);
+    EXPECT_THROW(transcode_cdr_version(buffer.data(), buffer.size(), destination.data(), destination.size(),
+            interpreter, recursive, CdrVersion::XCDRv1), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CdrVersionTranscoderTests,
+    CdrVersionTranscoderTests,
+    ::testing::Combine(
+        ::testing::Values(Cdr::BIG_ENDIANNESS, Cdr::LITTLE_ENDIANNESS),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
@@ -0,0 +1,182 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstring>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/Crc32c.hpp>
+#include <fastcdr/dynamic/TypeInterpreter.hpp>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+//! Calculates the CRC-32C of a buffer bit by bit.
+static uint32_t reference_crc32c(
+        const char* data,
+        size_t size)
+{
+    uint32_t crc {0xFFFFFFFFu};
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        crc ^= static_cast<uint8_t>(data[i]);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ ((crc & 1u) ? 0x82F63B78u : 0u);
+        }
+    }
+
+    return ~crc;
+}
+
+/*!
+ * @test Check values of the CRC-32C, for any length and alignment of the data and when it is added in chunks.
+ */
+TEST(Crc32cTests, check_values)
+{
+    Crc32c crc;
+    EXPECT_EQ(0u, crc.value());
+    crc.update("123456789", 9);
+    EXPECT_EQ(0xE3069283u, crc.value());
+
+    char data[256];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<char>(i * 7 + 3);
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t size = 0; size < sizeof(data) - offset; size += 5)
+        {
+            crc.reset();
+            crc.update(data + offset, size);
+            EXPECT_EQ(reference_crc32c(data + offset, size), crc.value());
+
+            crc.reset();
+            crc.update(data + offset, size / 3);
+            crc.update(data + offset + size / 3, size - size / 3);
+            EXPECT_EQ(reference_crc32c(data + offset, size), crc.value());
+        }
+    }
+}
+
+class CdrChecksumTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    CdrChecksumTests()
+    {
+        types_ = describe_sample(description_, std::get<1>(GetParam()));
+    }
+
+    DescribedSample sample() const
+    {
+        DescribedSample sample;
+        sample.extensibility = std::get<1>(GetParam());
+        sample.string_sequence_value.assign(100, "patched");
+        return sample;
+    }
+
+    TypeDescription description_;
+
+    DescribedSampleTypes types_;
+};
+
+/*!
+ * @test The checksum of the encoded bytes is the checksum of the encoding once its headers were patched.
+ */
+TEST_P(CdrChecksumTests, serialize)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    char buffer[4096] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr.set_encoding_flag(TypeDescription::encoding(version, std::get<1>(GetParam())));
+    cdr.serialize_encapsulation();
+
+    Crc32c checksum;
+    cdr.set_checksum(&checksum);
+    cdr << sample() << sample();
+    const uint32_t value {cdr.get_checksum()};
+    const size_t length {cdr.get_serialized_data_length()};
+
+    EXPECT_EQ(reference_crc32c(buffer + 4, length - 4), value);
+    EXPECT_EQ(value, checksum.value());
+}
+
+/*!
+ * @test The checksum is updated with the bytes of a buffer which grows while encoding.
+ */
+TEST_P(CdrChecksumTests, serialize_growing_buffer)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    FastBuffer fast_buffer;
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr.set_encoding_flag(TypeDescription::encoding(version, std::get<1>(GetParam())));
+    cdr.serialize_encapsulation();
+
+    Crc32c checksum;
+    cdr.set_checksum(&checksum);
+    cdr << sample();
+    cdr << 3u;
+    const uint32_t value {cdr.get_checksum()};
+    const size_t length {cdr.get_serialized_data_length()};
+
+    EXPECT_EQ(reference_crc32c(fast_buffer.getBuffer() + 4, length - 4), value);
+}
+
+/*!
+ * @test The checksum of the decoded bytes is the same as the checksum of the encoded ones.
+ */
+TEST_P(CdrChecksumTests, deserialize)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    char buffer[4096] {};
+    uint32_t encoded_value {0};
+    {
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+        cdr.set_encoding_flag(TypeDescription::encoding(version, std::get<1>(GetParam())));
+        cdr.serialize_encapsulation();
+
+        Crc32c checksum;
+        cdr.set_checksum(&checksum);
+        cdr << sample();
+        encoded_value = cdr.get_checksum();
+    }
+
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+    TypeInterpreter interpreter(description_);
+    interpreter.read_encapsulation(cdr, types_.sample);
+
+    Crc32c checksum;
+    cdr.set_checksum(&checksum);
+    interpreter.skip(cdr, types_.sample);
+    EXPECT_EQ(encoded_value, cdr.get_checksum());
+
+    cdr.set_checksum(nullptr);
+    EXPECT_EQ(0u, cdr.get_checksum());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CdrChecksumTests,
+    CdrChecksumTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
@@ -0,0 +1,207 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/Compression.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
+using namespace eprosima::fastcdr;
+
+class CompressionTests : public ::testing::TestWithParam<CdrVersion>
+{
+public:
+
+    //! Encodes a log-like payload, returning the encoded data.
+    std::vector<char> encode(
+            size_t num_lines)
+    {
+        for (size_t i = 0; i < num_lines; ++i)
+        {
+            lines_.push_back("[INFO] sample " + std::to_string(i) + " received from participant 01.0f.44.5a");
+            map_[static_cast<int32_t>(i)] = "value " + std::to_string(i % 10);
+        }
+
+        FastBuffer fast_buffer;
+        Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+        cdr.serialize_encapsulation();
+        cdr << lines_ << map_;
+        return std::vector<char>(fast_buffer.getBuffer(), fast_buffer.getBuffer() + cdr.get_serialized_data_length());
+    }
+
+    //! Compresses and decompresses a payload, checking the decompressed one is the original.
+    std::vector<char> round_trip(
+            const std::vector<char>& payload)
+    {
+        std::vector<char> compressed(calculate_compressed_max_size(payload.size()));
+        compressed.resize(compress_payload(payload.data(), payload.size(), compressed.data(), compressed.size()));
+        EXPECT_TRUE(is_compressed_payload(compressed.data(), compressed.size()));
+        EXPECT_FALSE(is_compressed_payload(payload.data(), payload.size()));
+
+        std::vector<char> decompressed(calculate_decompressed_size(compressed.data(), compressed.size()));
+        EXPECT_EQ(payload.size(), decompressed.size());
+        EXPECT_EQ(decompressed.size(), decompress_payload(compressed.data(), compressed.size(), decompressed.data(),
+                decompressed.size()));
+        EXPECT_EQ(payload, decompressed);
+        return compressed;
+    }
+
+    std::vector<std::string> lines_;
+
+    std::map<int32_t, std::string> map_;
+};
+
+/*!
+ * @test Compressible payloads of several segments shrink and are decoded after being decompressed.
+ */
+TEST_P(CompressionTests, compressible_payload)
+{
+    const std::vector<char> payload {encode(3000)};
+    ASSERT_LT(2 * COMPRESSION_SEGMENT_SIZE, payload.size());
+
+    const std::vector<char> compressed {round_trip(payload)};
+    EXPECT_LT(compressed.size() * 3, payload.size());
+    EXPECT_EQ(payload[0], compressed[0]);
+    EXPECT_EQ(payload[1], compressed[1]);
+
+    std::vector<char> decompressed(calculate_decompressed_size(compressed.data(), compressed.size()));
+    decompress_payload(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+    FastBuffer fast_buffer(decompressed.data(), decompressed.size());
+    Cdr cdr(fast_buffer);
+    cdr.read_encapsulation();
+    std::vector<std::string> lines;
+    std::map<int32_t, std::string> map;
+    cdr >> lines >> map;
+    EXPECT_EQ(lines_, lines);
+    EXPECT_EQ(map_, map);
+}
+
+/*!
+ * @test Payloads compressed while they are encoded, record by record, are the ones compressed after encoding them.
+ */
+TEST_P(CompressionTests, compress_while_encoding)
+{
+    encode(3000);
+    const EncodingAlgorithmFlag record_encoding {CdrVersion::XCDRv2 == GetParam() ?
+                                                 EncodingAlgorithmFlag::DELIMIT_CDR2 :
+                                                 EncodingAlgorithmFlag::PLAIN_CDR};
+    FastBuffer fast_buffer;
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    cdr.serialize_encapsulation();
+    std::vector<char> streamed(calculate_compressed_max_size(200000));
+    PayloadCompressor compressor(streamed.data(), streamed.size());
+    cdr.set_compressor(&compressor);
+
+    for (const std::string& line : lines_)
+    {
+        Cdr::state current_state(cdr);
+        cdr.begin_serialize_type(current_state, record_encoding);
+        cdr << MemberId(0) << line << MemberId(1) << map_.at(static_cast<int32_t>(&line - lines_.data()));
+        cdr.end_serialize_type(current_state);
+    }
+
+    cdr.set_dds_cdr_options({{0, 0}});
+    streamed.resize(cdr.end_compression());
+    ASSERT_LT(2 * COMPRESSION_SEGMENT_SIZE, cdr.get_serialized_data_length());
+
+    std::vector<char> compressed(calculate_compressed_max_size(cdr.get_serialized_data_length()));
+    compressed.resize(compress_payload(fast_buffer.getBuffer(), cdr.get_serialized_data_length(), compressed.data(),
+            compressed.size()));
+    EXPECT_EQ(compressed, streamed);
+
+    // The destination is only known to be too small once the payload is complete.
+    char destination[64] {};
+    Cdr small_cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    small_cdr.serialize_encapsulation();
+    PayloadCompressor small_compressor(destination, sizeof(destination));
+    small_cdr.set_compressor(&small_compressor);
+    small_cdr << lines_;
+    EXPECT_THROW(small_cdr.end_compression(), exception::NotEnoughMemoryException);
+    EXPECT_EQ(0u, small_cdr.end_compression());
+}
+
+/*!
+ * @test Payloads which don't compress are stored and don't exceed the maximum compressed size.
+ */
+TEST_P(CompressionTests, incompressible_payload)
+{
+    std::mt19937 generator(7);
+    std::vector<char> payload(COMPRESSION_SEGMENT_SIZE + 1000);
+    for (char& byte : payload)
+    {
+        byte = static_cast<char>(generator());
+    }
+    payload[2] = 0;
+
+    const std::vector<char> compressed {round_trip(payload)};
+    EXPECT_EQ(calculate_compressed_max_size(payload.size()), compressed.size());
+
+    for (size_t size = 4; size < 40; ++size)
+    {
+        round_trip(std::vector<char>(payload.begin(), payload.begin() + static_cast<std::ptrdiff_t>(size)));
+        round_trip(std::vector<char>(size, 0));
+    }
+}
+
+/*!
+ * @test Wrong arguments and corrupted payloads are reported.
+ */
+TEST_P(CompressionTests, errors)
+{
+    const std::vector<char> payload {encode(100)};
+    std::vector<char> compressed(calculate_compressed_max_size(payload.size()));
+    compressed.resize(compress_payload(payload.data(), payload.size(), compressed.data(), compressed.size()));
+    std::vector<char> destination(payload.size());
+
+    EXPECT_THROW(compress_payload(payload.data(), 3, destination.data(), destination.size()),
+            exception::BadParamException);
+    EXPECT_THROW(compress_payload(compressed.data(), compressed.size(), destination.data(), destination.size()),
+            exception::BadParamException);
+    EXPECT_THROW(compress_payload(payload.data(), payload.size(), destination.data(), compressed.size() - 1),
+            exception::NotEnoughMemoryException);
+    EXPECT_THROW(calculate_decompressed_size(payload.data(), payload.size()), exception::BadParamException);
+    EXPECT_THROW(decompress_payload(compressed.data(), compressed.size(), destination.data(), destination.size() - 1),
+            exception::NotEnoughMemoryException);
+    EXPECT_THROW(decompress_payload(compressed.data(), compressed.size() - 1, destination.data(), destination.size()),
+            exception::BadParamException);
+
+    // Corrupted payloads are either rejected or decompressed without exceeding the buffers.
+    std::mt19937 generator(11);
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::vector<char> corrupted {compressed};
+        const size_t position {8 + generator() % (corrupted.size() - 8)};
+        corrupted[position] = static_cast<char>(generator());
+
+        try
+        {
+            decompress_payload(corrupted.data(), corrupted.size(), destination.data(), destination.size());
+        }
+        catch (const exception::BadParamException&)
+        {
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CompressionTests,
+    CompressionTests,
+    ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2));
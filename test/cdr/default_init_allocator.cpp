@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+static size_t constructions {0};
+
+/*!
+ * @brief Allocator which counts the elements constructed through it.
+ */
+template<class T>
+struct CountingAllocator : public std::allocator<T>
+{
+    template<class U>
+    struct rebind
+    {
+        using other = CountingAllocator<U>;
+    };
+
+    CountingAllocator() = default;
+
+    template<class U>
+    CountingAllocator(
+            const CountingAllocator<U>&) noexcept
+    {
+    }
+
+    template<class U, class ... Args>
+    void construct(
+            U* ptr,
+            Args&&... args)
+    {
+        ++constructions;
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+};
+
+using RecycledSequence = std::vector<uint32_t, default_init_allocator<uint32_t, CountingAllocator<uint32_t>>>;
+
+class DefaultInitAllocatorTests : public ::testing::TestWithParam<CdrVersion>
+{
+};
+
+/*!
+ * @test Decoding a sequence using default_init_allocator doesn't construct the elements before decoding them and
+ * reuses the capacity of the sequence.
+ */
+TEST_P(DefaultInitAllocatorTests, decode_without_zero_fill)
+{
+    const CdrVersion version {GetParam()};
+    std::vector<uint32_t> value(1000);
+    for (uint32_t count {0}; count < value.size(); ++count)
+    {
+        value[count] = count * 3;
+    }
+
+    char buffer[4100];
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << value;
+
+    RecycledSequence recycled;
+    recycled.reserve(value.size());
+    const uint32_t* storage {recycled.data()};
+
+    constructions = 0;
+    cdr.reset();
+    cdr >> recycled;
+    ASSERT_EQ(0u, constructions);
+    ASSERT_EQ(storage, recycled.data());
+    ASSERT_TRUE(std::equal(value.begin(), value.end(), recycled.begin(), recycled.end()));
+
+    // Decoding again into the recycled sequence.
+    recycled.clear();
+    cdr.reset();
+    cdr >> recycled;
+    ASSERT_EQ(0u, constructions);
+    ASSERT_EQ(storage, recycled.data());
+    ASSERT_TRUE(std::equal(value.begin(), value.end(), recycled.begin(), recycled.end()));
+
+    // Same encoding and size as a std::vector.
+    char other_buffer[4100];
+    FastBuffer other_fast_buffer(other_buffer, sizeof(other_buffer));
+    Cdr other_cdr(other_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    other_cdr << recycled;
+    ASSERT_EQ(cdr.get_serialized_data_length(), other_cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(buffer, other_buffer, cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    ASSERT_EQ(cdr.get_serialized_data_length(), calculator.calculate_serialized_size(recycled, current_alignment));
+}
+
+/*!
+ * @test Elements constructed with arguments are constructed by the underlying allocator.
+ */
+TEST(DefaultInitAllocatorConstructTests, construct_with_arguments)
+{
+    RecycledSequence sequence;
+    sequence.reserve(11);
+    constructions = 0;
+    sequence.resize(10);
+    ASSERT_EQ(0u, constructions);
+    sequence.push_back(7u);
+    ASSERT_EQ(1u, constructions);
+    ASSERT_EQ(7u, sequence[10]);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DefaultInitAllocatorTests,
+    DefaultInitAllocatorTests,
+    ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2));
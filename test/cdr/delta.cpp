@@ -0,0 +1,187 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/Delta.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class DeltaTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    DeltaTests()
+        : encoder_(std::get<0>(GetParam()))
+    {
+        sample_.extensibility = std::get<1>(GetParam());
+    }
+
+    //! Encodes the sample and applies the delta to the receiver's copy, which must end equal to the new sample.
+    size_t send()
+    {
+        std::vector<char> delta;
+        encoder_.encode(sample_, delta);
+        received_.resize(std::max(received_.size(), calculate_delta_sample_size(delta.data(), delta.size())));
+        received_size_ = apply_delta(delta.data(), delta.size(), received_.data(), received_size_, received_.size());
+        EXPECT_EQ(encoder_.get_sample_size(), received_size_);
+        EXPECT_EQ(0, memcmp(encoder_.get_sample(), received_.data(), received_size_));
+        EXPECT_GE(calculate_delta_max_size(received_size_), delta.size());
+        return delta.size();
+    }
+
+    DeltaEncoder encoder_;
+
+    DescribedSample sample_;
+
+    std::vector<char> received_;
+
+    size_t received_size_ {0};
+};
+
+/*!
+ * @test Consecutive samples are reconstructed from their deltas, which only hold the changed members.
+ */
+TEST_P(DeltaTests, consecutive_samples)
+{
+    size_t delta_size {send()};
+    EXPECT_LT(encoder_.get_sample_size(), delta_size);
+    EXPECT_EQ(12u, send());
+
+    sample_.long_long_value = 1000;
+    sample_.array_value[1][0] = 7;
+    EXPECT_GT(40u, send());
+
+    sample_.string_value = "a longer string, which moves the following members";
+    send();
+    sample_.string_value.clear();
+    sample_.map_value[3] = "three";
+    send();
+    sample_.optional_value.reset();
+    send();
+
+    encoder_.reset();
+    received_size_ = 0;
+    delta_size = send();
+    EXPECT_LT(encoder_.get_sample_size(), delta_size);
+}
+
+/*!
+ * @test The deltas of equal samples are equal, whatever was serialized before.
+ */
+TEST_P(DeltaTests, deterministic)
+{
+    std::vector<char> first;
+    encoder_.encode(sample_, first);
+
+    DeltaEncoder encoder(std::get<0>(GetParam()));
+    DescribedSample other;
+    other.extensibility = sample_.extensibility;
+    other.string_value = "other sample";
+    other.wstring_value = L"with a longer wide string";
+    std::vector<char> delta;
+    encoder.encode(other, delta);
+    encoder.reset();
+    encoder.encode(sample_, delta);
+    EXPECT_EQ(first, delta);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DeltaTests,
+    DeltaTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
+
+/*!
+ * @test Random changes, growing and shrinking buffers, are reconstructed in place.
+ */
+TEST(DeltaBufferTests, random_changes)
+{
+    std::mt19937 generator(5);
+    std::vector<char> previous;
+    std::vector<char> received(1024);
+    size_t received_size {0};
+
+    for (int i = 0; i < 500; ++i)
+    {
+        std::vector<char> sample {previous};
+        sample.resize(generator() % 1024);
+        for (size_t changes = generator() % 20; 0 < changes && !sample.empty(); --changes)
+        {
+            const size_t position {generator() % sample.size()};
+            const size_t length {std::min<size_t>(generator() % 16 + 1, sample.size() - position)};
+            for (size_t byte = 0; byte < length; ++byte)
+            {
+                sample[position + byte] = static_cast<char>(generator());
+            }
+        }
+
+        std::vector<char> delta(calculate_delta_max_size(sample.size()));
+        delta.resize(encode_delta(previous.data(), previous.size(), sample.data(), sample.size(), delta.data(),
+                delta.size()));
+        ASSERT_EQ(sample.size(), calculate_delta_sample_size(delta.data(), delta.size()));
+        received_size = apply_delta(delta.data(), delta.size(), received.data(), received_size, received.size());
+        ASSERT_EQ(sample, std::vector<char>(received.begin(),
+                received.begin() + static_cast<std::ptrdiff_t>(received_size)));
+        previous = sample;
+    }
+}
+
+/*!
+ * @test Deltas applied to another sample, truncated deltas and small buffers are reported, leaving the sample
+ * untouched.
+ */
+TEST(DeltaBufferTests, errors)
+{
+    std::vector<char> previous(200, 'a');
+    std::vector<char> sample(300, 'a');
+    sample[10] = 'b';
+    std::vector<char> delta(calculate_delta_max_size(sample.size()));
+    EXPECT_THROW(encode_delta(previous.data(), previous.size(), sample.data(), sample.size(), delta.data(), 20),
+            exception::NotEnoughMemoryException);
+    delta.resize(encode_delta(previous.data(), previous.size(), sample.data(), sample.size(), delta.data(),
+            delta.size()));
+
+    std::vector<char> received {previous};
+    received.resize(sample.size());
+    received[0] = 'c';
+    EXPECT_THROW(apply_delta(delta.data(), delta.size(), received.data(), previous.size(), received.size()),
+            exception::BadParamException);
+    EXPECT_EQ('c', received[0]);
+    received[0] = 'a';
+    EXPECT_THROW(apply_delta(delta.data(), delta.size(), received.data(), previous.size() - 1, received.size()),
+            exception::BadParamException);
+    EXPECT_THROW(apply_delta(delta.data(), delta.size(), received.data(), previous.size(), received.size() - 1),
+            exception::NotEnoughMemoryException);
+    EXPECT_THROW(apply_delta(delta.data(), delta.size() - 1, received.data(), previous.size(), received.size()),
+            exception::BadParamException);
+    EXPECT_THROW(calculate_delta_sample_size(delta.data(), 11), exception::BadParamException);
+    EXPECT_EQ(std::vector<char>(previous.begin(), previous.end()),
+            std::vector<char>(received.begin(), received.begin() + static_cast<std::ptrdiff_t>(previous.size())));
+
+    EXPECT_EQ(sample.size(), apply_delta(delta.data(), delta.size(), received.data(), previous.size(),
+            received.size()));
+    EXPECT_EQ(sample, received);
+}
@@ -0,0 +1,220 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _TEST_CDR_DESCRIBEDSAMPLE_HPP_
+#define _TEST_CDR_DESCRIBEDSAMPLE_HPP_
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/TypeDescription.hpp>
+
+namespace eprosima {
+namespace fastcdr {
+namespace test {
+
+//! Appendable structure used as member of DescribedSample.
+struct DescribedNested
+{
+    int16_t short_value {-3};
+
+    std::string string_value {"nested"};
+};
+
+/*!
+ * @brief Structure with members of every kind, whose extensibility is selected at runtime.
+ * Its description is built by describe_sample().
+ */
+struct DescribedSample
+{
+    Extensibility extensibility {Extensibility::FINAL};
+
+    uint8_t octet_value {1};
+
+    bool bool_value {true};
+
+    int64_t long_long_value {-2};
+
+    std::string string_value {"sample"};
+
+    std::wstring wstring_value {L"wide"};
+
+    std::vector<uint16_t> sequence_value {1, 2, 3};
+
+    std::vector<std::string> string_sequence_value {"a", "bb", ""};
+
+    std::array<std::array<int32_t, 2>, 3> array_value {{{{1, 2}}, {{3, 4}}, {{5, 6}}}};
+
+    std::array<std::string, 2> string_array_value {{"x", "yz"}};
+
+    std::map<int32_t, std::string> map_value {{1, "one"}, {2, "two"}};
+
+    DescribedNested nested_value;
+
+    optional<double> optional_value {2.5};
+
+    optional<uint32_t> absent_value;
+
+    std::string bounded_string_value {"bound"};
+};
+
+//! Indexes of the types of DescribedSample in the description built by describe_sample().
+struct DescribedSampleTypes
+{
+    TypeDescription::TypeIndex nested {0};
+
+    TypeDescription::TypeIndex sample {0};
+
+    TypeDescription::TypeIndex bounded_string {0};
+
+    TypeDescription::TypeIndex sequence {0};
+};
+
+/*!
+ * @brief Describes DescribedSample.
+ * @param[out] description Description where the types are added.
+ * @param[in] extensibility Extensibility of DescribedSample.
+ * @return Indexes of the added types.
+ */
+inline DescribedSampleTypes describe_sample(
+        TypeDescription& description,
+        Extensibility extensibility)
+{
+    using Member = TypeDescription::Member;
+    DescribedSampleTypes types;
+
+    types.nested = description.add_structure(Extensibility::APPENDABLE, {
+        Member{MemberId(0), TypeDescription::predefined(TypeKind::INT16)},
+        Member{MemberId(1), TypeDescription::predefined(TypeKind::STRING8)}
+    });
+    types.bounded_string = description.add_string(TypeKind::STRING8, 5);
+    types.sequence = description.add_sequence(TypeDescription::predefined(TypeKind::UINT16), 3);
+    const TypeDescription::TypeIndex string_sequence {
+        description.add_sequence(TypeDescription::predefined(TypeKind::STRING8))};
+    const TypeDescription::TypeIndex array {description.add_array(
+        description.add_array(TypeDescription::predefined(TypeKind::INT32), 2), 3)};
+    const TypeDescription::TypeIndex string_array {
+        description.add_array(TypeDescription::predefined(TypeKind::STRING8), 2)};
+    const TypeDescription::TypeIndex map {description.add_map(TypeDescription::predefined(TypeKind::INT32),
+        TypeDescription::predefined(TypeKind::STRING8))};
+
+    types.sample = description.add_structure(extensibility, {
+        Member{MemberId(0), TypeDescription::predefined(TypeKind::UINT8), false, true},
+        Member{MemberId(1), TypeDescription::predefined(TypeKind::BOOLEAN)},
+        Member{MemberId(2), TypeDescription::predefined(TypeKind::INT64)},
+        Member{MemberId(3), TypeDescription::predefined(TypeKind::STRING8)},
+        Member{MemberId(4), TypeDescription::predefined(TypeKind::STRING16)},
+        Member{MemberId(5), types.sequence},
+        Member{MemberId(6), string_sequence},
+        Member{MemberId(7), array},
+        Member{MemberId(8), string_array},
+        Member{MemberId(9), map},
+        Member{MemberId(10), types.nested},
+        Member{MemberId(11), TypeDescription::predefined(TypeKind::FLOAT64), true},
+        Member{MemberId(12), TypeDescription::predefined(TypeKind::UINT32), true},
+        Member{MemberId(13), types.bounded_string}
+    });
+
+    return types;
+}
+
+} // namespace test
+
+template<>
+inline void serialize(
+        Cdr& cdr,
+        const test::DescribedNested& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state,
+            TypeDescription::encoding(cdr.get_cdr_version(), Extensibility::APPENDABLE));
+    cdr << MemberId(0) << data.short_value << MemberId(1) << data.string_value;
+    cdr.end_serialize_type(current_state);
+}
+
+template<>
+inline void serialize(
+        Cdr& cdr,
+        const test::DescribedSample& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, TypeDescription::encoding(cdr.get_cdr_version(), data.extensibility));
+    cdr << MemberId(0) << data.octet_value << MemberId(1) << data.bool_value << MemberId(2) << data.long_long_value;
+    cdr << MemberId(3) << data.string_value << MemberId(4) << data.wstring_value;
+    cdr << MemberId(5) << data.sequence_value << MemberId(6) << data.string_sequence_value;
+    cdr << MemberId(7) << data.array_value << MemberId(8) << data.string_array_value;
+    cdr << MemberId(9) << data.map_value << MemberId(10) << data.nested_value;
+    cdr << MemberId(11) << data.optional_value << MemberId(12) << data.absent_value;
+    cdr << MemberId(13) << data.bounded_string_value;
+    cdr.end_serialize_type(current_state);
+}
+
+namespace test {
+
+/*!
+ * @brief Encodes a payload, starting with its encapsulation.
+ * @param[out] fast_buffer Buffer where the payload is encoded.
+ * @param[in] cdr_version CDR version of the payload.
+ * @param[in] endianness Endianness of the payload.
+ * @param[in] extensibility Extensibility of the encoded type, which selects the encapsulation.
+ * @param[in] encode_value Functor encoding the value with the eprosima::fastcdr::Cdr object it receives.
+ * @return Encoded length, including the encapsulation.
+ */
+template<class _Encoder>
+size_t encode_payload(
+        FastBuffer& fast_buffer,
+        CdrVersion cdr_version,
+        Cdr::Endianness endianness,
+        Extensibility extensibility,
+        _Encoder encode_value)
+{
+    Cdr cdr(fast_buffer, endianness, cdr_version);
+    cdr.set_encoding_flag(TypeDescription::encoding(cdr_version, extensibility));
+    cdr.serialize_encapsulation();
+    encode_value(cdr);
+    return cdr.get_serialized_data_length();
+}
+
+/*!
+ * @brief Encodes a DescribedSample, starting with its encapsulation.
+ * @param[in] sample Sample to be encoded.
+ * @param[in] cdr_version CDR version of the payload.
+ * @param[in] endianness Endianness of the payload.
+ * @param[out] buffer Buffer where the payload is encoded.
+ * @param[in] size Size of the buffer.
+ * @return Encoded length, including the encapsulation.
+ */
+inline size_t encode_sample(
+        const DescribedSample& sample,
+        CdrVersion cdr_version,
+        Cdr::Endianness endianness,
+        char* buffer,
+        size_t size)
+{
+    FastBuffer fast_buffer(buffer, size);
+    return encode_payload(fast_buffer, cdr_version, endianness, sample.extensibility,
+                   [&sample](Cdr& cdr)
+                   {
+                       cdr << sample;
+                   });
+}
+
+} // namespace test
+} // namespace fastcdr
+} // namespace eprosima
+
+#endif // _TEST_CDR_DESCRIBEDSAMPLE_HPP_
@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/Transcoder.hpp>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+static const Cdr::Endianness OTHER_ENDIAN {Cdr::LITTLE_ENDIANNESS == Cdr::DEFAULT_ENDIAN ?
+                                          Cdr::BIG_ENDIANNESS : Cdr::LITTLE_ENDIANNESS};
+
+class EndiannessTranscoderTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    char buffer_default[1024] {};
+
+    char buffer_other[1024] {};
+};
+
+/*!
+ * @test A payload transcoded in place is the same as the payload encoded with the other endianness, and
+ * transcoding it back restores the original payload.
+ */
+TEST_P(EndiannessTranscoderTests, same_as_other_endianness)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer_default,
+            sizeof(buffer_default))};
+    ASSERT_EQ(length, encode_sample(sample, std::get<0>(GetParam()), OTHER_ENDIAN, buffer_other, sizeof(buffer_other)));
+
+    char original[1024] {};
+    memcpy(original, buffer_default, length);
+
+    ValidationResult result {transcode_endianness(buffer_default, length, description, types.sample)};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error) << result.message;
+    ASSERT_EQ(length, result.length);
+    ASSERT_EQ(0, memcmp(buffer_other, buffer_default, length));
+
+    result = transcode_endianness(buffer_default, length, description, types.sample);
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error) << result.message;
+    ASSERT_EQ(0, memcmp(original, buffer_default, length));
+}
+
+/*!
+ * @test Invalid payloads and unknown members are reported without changing the encapsulation.
+ */
+TEST_P(EndiannessTranscoderTests, errors)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer_default,
+            sizeof(buffer_default))};
+    const char encapsulation {buffer_default[1]};
+
+    ValidationResult result {transcode_endianness(buffer_default, length - 1, description, types.sample)};
+    ASSERT_NE(Cdr::CDR_ERROR_NONE, result.error);
+    ASSERT_EQ(encapsulation, buffer_default[1]);
+
+    if (Extensibility::MUTABLE == std::get<1>(GetParam()))
+    {
+        // A description without the last member can't swap it.
+        using Member = TypeDescription::Member;
+        TypeDescription partial;
+        std::vector<Member> members;
+        const TypeDescription::Type& type {description.type(types.sample)};
+
+        for (uint32_t position {0}; position + 1 < type.member_count; ++position)
+        {
+            members.push_back(description.member(type, position));
+        }
+
+        // The member types are the same in a description built in the same order.
+        describe_sample(partial, Extensibility::MUTABLE);
+        const TypeDescription::TypeIndex partial_sample {partial.add_structure(Extensibility::MUTABLE, members)};
+        encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer_default, sizeof(buffer_default));
+        result = transcode_endianness(buffer_default, length, partial, partial_sample);
+        ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+        ASSERT_EQ(encapsulation, buffer_default[1]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    EndiannessTranscoderTests,
+    EndiannessTranscoderTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
+
+/*!
+ * @test Sequences of primitives of every width, long enough to be swapped in blocks, are transcoded.
+ */
+TEST(EndiannessTranscoderPrimitiveTests, primitive_sequences)
+{
+    TypeDescription description;
+    using Member = TypeDescription::Member;
+    const TypeDescription::TypeIndex type {description.add_structure(Extensibility::FINAL, {
+        Member{MemberId(0), description.add_sequence(TypeDescription::predefined(TypeKind::INT16))},
+        Member{MemberId(1), description.add_sequence(TypeDescription::predefined(TypeKind::UINT32))},
+        Member{MemberId(2), description.add_sequence(TypeDescription::predefined(TypeKind::FLOAT64))},
+        Member{MemberId(3), description.add_sequence(TypeDescription::predefined(TypeKind::CHAR8))}
+    })};
+
+    std::vector<int16_t> shorts;
+    std::vector<uint32_t> longs;
+    std::vector<double> doubles;
+    std::vector<char> chars;
+
+    for (int count {0}; count < 19; ++count)
+    {
+        shorts.push_back(static_cast<int16_t>(-count * 257));
+        longs.push_back(static_cast<uint32_t>(count) * 0x01020304u);
+        doubles.push_back(count * 1.5);
+        chars.push_back(static_cast<char>('a' + count));
+    }
+
+    char buffers[2][512] {};
+    size_t lengths[2] {};
+    const Cdr::Endianness endianness[2] {Cdr::DEFAULT_ENDIAN, OTHER_ENDIAN};
+
+    for (size_t index {0}; index < 2; ++index)
+    {
+        FastBuffer fast_buffer(buffers[index], sizeof(buffers[index]));
+        Cdr cdr(fast_buffer, endianness[index], CdrVersion::XCDRv2);
+        cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+        cdr.serialize_encapsulation();
+        cdr << shorts << longs << doubles << chars;
+        lengths[index] = cdr.get_serialized_data_length();
+    }
+
+    ASSERT_EQ(lengths[0], lengths[1]);
+    const ValidationResult result {transcode_endianness(buffers[0], lengths[0], description, type)};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error) << result.message;
+    ASSERT_EQ(0, memcmp(buffers[1], buffers[0], lengths[0]));
+}
+
+/*!
+ * @test A payload nesting a recursive type without end is reported once the maximum nesting depth is exceeded,
+ * instead of exhausting the stack, and its encapsulation is not changed.
+ */
+TEST(EndiannessTranscoderPrimitiveTests, nesting_depth)
+{
+    TypeDescription description;
+    using Member = TypeDescription::Member;
+    const TypeDescription::TypeIndex recursive {description.declare_structure(Extensibility::FINAL)};
+    Member next {MemberId(0), recursive};
+    next.optional = true;
+    description.set_members(recursive, {next});
+
+    std::vector<char> buffer(200000, 1);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+    cdr.serialize_encapsulation();
+    const std::vector<char> encapsulation(buffer.begin(), buffer.begin() + 4);
+
+    const ValidationResult result {transcode_endianness(buffer.data(), buffer.size(), description, recursive)};
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+    ASSERT_EQ(4u + Cdr::DEFAULT_MAX_NESTING_DEPTH, result.length);
+    ASSERT_TRUE(std::equal(encapsulation.begin(), encapsulation.end(), buffer.begin()));
+}
@@ -0,0 +1,291 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This test is built without exception support.
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+
+using namespace eprosima::fastcdr;
+
+static_assert(0 == FASTCDR_HAVE_EXCEPTIONS, "This test should be built without exception support");
+
+TEST(CdrErrorStateTests, default_error_mode)
+{
+    char buffer[4];
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+
+    ASSERT_EQ(Cdr::ErrorMode::THROW_EXCEPTIONS, cdr.get_error_mode());
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+    ASSERT_STREQ("", cdr.get_error_message());
+}
+
+TEST(CdrErrorStateTests, primitive_not_enough_memory)
+{
+    char buffer[6];
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+    uint32_t value {0xAABBCCDD};
+    cdr << value;
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+    cdr << value;
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+    ASSERT_STRNE("", cdr.get_error_message());
+    // Failed operation doesn't move the position.
+    ASSERT_EQ(4u, cdr.get_serialized_data_length());
+
+    cdr.reset();
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+    ASSERT_EQ(Cdr::ErrorMode::STICKY_ERROR, cdr.get_error_mode());
+
+    uint32_t dvalue {0};
+    uint64_t dlong {0};
+    cdr >> dvalue >> dlong;
+    ASSERT_EQ(value, dvalue);
+    ASSERT_EQ(0u, dlong);
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+
+    cdr.clear_error();
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+}
+
+TEST(CdrErrorStateTests, first_error_is_kept)
+{
+    char buffer[8];
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+    std::string str_with_null("foo\0bar", 7);
+    cdr << str_with_null;
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_BAD_PARAM, cdr.get_error());
+    ASSERT_STREQ("The string contains null characters", cdr.get_error_message());
+
+    uint64_t value {0};
+    cdr << value << value;
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_BAD_PARAM, cdr.get_error());
+}
+
+TEST(CdrErrorStateTests, containers)
+{
+    char buffer[24];
+
+    {
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+        std::vector<uint32_t> vector_value(10, 1u);
+        cdr << vector_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+    }
+
+    {
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+        std::string str_value("Hello");
+        std::array<std::string, 3> array_value {{str_value, str_value, str_value}};
+        cdr << array_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+    }
+
+    {
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+        uint32_t length {1000};
+        cdr << length;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+        cdr.reset();
+
+        std::vector<uint8_t> vector_value;
+        std::string str_value;
+        cdr >> vector_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+        ASSERT_TRUE(vector_value.empty());
+        cdr.clear_error();
+        cdr >> str_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+        ASSERT_TRUE(str_value.empty());
+    }
+
+    {
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+        // DHEADER shorter than the encoded map.
+        std::map<uint32_t, std::string> map_value {{1u, "a"}};
+        cdr << map_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+        uint32_t dheader {6};
+        cdr.reset();
+        cdr << dheader;
+        cdr.reset();
+
+        std::map<uint32_t, std::string> dmap_value;
+        cdr >> dmap_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_BAD_PARAM, cdr.get_error());
+    }
+
+    {
+        // Corrupted map length: decoding stops at the first failed element.
+        std::array<char, 8> map_buffer {{0x0F, char(0xFF), char(0xFF), char(0xFF), 0x00, 0x00, 0x00, 0x01}};
+        FastBuffer fast_buffer(map_buffer.data(), map_buffer.size());
+        Cdr cdr(fast_buffer, Cdr::BIG_ENDIANNESS, CdrVersion::XCDRv1);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+        std::map<uint32_t, std::string> dmap_value;
+        cdr >> dmap_value;
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+        ASSERT_GE(1u, dmap_value.size());
+    }
+}
+
+TEST(CdrErrorStateTests, xcdr_types)
+{
+    const std::array<EncodingAlgorithmFlag, 4> encodings {{
+                                                              EncodingAlgorithmFlag::PL_CDR,
+                                                              EncodingAlgorithmFlag::PLAIN_CDR2,
+                                                              EncodingAlgorithmFlag::DELIMIT_CDR2,
+                                                              EncodingAlgorithmFlag::PL_CDR2
+                                                          }};
+
+    for (auto encoding : encodings)
+    {
+        char buffer[64];
+        const CdrVersion version = EncodingAlgorithmFlag::PL_CDR == encoding ? CdrVersion::XCDRv1 :
+                CdrVersion::XCDRv2;
+
+        FastBuffer fast_buffer(buffer, sizeof(buffer));
+        Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+        cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+        cdr.set_encoding_flag(encoding);
+        cdr.serialize_encapsulation();
+
+        Cdr::state current_state(cdr);
+        cdr.begin_serialize_type(current_state, encoding);
+        cdr << MemberId(0) << uint32_t(1);
+        cdr << MemberId(1) << uint64_t(2);
+        cdr.end_serialize_type(current_state);
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, cdr.get_error());
+
+        // Decode from a truncated buffer.
+        FastBuffer truncated_buffer(buffer, cdr.get_serialized_data_length() - 4);
+        Cdr dcdr(truncated_buffer, Cdr::DEFAULT_ENDIAN, version);
+        dcdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+        dcdr.read_encapsulation();
+        ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NONE, dcdr.get_error());
+
+        uint32_t value1 {0};
+        uint64_t value2 {0};
+        dcdr.deserialize_type(encoding, [&](Cdr& cdr_inner, const MemberId& mid)->bool
+                {
+                    bool ret_value = true;
+                    switch (mid.id)
+                    {
+                        case 0:
+                            cdr_inner >> value1;
+                            break;
+                        case 1:
+                            cdr_inner >> value2;
+                            break;
+                        default:
+                            ret_value = false;
+                            break;
+                    }
+                    return ret_value;
+                });
+        ASSERT_NE(Cdr::ErrorCode::CDR_ERROR_NONE, dcdr.get_error());
+        ASSERT_EQ(1u, value1);
+    }
+}
+
+TEST(CdrErrorStateTests, truncated_xcdr_types)
+{
+    const std::array<EncodingAlgorithmFlag, 4> encodings {{
+                                                              EncodingAlgorithmFlag::PL_CDR,
+                                                              EncodingAlgorithmFlag::PLAIN_CDR,
+                                                              EncodingAlgorithmFlag::DELIMIT_CDR2,
+                                                              EncodingAlgorithmFlag::PL_CDR2
+                                                          }};
+
+    for (auto encoding : encodings)
+    {
+        const CdrVersion version = EncodingAlgorithmFlag::PL_CDR == encoding ||
+                EncodingAlgorithmFlag::PLAIN_CDR == encoding ? CdrVersion::XCDRv1 : CdrVersion::XCDRv2;
+
+        // Headers of members not completely encoded are not patched past the end of the buffer.
+        for (size_t size = 4;; ++size)
+        {
+            std::array<char, 96> buffer;
+            buffer.fill(0x5A);
+            FastBuffer fast_buffer(buffer.data(), size);
+            Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+            cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+            cdr.set_encoding_flag(encoding);
+            cdr.serialize_encapsulation();
+
+            Cdr::state current_state(cdr);
+            cdr.begin_serialize_type(current_state, encoding);
+            cdr << MemberId(0) << std::string("a string member");
+            cdr << MemberId(1) << optional<double>(2.0);
+            cdr << MemberId(2) << uint64_t(3);
+            cdr.end_serialize_type(current_state);
+
+            if (Cdr::ErrorCode::CDR_ERROR_NONE == cdr.get_error())
+            {
+                break;
+            }
+
+            ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+
+            for (size_t position = size; position < buffer.size(); ++position)
+            {
+                ASSERT_EQ(0x5A, buffer[position]);
+            }
+        }
+    }
+}
+
+TEST(CdrErrorStateTests, encapsulation)
+{
+    char buffer[4] {0, 0x20, 0, 0};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::DDS_CDR);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+    cdr.read_encapsulation();
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_BAD_PARAM, cdr.get_error());
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+
+    char small_buffer[1];
+    FastBuffer small_fast_buffer(small_buffer, sizeof(small_buffer));
+    Cdr scdr(small_fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    scdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+    scdr.serialize_encapsulation();
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, scdr.get_error());
+}
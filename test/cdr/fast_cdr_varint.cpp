@@ -0,0 +1,200 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/FastCdr.h>
+#include <fastcdr/FastCdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+//! Values of every integer type, small and at the limits of their ranges.
+struct Counters
+{
+    std::array<int16_t, 4> shorts {{0, -1, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max()}};
+
+    std::array<uint16_t, 3> ushorts {{0, 127, std::numeric_limits<uint16_t>::max()}};
+
+    std::vector<int32_t> longs {0, -64, 64, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()};
+
+    std::vector<uint32_t> ulongs {128, 16383, 16384, std::numeric_limits<uint32_t>::max()};
+
+    std::vector<int64_t> longlongs {-3, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()};
+
+    std::vector<uint64_t> ulonglongs {1, std::numeric_limits<uint64_t>::max()};
+
+    std::string text {"telemetry"};
+
+    std::wstring wide_text {L"wé中"};
+
+    std::vector<bool> flags {true, false, true};
+
+    double ratio {0.5};
+
+    void serialize(
+            FastCdr& cdr) const
+    {
+        cdr << shorts << ushorts << longs << ulongs << longlongs << ulonglongs;
+        cdr << text << wide_text << flags << ratio;
+        cdr << shorts[2] << ushorts[2] << longs[3] << ulongs[3] << longlongs[1] << ulonglongs[1];
+    }
+
+    void deserialize(
+            FastCdr& cdr)
+    {
+        cdr >> shorts >> ushorts >> longs >> ulongs >> longlongs >> ulonglongs;
+        cdr >> text >> wide_text >> flags >> ratio;
+        cdr >> shorts[2] >> ushorts[2] >> longs[3] >> ulongs[3] >> longlongs[1] >> ulonglongs[1];
+    }
+
+    size_t calculate_serialized_size(
+            const FastCdrSizeCalculator& calculator) const
+    {
+        return calculator.calculate_serialized_size(shorts) + calculator.calculate_serialized_size(ushorts) +
+               calculator.calculate_serialized_size(longs) + calculator.calculate_serialized_size(ulongs) +
+               calculator.calculate_serialized_size(longlongs) + calculator.calculate_serialized_size(ulonglongs) +
+               calculator.calculate_serialized_size(text) + calculator.calculate_serialized_size(wide_text) +
+               calculator.calculate_serialized_size(flags) + calculator.calculate_serialized_size(ratio) +
+               calculator.calculate_serialized_size(shorts[2]) + calculator.calculate_serialized_size(ushorts[2]) +
+               calculator.calculate_serialized_size(longs[3]) + calculator.calculate_serialized_size(ulongs[3]) +
+               calculator.calculate_serialized_size(longlongs[1]) +
+               calculator.calculate_serialized_size(ulonglongs[1]);
+    }
+
+    bool operator ==(
+            const Counters& other) const
+    {
+        return shorts == other.shorts && ushorts == other.ushorts && longs == other.longs && ulongs == other.ulongs &&
+               longlongs == other.longlongs && ulonglongs == other.ulonglongs && text == other.text &&
+               wide_text == other.wide_text && flags == other.flags && ratio == other.ratio;
+    }
+
+};
+
+class FastCdrVarintTests : public ::testing::TestWithParam<FastCdr::IntegerEncoding>
+{
+};
+
+/*!
+ * @test Integers at the limits of their ranges are decoded as encoded, in the size given by the size calculator.
+ */
+TEST_P(FastCdrVarintTests, round_trip)
+{
+    const Counters counters;
+    char buffer[1024] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    FastCdr cdr(fast_buffer, GetParam());
+    EXPECT_EQ(GetParam(), cdr.get_integer_encoding());
+    cdr << counters;
+    EXPECT_EQ(counters.calculate_serialized_size(FastCdrSizeCalculator(GetParam())), cdr.get_serialized_data_length());
+
+    Counters decoded;
+    decoded.shorts.fill(1);
+    decoded.longs.clear();
+    decoded.text.clear();
+    FastCdr decoder(fast_buffer, GetParam());
+    decoder >> decoded;
+    EXPECT_EQ(counters, decoded);
+    EXPECT_EQ(cdr.get_serialized_data_length(), decoder.get_serialized_data_length());
+}
+
+/*!
+ * @test Long arrays mixing one byte varints with longer ones are decoded as encoded.
+ */
+TEST_P(FastCdrVarintTests, bulk_arrays)
+{
+    std::vector<uint32_t> counters(1000);
+    std::vector<int64_t> deltas(1000);
+    for (size_t i = 0; i < counters.size(); ++i)
+    {
+        counters[i] = static_cast<uint32_t>(0 == i % 37 ? i * 1000 : i % 100);
+        deltas[i] = 0 == i % 53 ? -static_cast<int64_t>(i) * 100000 : static_cast<int64_t>(i % 7) - 3;
+    }
+
+    FastBuffer fast_buffer;
+    FastCdr cdr(fast_buffer, GetParam());
+    cdr << counters << deltas;
+    const FastCdrSizeCalculator calculator(GetParam());
+    EXPECT_EQ(calculator.calculate_serialized_size(counters) + calculator.calculate_serialized_size(deltas),
+            cdr.get_serialized_data_length());
+
+    if (FastCdr::IntegerEncoding::VARINT == GetParam())
+    {
+        EXPECT_GT(counters.size() * 2, cdr.get_serialized_data_length() - deltas.size() * 2);
+    }
+
+    std::vector<uint32_t> decoded_counters;
+    std::vector<int64_t> decoded_deltas;
+    FastCdr decoder(fast_buffer, GetParam());
+    decoder >> decoded_counters >> decoded_deltas;
+    EXPECT_EQ(counters, decoded_counters);
+    EXPECT_EQ(deltas, decoded_deltas);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    FastCdrVarintTests,
+    FastCdrVarintTests,
+    ::testing::Values(FastCdr::IntegerEncoding::FIXED_WIDTH, FastCdr::IntegerEncoding::VARINT));
+
+/*!
+ * @test Small values take one byte and signed values are zigzag encoded.
+ */
+TEST(FastCdrVarintTests, encoding)
+{
+    char buffer[32] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    FastCdr cdr(fast_buffer, FastCdr::IntegerEncoding::VARINT);
+    cdr << uint32_t(1) << -1 << int64_t(1) << uint16_t(300);
+    ASSERT_EQ(5u, cdr.get_serialized_data_length());
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(1, buffer[1]);
+    EXPECT_EQ(2, buffer[2]);
+    EXPECT_EQ(static_cast<char>(0xAC), buffer[3]);
+    EXPECT_EQ(2, buffer[4]);
+}
+
+/*!
+ * @test Values out of the range of the decoded type and truncated varints are reported, and a sequence which fails
+ * to be decoded doesn't move the position.
+ */
+TEST(FastCdrVarintTests, errors)
+{
+    char buffer[32] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    FastCdr cdr(fast_buffer, FastCdr::IntegerEncoding::VARINT);
+    cdr << uint32_t(70000) << -40000;
+
+    FastCdr decoder(fast_buffer, FastCdr::IntegerEncoding::VARINT);
+    uint16_t ushort_value {0};
+    int16_t short_value {0};
+    EXPECT_THROW(decoder >> ushort_value, exception::BadParamException);
+    decoder.jump(3);
+    EXPECT_THROW(decoder >> short_value, exception::BadParamException);
+
+    memset(buffer, 0xFF, sizeof(buffer));
+    decoder.reset();
+    uint64_t ulonglong_value {0};
+    EXPECT_THROW(decoder >> ulonglong_value, exception::BadParamException);
+
+    FastBuffer short_buffer(buffer, 4);
+    buffer[0] = 5;
+    FastCdr short_decoder(short_buffer, FastCdr::IntegerEncoding::VARINT);
+    std::vector<uint32_t> sequence;
+    EXPECT_THROW(short_decoder >> sequence, exception::NotEnoughMemoryException);
+    EXPECT_EQ(0u, short_decoder.get_serialized_data_length());
+}
@@ -0,0 +1,218 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <array>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/FieldUpdater.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+namespace eprosima {
+namespace fastcdr {
+namespace test {
+
+//! Appendable structure used as member of Telemetry.
+struct TelemetryAxis
+{
+    int16_t id {3};
+
+    std::array<std::array<float, 2>, 2> gains {{{{1.f, 2.f}}, {{3.f, 4.f}}}};
+};
+
+//! Final structure with a fixed layout.
+struct Telemetry
+{
+    uint8_t status {1};
+
+    uint64_t timestamp {123456789};
+
+    std::array<double, 3> position {{1.0, 2.0, 3.0}};
+
+    TelemetryAxis axis;
+
+    std::array<TelemetryAxis, 2> axes;
+
+    bool valid {true};
+
+    int32_t counter {-7};
+};
+
+} // namespace test
+
+template<>
+inline void serialize(
+        Cdr& cdr,
+        const test::TelemetryAxis& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state,
+            TypeDescription::encoding(cdr.get_cdr_version(), Extensibility::APPENDABLE));
+    cdr << MemberId(0) << data.id << MemberId(1) << data.gains;
+    cdr.end_serialize_type(current_state);
+}
+
+template<>
+inline void serialize(
+        Cdr& cdr,
+        const test::Telemetry& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, TypeDescription::encoding(cdr.get_cdr_version(), Extensibility::FINAL));
+    cdr << MemberId(0) << data.status << MemberId(1) << data.timestamp << MemberId(2) << data.position;
+    cdr << MemberId(3) << data.axis << MemberId(4) << data.axes << MemberId(5) << data.valid;
+    cdr << MemberId(6) << data.counter;
+    cdr.end_serialize_type(current_state);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
+
+class FieldUpdaterTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Cdr::Endianness>>
+{
+public:
+
+    FieldUpdaterTests()
+    {
+        using Member = TypeDescription::Member;
+        const TypeDescription::TypeIndex gains {description_.add_array(
+            description_.add_array(TypeDescription::predefined(TypeKind::FLOAT32), 2), 2)};
+        const TypeDescription::TypeIndex axis {description_.add_structure(Extensibility::APPENDABLE, {
+            Member{MemberId(0), TypeDescription::predefined(TypeKind::INT16)},
+            Member{MemberId(1), gains}
+        })};
+        type_ = description_.add_structure(Extensibility::FINAL, {
+            Member{MemberId(0), TypeDescription::predefined(TypeKind::UINT8)},
+            Member{MemberId(1), TypeDescription::predefined(TypeKind::UINT64)},
+            Member{MemberId(2), description_.add_array(TypeDescription::predefined(TypeKind::FLOAT64), 3)},
+            Member{MemberId(3), axis},
+            Member{MemberId(4), description_.add_array(axis, 2)},
+            Member{MemberId(5), TypeDescription::predefined(TypeKind::BOOLEAN)},
+            Member{MemberId(6), TypeDescription::predefined(TypeKind::INT32)}
+        });
+    }
+
+    //! Serializes a sample into a zeroed buffer, so the padding is the same in every payload.
+    std::vector<char> encode(
+            const Telemetry& sample)
+    {
+        std::vector<char> payload(256, 0);
+        FastBuffer fast_buffer(payload.data(), payload.size());
+        Cdr cdr(fast_buffer, std::get<1>(GetParam()), std::get<0>(GetParam()));
+        cdr.set_encoding_flag(TypeDescription::encoding(std::get<0>(GetParam()), Extensibility::FINAL));
+        cdr.serialize_encapsulation();
+        cdr << sample;
+        payload.resize(cdr.get_serialized_data_length());
+        return payload;
+    }
+
+    TypeDescription description_;
+
+    TypeDescription::TypeIndex type_ {0};
+};
+
+/*!
+ * @test Updating fields of a payload leaves it equal to the payload of the updated sample.
+ */
+TEST_P(FieldUpdaterTests, update)
+{
+    FieldUpdater updater(description_, type_, std::get<0>(GetParam()));
+    Telemetry sample;
+    std::vector<char> payload {encode(sample)};
+    EXPECT_EQ(payload.size(), updater.serialized_size());
+
+    const FieldUpdater::Location& timestamp {updater.locate({1})};
+    EXPECT_EQ(&timestamp, &updater.locate({1}));
+    sample.timestamp = 0x0102030405060708u;
+    updater.update(payload.data(), payload.size(), timestamp, sample.timestamp);
+    EXPECT_EQ(encode(sample), payload);
+
+    sample.position = {{-1.5, 0.25, 8.0}};
+    updater.update_array(payload.data(), payload.size(), updater.locate({2}), sample.position.data(),
+            sample.position.size());
+    sample.axis.gains[1][0] = 9.f;
+    updater.update(payload.data(), payload.size(), updater.locate({3, 1, 1, 0}), sample.axis.gains[1][0]);
+    sample.axes[1].id = -300;
+    updater.update(payload.data(), payload.size(), updater.locate({4, 1, 0}), sample.axes[1].id);
+    sample.axes[1].gains[0] = {{5.f, 6.f}};
+    updater.update_array(payload.data(), payload.size(), updater.locate({4, 1, 1, 0}), sample.axes[1].gains[0].data(),
+            2);
+    sample.valid = false;
+    updater.update(payload.data(), payload.size(), updater.locate({5}), sample.valid);
+    sample.counter = 1 << 20;
+    updater.update(payload.data(), payload.size(), updater.locate({6}), sample.counter);
+    EXPECT_EQ(encode(sample), payload);
+}
+
+/*!
+ * @test Wrong paths, values and payloads are reported.
+ */
+TEST_P(FieldUpdaterTests, errors)
+{
+    FieldUpdater updater(description_, type_, std::get<0>(GetParam()));
+    std::vector<char> payload {encode(Telemetry())};
+
+    EXPECT_THROW(updater.locate({7}), exception::BadParamException);
+    EXPECT_THROW(updater.locate({3}), exception::BadParamException);
+    EXPECT_THROW(updater.locate({2, 3}), exception::BadParamException);
+    EXPECT_THROW(updater.locate({1, 0}), exception::BadParamException);
+
+    const FieldUpdater::Location& counter {updater.locate({6})};
+    EXPECT_THROW(updater.update(payload.data(), payload.size(), counter, int16_t(1)), exception::BadParamException);
+    EXPECT_THROW(updater.update(payload.data(), payload.size() - 1, counter, 1), exception::NotEnoughMemoryException);
+    const std::array<double, 2> values {{1.0, 2.0}};
+    EXPECT_THROW(updater.update_array(payload.data(), payload.size(), updater.locate({2}), values.data(),
+            values.size()), exception::BadParamException);
+
+    payload[1] = static_cast<char>(payload[1] ^ 0x2);
+    EXPECT_THROW(updater.update(payload.data(), payload.size(), counter, 1), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    FieldUpdaterTests,
+    FieldUpdaterTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Cdr::BIG_ENDIANNESS, Cdr::LITTLE_ENDIANNESS)));
+
+/*!
+ * @test Types whose layout depends on the values are rejected.
+ */
+TEST(FieldUpdaterTests, variable_layouts)
+{
+    TypeDescription description;
+    using Member = TypeDescription::Member;
+    const TypeDescription::TypeIndex with_string {description.add_structure(Extensibility::FINAL, {
+        Member{MemberId(0), TypeDescription::predefined(TypeKind::STRING8)}
+    })};
+    const TypeDescription::TypeIndex with_optional {description.add_structure(Extensibility::FINAL, {
+        Member{MemberId(0), TypeDescription::predefined(TypeKind::INT32), true}
+    })};
+    const TypeDescription::TypeIndex mutable_type {description.add_structure(Extensibility::MUTABLE, {
+        Member{MemberId(0), TypeDescription::predefined(TypeKind::INT32)}
+    })};
+
+    EXPECT_THROW(FieldUpdater(description, with_string, CdrVersion::XCDRv2), exception::BadParamException);
+    EXPECT_THROW(FieldUpdater(description, with_optional, CdrVersion::XCDRv2), exception::BadParamException);
+    EXPECT_THROW(FieldUpdater(description, mutable_type, CdrVersion::XCDRv1), exception::BadParamException);
+    EXPECT_THROW(FieldUpdater(description, TypeDescription::predefined(TypeKind::INT32), CdrVersion::CORBA_CDR),
+            exception::BadParamException);
+}
@@ -0,0 +1,145 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+class FixedVectorTests : public ::testing::TestWithParam<CdrVersion>
+{
+};
+
+/*!
+ * @test A fixed_vector has the same encoding as a std::vector.
+ */
+TEST_P(FixedVectorTests, same_encoding_as_vector)
+{
+    const CdrVersion version {GetParam()};
+
+    const std::vector<uint16_t> primitive_value {1, 2, 3, 4, 5};
+    const std::vector<std::string> value {"one", "two", "three"};
+    fixed_vector<uint16_t, 8> fixed_primitive_value;
+    fixed_vector<std::string, 3> fixed_value;
+    for (uint16_t element : primitive_value)
+    {
+        fixed_primitive_value.push_back(element);
+    }
+    for (const std::string& element : value)
+    {
+        fixed_value.push_back(element);
+    }
+
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << primitive_value << value;
+
+    char fixed_buffer[256] {};
+    FastBuffer fixed_fast_buffer(fixed_buffer, sizeof(fixed_buffer));
+    Cdr fixed_cdr(fixed_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    fixed_cdr << fixed_primitive_value << fixed_value;
+
+    ASSERT_EQ(cdr.get_serialized_data_length(), fixed_cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(buffer, fixed_buffer, cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    size_t calculated_size {calculator.calculate_serialized_size(fixed_primitive_value, current_alignment)};
+    calculated_size += calculator.calculate_serialized_size(fixed_value, current_alignment);
+    ASSERT_EQ(cdr.get_serialized_data_length(), calculated_size);
+
+    // Decode into fixed_vectors holding previous values.
+    fixed_vector<uint16_t, 8> dfixed_primitive_value(7, uint16_t(9));
+    fixed_vector<std::string, 3> dfixed_value {"stale"};
+    cdr.reset();
+    cdr >> dfixed_primitive_value >> dfixed_value;
+    ASSERT_EQ(fixed_primitive_value, dfixed_primitive_value);
+    ASSERT_EQ(fixed_value, dfixed_value);
+    ASSERT_EQ(fixed_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test Decoding a sequence longer than the bound of the fixed_vector fails.
+ */
+TEST_P(FixedVectorTests, bound_exceeded)
+{
+    const CdrVersion version {GetParam()};
+
+    const std::vector<uint32_t> primitive_value {1, 2, 3, 4, 5};
+    const std::vector<std::string> value {"one", "two", "three"};
+
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << primitive_value << value;
+
+    fixed_vector<uint32_t, 4> dprimitive_value;
+    cdr.reset();
+    EXPECT_THROW(cdr >> dprimitive_value, exception::BadParamException);
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+
+    fixed_vector<uint32_t, 5> dfixed_primitive_value;
+    fixed_vector<std::string, 2> dvalue;
+    cdr >> dfixed_primitive_value;
+    const size_t length {cdr.get_serialized_data_length()};
+    EXPECT_THROW(cdr >> dvalue, exception::BadParamException);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+    ASSERT_TRUE(dvalue.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    FixedVectorTests,
+    FixedVectorTests,
+    ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2));
+
+/*!
+ * @test Elements are stored inside the object and destroyed when removed.
+ */
+TEST(FixedVectorOperationsTests, operations)
+{
+    static_assert(4 == fixed_vector<std::string, 4>::max_size, "Wrong bound");
+    static_assert(4 == fixed_vector<std::string, 4>::capacity(), "Wrong bound");
+
+    fixed_vector<std::string, 4> value {"a", "b"};
+    ASSERT_LE(static_cast<const void*>(&value), static_cast<const void*>(value.data()));
+    ASSERT_GT(static_cast<const void*>(&value + 1), static_cast<const void*>(value.data() + 3));
+
+    value.emplace_back(3u, 'c');
+    ASSERT_EQ("ccc", value.back());
+    value.resize(4);
+    ASSERT_EQ("", value.at(3));
+    ASSERT_THROW(value.push_back("d"), std::length_error);
+    ASSERT_THROW(value.resize(5), std::length_error);
+    ASSERT_THROW(value.at(4), std::out_of_range);
+
+    fixed_vector<std::string, 4> copy {value};
+    fixed_vector<std::string, 4> moved {std::move(copy)};
+    ASSERT_EQ(value, moved);
+
+    value.pop_back();
+    value.resize(1);
+    ASSERT_EQ(1u, value.size());
+    ASSERT_EQ("a", value.front());
+    ASSERT_NE(value, moved);
+    moved = value;
+    ASSERT_EQ(value, moved);
+    value.clear();
+    ASSERT_TRUE(value.empty());
+}
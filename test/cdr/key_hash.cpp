@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <array>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/KeyHash.hpp>
+
+using namespace eprosima::fastcdr;
+
+using Hash = std::array<uint8_t, KeyHash::HASH_SIZE>;
+
+//! Calculates the MD5 digest of raw bytes.
+static Hash md5(
+        const std::string& message)
+{
+    KeyHash key_hash(KeyHash::HASH_SIZE + 1);
+
+    for (char character : message)
+    {
+        key_hash << character;
+    }
+
+    Hash hash;
+    key_hash.finish(hash);
+    return hash;
+}
+
+static std::string hex(
+        const Hash& hash)
+{
+    static const char digits[] {"0123456789abcdef"};
+    std::string text;
+
+    for (uint8_t byte : hash)
+    {
+        text.push_back(digits[byte >> 4]);
+        text.push_back(digits[byte & 0xF]);
+    }
+
+    return text;
+}
+
+/*!
+ * @test MD5 digests of the test suite of RFC 1321, hashing the messages as raw octets.
+ */
+TEST(KeyHashTests, md5_test_suite)
+{
+    const std::vector<std::pair<std::string, std::string>> suite {
+        {"", "d41d8cd98f00b204e9800998ecf8427e"},
+        {"a", "0cc175b9c0f1b6a831c399e269772661"},
+        {"abc", "900150983cd24fb0d6963f7d28e17f72"},
+        {"message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+        {"abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b"},
+        {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+         "57edf4a22be3c955ac49da2e2107b67a"}
+    };
+
+    for (const auto& test : suite)
+    {
+        EXPECT_EQ(test.second, hex(md5(test.first))) << test.first;
+    }
+}
+
+/*!
+ * @test The key hash of members added one by one is the MD5 digest of the whole serialized key, in big endianness
+ * and XCDRv2, including the alignment between members.
+ */
+TEST(KeyHashTests, same_as_serialized_key)
+{
+    const uint8_t octet {7};
+    const std::string name {"a key long enough to cross several blocks of the MD5 digest, which are 64 bytes long"};
+    const int64_t long_long {-1234567890123};
+    const std::vector<int16_t> shorts {1, 2, 3};
+    const double real {3.5};
+    // Greater than the initial window.
+    const std::string long_name(600, 'k');
+
+    char buffer[1024] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::BIG_ENDIANNESS, CdrVersion::XCDRv2);
+    cdr << octet << name << long_long << shorts << real << long_name;
+    const Hash expected {md5(std::string(buffer, cdr.get_serialized_data_length()))};
+
+    KeyHash key_hash(1024);
+
+    for (size_t count {0}; count < 2; ++count)
+    {
+        key_hash << octet << name << long_long << shorts << real << long_name;
+        Hash hash;
+        key_hash.finish(hash);
+        EXPECT_EQ(hex(expected), hex(hash));
+    }
+
+    // Members discarded by reset are not hashed.
+    key_hash << name;
+    key_hash.reset();
+    key_hash << octet << name << long_long << shorts << real << long_name;
+    Hash hash;
+    key_hash.finish(hash);
+    EXPECT_EQ(hex(expected), hex(hash));
+}
+
+/*!
+ * @test Keys of 16 bytes or less are their serialized key padded with zeros.
+ */
+TEST(KeyHashTests, short_keys)
+{
+    KeyHash key_hash(12);
+    const int32_t long_value {0x02030405};
+    key_hash << uint8_t(1) << long_value << uint16_t(0x0607);
+    Hash hash;
+    key_hash.finish(hash);
+    EXPECT_EQ("01000000020304050607000000000000", hex(hash));
+
+    key_hash << int64_t(1) << int64_t(2);
+    EXPECT_THROW(key_hash << uint8_t(3), exception::BadParamException);
+}
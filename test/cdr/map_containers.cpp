@@ -0,0 +1,181 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+class MapContainersTests : public ::testing::TestWithParam<CdrVersion>
+{
+};
+
+/*!
+ * @test std::unordered_map and flat_map have the same encoding as std::map, and can be decoded from it.
+ */
+TEST_P(MapContainersTests, same_encoding_as_map)
+{
+    const CdrVersion version {GetParam()};
+
+    std::map<uint16_t, std::string> map_value;
+    std::map<int32_t, double> primitive_map_value;
+    for (uint16_t count {0}; count < 50; ++count)
+    {
+        map_value.emplace(count, std::string(count % 7, 'a'));
+        primitive_map_value.emplace(-count, count * 0.5);
+    }
+
+    char buffer[2048] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << map_value << primitive_map_value;
+    const size_t length {cdr.get_serialized_data_length()};
+
+    // Decode into the other containers.
+    std::unordered_map<uint16_t, std::string> umap_value {{1000, "stale"}};
+    std::unordered_map<int32_t, double> primitive_umap_value {{1000, 1.0}};
+    flat_map<uint16_t, std::string> fmap_value {{1000, "stale"}};
+    flat_map<int32_t, double> primitive_fmap_value {{1000, 1.0}};
+
+    cdr.reset();
+    cdr >> umap_value >> primitive_umap_value;
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+    cdr.reset();
+    cdr >> fmap_value >> primitive_fmap_value;
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+
+    ASSERT_EQ(map_value.size(), umap_value.size());
+    ASSERT_EQ(map_value.size(), fmap_value.size());
+    for (const auto& pair : map_value)
+    {
+        ASSERT_EQ(pair.second, umap_value.at(pair.first));
+        ASSERT_EQ(pair.second, fmap_value.at(pair.first));
+    }
+    ASSERT_EQ(primitive_map_value.size(), primitive_umap_value.size());
+    ASSERT_EQ(primitive_map_value.size(), primitive_fmap_value.size());
+    for (const auto& pair : primitive_map_value)
+    {
+        ASSERT_EQ(pair.second, primitive_umap_value.at(pair.first));
+        ASSERT_EQ(pair.second, primitive_fmap_value.at(pair.first));
+    }
+    ASSERT_TRUE(std::is_sorted(primitive_fmap_value.begin(), primitive_fmap_value.end()));
+
+    // flat_map keeps the std::map order, so the encoding is the same.
+    char fbuffer[2048] {};
+    FastBuffer ffast_buffer(fbuffer, sizeof(fbuffer));
+    Cdr fcdr(ffast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    fcdr << fmap_value << primitive_fmap_value;
+    ASSERT_EQ(length, fcdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(buffer, fbuffer, length));
+
+    // std::unordered_map has the same length and decodes to the same std::map.
+    char ubuffer[2048] {};
+    FastBuffer ufast_buffer(ubuffer, sizeof(ubuffer));
+    Cdr ucdr(ufast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    ucdr << umap_value << primitive_umap_value;
+    ASSERT_EQ(length, ucdr.get_serialized_data_length());
+    std::map<uint16_t, std::string> dmap_value {{1000, "stale"}};
+    std::map<int32_t, double> dprimitive_map_value {{1000, 1.0}};
+    ucdr.reset();
+    ucdr >> dmap_value >> dprimitive_map_value;
+    ASSERT_EQ(map_value, dmap_value);
+    ASSERT_EQ(primitive_map_value, dprimitive_map_value);
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    size_t calculated_size {calculator.calculate_serialized_size(umap_value, current_alignment)};
+    calculated_size += calculator.calculate_serialized_size(primitive_umap_value, current_alignment);
+    ASSERT_EQ(length, calculated_size);
+    current_alignment = 0;
+    calculated_size = calculator.calculate_serialized_size(fmap_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(primitive_fmap_value, current_alignment);
+    ASSERT_EQ(length, calculated_size);
+}
+
+/*!
+ * @test Decoding a flat_map whose keys were encoded out of order sorts them, keeping the first duplicated key as
+ * std::map does.
+ */
+TEST_P(MapContainersTests, flat_map_unordered_input)
+{
+    const CdrVersion version {GetParam()};
+
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    const uint32_t keys[] {5, 1, 3, 1, 9};
+    cdr << static_cast<uint32_t>(5);
+    for (uint32_t key : keys)
+    {
+        cdr << key << static_cast<uint16_t>(key * 10 + 1);
+    }
+    const size_t length {cdr.get_serialized_data_length()};
+
+    cdr.reset();
+    std::map<uint32_t, uint16_t> map_value;
+    cdr >> map_value;
+    cdr.reset();
+    flat_map<uint32_t, uint16_t> fmap_value;
+    cdr >> fmap_value;
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+
+    ASSERT_EQ(4u, fmap_value.size());
+    ASSERT_TRUE(std::equal(map_value.begin(), map_value.end(), fmap_value.begin(), fmap_value.end(),
+            [](const std::pair<const uint32_t, uint16_t>& lhs, const std::pair<uint32_t, uint16_t>& rhs)
+            {
+                return lhs.first == rhs.first && lhs.second == rhs.second;
+            }));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MapContainersTests,
+    MapContainersTests,
+    ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2));
+
+/*!
+ * @test Lookup and modification operations of flat_map.
+ */
+TEST(FlatMapTests, operations)
+{
+    flat_map<int32_t, std::string> value {{3, "three"}, {1, "one"}};
+    ASSERT_EQ(2u, value.size());
+    ASSERT_EQ(1, value.begin()->first);
+
+    value[2] = "two";
+    ASSERT_EQ(3u, value.size());
+    ASSERT_EQ("two", value.at(2));
+    ASSERT_FALSE(value.insert({2, "other"}).second);
+    ASSERT_EQ("two", value.at(2));
+    ASSERT_EQ(1u, value.count(3));
+    ASSERT_EQ(value.end(), value.find(4));
+    ASSERT_THROW(value.at(4), std::out_of_range);
+
+    // Wrong hints fall back on searching.
+    value.emplace_hint(value.begin(), 10, "ten");
+    value.emplace_hint(value.end(), 0, "zero");
+    ASSERT_TRUE(std::is_sorted(value.begin(), value.end()));
+    ASSERT_EQ(5u, value.size());
+
+    ASSERT_EQ(1u, value.erase(10));
+    ASSERT_EQ(0u, value.erase(10));
+    ASSERT_EQ(4u, value.size());
+    const flat_map<int32_t, std::string> expected {{0, "zero"}, {1, "one"}, {2, "two"}, {3, "three"}};
+    ASSERT_EQ(expected, value);
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+
+using namespace eprosima::fastcdr;
+
+class MemberIndexTests : public ::testing::TestWithParam<CdrVersion>
+{
+public:
+
+    EncodingAlgorithmFlag mutable_encoding() const
+    {
+        return CdrVersion::XCDRv1 == GetParam() ? EncodingAlgorithmFlag::PL_CDR : EncodingAlgorithmFlag::PL_CDR2;
+    }
+
+    //! Encodes a uint8_t, a mutable type with several kinds of members and a trailing double.
+    size_t encode(
+            Cdr& cdr)
+    {
+        cdr << static_cast<uint8_t>(7);
+        Cdr::state current_state(cdr);
+        cdr.begin_serialize_type(current_state, mutable_encoding());
+        cdr.serialize_member(MemberId(1), static_cast<uint8_t>(11));
+        cdr.serialize_member(MemberId(40), string_value);
+        cdr.serialize_member(MemberId(2), 2.5);
+        cdr.serialize_member(MemberId(3), sequence_value, Cdr::XCdrHeaderSelection::LONG_HEADER);
+        cdr.serialize_member(MemberId(0x1000), static_cast<uint32_t>(0x1000), Cdr::XCdrHeaderSelection::LONG_HEADER);
+        cdr.serialize_member(MemberId(5), static_cast<int16_t>(-5));
+        cdr.end_serialize_type(current_state);
+        cdr << 3.75;
+        return cdr.get_serialized_data_length();
+    }
+
+    const std::string string_value {"mutable"};
+
+    const std::vector<uint16_t> sequence_value {1, 2, 3};
+};
+
+/*!
+ * @test Members are decoded on demand, in any order, without moving the decoder.
+ */
+TEST_P(MemberIndexTests, decode_on_demand)
+{
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    const size_t length {encode(cdr)};
+
+    cdr.reset();
+    uint8_t first {0};
+    cdr >> first;
+    Cdr::member_index index(cdr, mutable_encoding());
+    ASSERT_TRUE(static_cast<bool>(index));
+
+    // The decoder continues after the mutable type.
+    double last {0};
+    cdr >> last;
+    ASSERT_EQ(3.75, last);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+
+    ASSERT_EQ(6u, index.size());
+    ASSERT_TRUE(index.contains(MemberId(0x1000)));
+    ASSERT_FALSE(index.contains(MemberId(4)));
+
+    int16_t int16_value {0};
+    ASSERT_TRUE(index.deserialize_member(MemberId(5), int16_value));
+    ASSERT_EQ(-5, int16_value);
+    std::vector<uint16_t> sequence;
+    ASSERT_TRUE(index.deserialize_member(MemberId(3), sequence));
+    ASSERT_EQ(sequence_value, sequence);
+    double double_value {0};
+    ASSERT_TRUE(index.deserialize_member(MemberId(2), double_value));
+    ASSERT_EQ(2.5, double_value);
+    std::string string;
+    ASSERT_TRUE(index.deserialize_member(MemberId(40), string));
+    ASSERT_EQ(string_value, string);
+    uint32_t uint32_value {0};
+    ASSERT_TRUE(index.deserialize_member(MemberId(0x1000), uint32_value));
+    ASSERT_EQ(0x1000u, uint32_value);
+    uint8_t uint8_value {0};
+    ASSERT_TRUE(index.deserialize_member(MemberId(1), uint8_value));
+    ASSERT_EQ(11u, uint8_value);
+    ASSERT_FALSE(index.deserialize_member(MemberId(4), uint8_value));
+
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test Decoding a member as a type with a different size fails without moving the decoder.
+ */
+TEST_P(MemberIndexTests, wrong_member_type)
+{
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    encode(cdr);
+
+    cdr.reset();
+    uint8_t first {0};
+    cdr >> first;
+    Cdr::member_index index(cdr, mutable_encoding());
+    const size_t length {cdr.get_serialized_data_length()};
+
+    uint16_t value {0};
+    EXPECT_THROW(index.deserialize_member(MemberId(1), value), exception::BadParamException);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test A mutable type whose member headers exceed the buffer is reported.
+ */
+TEST_P(MemberIndexTests, truncated_type)
+{
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    const size_t length {encode(cdr)};
+
+    FastBuffer truncated_buffer(buffer, length - 16);
+    Cdr truncated_cdr(truncated_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    truncated_cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+    uint8_t first {0};
+    truncated_cdr >> first;
+    Cdr::member_index index(truncated_cdr, mutable_encoding());
+    ASSERT_FALSE(static_cast<bool>(index));
+    ASSERT_NE(Cdr::ErrorCode::CDR_ERROR_NONE, truncated_cdr.get_error());
+}
+
+/*!
+ * @test Only mutable types of the encoder version can be indexed.
+ */
+TEST_P(MemberIndexTests, not_mutable)
+{
+    char buffer[16] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, GetParam());
+    EXPECT_THROW(Cdr::member_index(cdr, EncodingAlgorithmFlag::DELIMIT_CDR2), exception::BadParamException);
+    EXPECT_THROW(Cdr::member_index(cdr, CdrVersion::XCDRv1 == GetParam() ?
+            EncodingAlgorithmFlag::PL_CDR2 : EncodingAlgorithmFlag::PL_CDR), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MemberIndexTests,
+    MemberIndexTests,
+    ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2));
@@ -0,0 +1,152 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/PayloadView.hpp>
+#include <fastcdr/exceptions/BadParamException.h>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class PayloadViewTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Cdr::Endianness, Extensibility>>
+{
+public:
+
+    PayloadViewTests()
+        : types_(describe_sample(description_, std::get<2>(GetParam())))
+        , interpreter_(description_)
+    {
+        sample_.extensibility = std::get<2>(GetParam());
+        sample_.string_value = "a longer string value";
+        sample_.sequence_value = {7, 8};
+        sample_.map_value = {{-4, "minus four"}, {9, ""}, {16, "sixteen"}};
+    }
+
+    //! Returns a copy of the characters of a string value.
+    static std::string string_of(
+            const ValueView& value)
+    {
+        size_t length {0};
+        const char* data {value.get_string(length)};
+        return std::string(data, length);
+    }
+
+    TypeDescription description_;
+
+    DescribedSampleTypes types_;
+
+    TypeInterpreter interpreter_;
+
+    DescribedSample sample_;
+
+    char buffer_[1024] {};
+};
+
+/*!
+ * @test Every value of the sample is read through the views, in any order.
+ */
+TEST_P(PayloadViewTests, read_values)
+{
+    const size_t length {encode_sample(sample_, std::get<0>(GetParam()), std::get<1>(GetParam()), buffer_,
+                sizeof(buffer_))};
+    PayloadView payload(interpreter_, types_.sample, buffer_, length);
+    const ValueView root {payload.root()};
+    ASSERT_EQ(TypeKind::STRUCTURE, root.kind());
+
+    // Later members first, so the positions of the previous ones are found on the way.
+    EXPECT_EQ(string_of(root.member(13)), sample_.bounded_string_value);
+    EXPECT_EQ(sample_.octet_value, root.member(0).get<uint8_t>());
+    EXPECT_EQ(sample_.bool_value, root.member(1).get<bool>());
+    EXPECT_EQ(sample_.long_long_value, root.member(2).get<int64_t>());
+    EXPECT_EQ(string_of(root.member(3)), sample_.string_value);
+    EXPECT_EQ(sample_.string_value.size(), root.member(3).size());
+    EXPECT_EQ(sample_.wstring_value.size(), root.member(4).size());
+
+    const ValueView sequence {root.member(5)};
+    ASSERT_EQ(sample_.sequence_value.size(), sequence.size());
+    EXPECT_EQ(sample_.sequence_value[1], sequence.element(1).get<uint16_t>());
+    EXPECT_EQ(sample_.sequence_value[0], sequence.element(0).get<uint16_t>());
+
+    const ValueView string_sequence {root.member(6)};
+    ASSERT_EQ(sample_.string_sequence_value.size(), string_sequence.size());
+    EXPECT_EQ(string_of(string_sequence.element(2)), sample_.string_sequence_value[2]);
+    EXPECT_EQ(string_of(string_sequence.element(1)), sample_.string_sequence_value[1]);
+
+    const ValueView array {root.member(7)};
+    ASSERT_EQ(sample_.array_value.size(), array.size());
+    ASSERT_EQ(2u, array.element(2).size());
+    EXPECT_EQ(sample_.array_value[2][1], array.element(2).element(1).get<int32_t>());
+    EXPECT_EQ(sample_.array_value[1][0], array.element(1).element(0).get<int32_t>());
+
+    EXPECT_EQ(string_of(root.member(8).element(1)), sample_.string_array_value[1]);
+
+    const ValueView map {root.member(9)};
+    ASSERT_EQ(sample_.map_value.size(), map.size());
+    size_t index {0};
+
+    for (const auto& entry : sample_.map_value)
+    {
+        EXPECT_EQ(entry.first, map.key(index).get<int32_t>());
+        EXPECT_EQ(string_of(map.element(index)), entry.second);
+        ++index;
+    }
+
+    const ValueView nested {root.member(10)};
+    EXPECT_EQ(string_of(nested.member(1)), sample_.nested_value.string_value);
+    EXPECT_EQ(sample_.nested_value.short_value, nested.member(0).get<int16_t>());
+
+    EXPECT_EQ(*sample_.optional_value, root.member(11).get<double>());
+    EXPECT_FALSE(root.member(12));
+    EXPECT_FALSE(root.member(14));
+}
+
+/*!
+ * @test Wrong reads and lookups are reported.
+ */
+TEST_P(PayloadViewTests, errors)
+{
+    const size_t length {encode_sample(sample_, std::get<0>(GetParam()), std::get<1>(GetParam()), buffer_,
+                sizeof(buffer_))};
+    PayloadView payload(interpreter_, types_.sample, buffer_, length);
+    const ValueView root {payload.root()};
+
+    EXPECT_THROW(root.member(2).get<int32_t>(), exception::BadParamException);
+    EXPECT_THROW(root.member(3).get<int32_t>(), exception::BadParamException);
+    EXPECT_THROW(root.member(0).member(0), exception::BadParamException);
+    EXPECT_THROW(root.member(0).size(), exception::BadParamException);
+    EXPECT_THROW(root.member(5).key(0), exception::BadParamException);
+    EXPECT_THROW(root.member(5).element(2), exception::BadParamException);
+    EXPECT_THROW(root.member(6).element(3), exception::BadParamException);
+    EXPECT_THROW(root.member(7).element(3), exception::BadParamException);
+    EXPECT_THROW(root.member(9).key(3), exception::BadParamException);
+    EXPECT_THROW(root.member(12).get<uint32_t>(), exception::BadParamException);
+    EXPECT_THROW(ValueView().size(), exception::BadParamException);
+
+    // The encapsulation has to match the type.
+    buffer_[1] = static_cast<char>(buffer_[1] ^ 0x2);
+    EXPECT_THROW(PayloadView(interpreter_, types_.sample, buffer_, sizeof(buffer_)), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PayloadViewTests,
+    PayloadViewTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Cdr::BIG_ENDIANNESS, Cdr::LITTLE_ENDIANNESS),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
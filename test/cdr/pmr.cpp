@@ -0,0 +1,246 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+#if FASTCDR_HAVE_PMR
+
+#include <algorithm>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastcdr;
+
+/*!
+ * @brief Memory resource which counts the allocations and refuses to fall back on another resource.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+
+    CountingResource()
+        : arena_(storage_, sizeof(storage_), std::pmr::null_memory_resource())
+    {
+    }
+
+    size_t allocations {0};
+
+private:
+
+    void* do_allocate(
+            size_t bytes,
+            size_t alignment) override
+    {
+        ++allocations;
+        return arena_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+            void* p,
+            size_t bytes,
+            size_t alignment) override
+    {
+        arena_.deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    alignas(std::max_align_t) char storage_[8192];
+
+    std::pmr::monotonic_buffer_resource arena_;
+};
+
+class PmrTests : public ::testing::TestWithParam<CdrVersion>
+{
+};
+
+/*!
+ * @test Encodes std::pmr containers and checks the encoding is the same as the std ones.
+ */
+TEST_P(PmrTests, same_encoding_as_std)
+{
+    const CdrVersion version {GetParam()};
+
+    std::map<std::string, std::vector<std::string>> std_value {
+        {"first", {"a", "bb", "ccc"}},
+        {"second", {}},
+        {"third", {"dddddddddddddddddddddddddddddddddddddddd"}}
+    };
+
+    std::pmr::map<std::pmr::string, std::pmr::vector<std::pmr::string>> pmr_value;
+    for (const auto& pair : std_value)
+    {
+        auto& sequence = pmr_value[std::pmr::string(pair.first.c_str())];
+        for (const auto& str : pair.second)
+        {
+            sequence.emplace_back(str.c_str());
+        }
+    }
+
+    char std_buffer[512] {};
+    FastBuffer std_fast_buffer(std_buffer, sizeof(std_buffer));
+    Cdr std_cdr(std_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    std_cdr << std_value;
+
+    char pmr_buffer[512] {};
+    FastBuffer pmr_fast_buffer(pmr_buffer, sizeof(pmr_buffer));
+    Cdr pmr_cdr(pmr_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    pmr_cdr << pmr_value;
+
+    ASSERT_EQ(std_cdr.get_serialized_data_length(), pmr_cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(std_buffer, pmr_buffer, std_cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    ASSERT_EQ(std_cdr.get_serialized_data_length(),
+            calculator.calculate_serialized_size(pmr_value, current_alignment));
+
+    std::pmr::wstring wstr_value {L"wide"};
+    current_alignment = 0;
+    ASSERT_EQ(12u, calculator.calculate_serialized_size(wstr_value, current_alignment));
+}
+
+/*!
+ * @test Decodes a sample into std::pmr containers and externals, allocating everything from one memory resource.
+ */
+TEST_P(PmrTests, decode_from_arena)
+{
+    const CdrVersion version {GetParam()};
+
+    std::map<std::string, std::vector<std::string>> std_value {
+        {"first", {"a", "bb", "ccc"}},
+        {"second", {}},
+        {"third", {"dddddddddddddddddddddddddddddddddddddddd"}}
+    };
+    std::wstring std_wstring {L"wide string"};
+    std::vector<int32_t> std_external {1, 2, 3, 4};
+
+    char buffer[512] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << std_value << std_wstring << std_external;
+
+    CountingResource arena;
+    // Fail on any allocation from the global heap done through the default resource.
+    std::pmr::memory_resource* previous_default = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+    cdr.reset();
+    cdr.set_memory_resource(&arena);
+    ASSERT_EQ(&arena, cdr.get_memory_resource());
+    {
+        std::pmr::map<std::pmr::string, std::pmr::vector<std::pmr::string>> pmr_value {&arena};
+        std::pmr::wstring pmr_wstring {&arena};
+        external<std::pmr::vector<int32_t>> pmr_external;
+
+        cdr >> pmr_value >> pmr_wstring >> pmr_external;
+
+        ASSERT_EQ(std_value.size(), pmr_value.size());
+        for (const auto& pair : std_value)
+        {
+            const auto& sequence = pmr_value.at(std::pmr::string(pair.first.c_str(), &arena));
+            ASSERT_EQ(pair.second.size(), sequence.size());
+            for (size_t count {0}; count < sequence.size(); ++count)
+            {
+                ASSERT_EQ(pair.second[count], sequence[count].c_str());
+            }
+        }
+        ASSERT_EQ(std_wstring, pmr_wstring.c_str());
+        ASSERT_TRUE(static_cast<bool>(pmr_external));
+        ASSERT_EQ(&arena, pmr_external->get_allocator().resource());
+        ASSERT_EQ(std_external.size(), pmr_external->size());
+        ASSERT_TRUE(std::equal(std_external.begin(), std_external.end(), pmr_external->begin()));
+    }
+
+    std::pmr::set_default_resource(previous_default);
+    ASSERT_LT(0u, arena.allocations);
+}
+
+/*!
+ * @test Encodes and decodes a std::pmr::vector<bool>, which has no contiguous storage.
+ */
+TEST_P(PmrTests, bool_sequence)
+{
+    const CdrVersion version {GetParam()};
+
+    std::vector<bool> std_value {true, false, false, true, true, true, false, true, false, true, true};
+
+    CountingResource arena;
+    std::pmr::vector<bool> pmr_value {std_value.begin(), std_value.end(), &arena};
+
+    char std_buffer[64] {};
+    FastBuffer std_fast_buffer(std_buffer, sizeof(std_buffer));
+    Cdr std_cdr(std_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    std_cdr << std_value;
+
+    char pmr_buffer[64] {};
+    FastBuffer pmr_fast_buffer(pmr_buffer, sizeof(pmr_buffer));
+    Cdr pmr_cdr(pmr_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    pmr_cdr << pmr_value;
+
+    ASSERT_EQ(std_cdr.get_serialized_data_length(), pmr_cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(std_buffer, pmr_buffer, std_cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    ASSERT_EQ(pmr_cdr.get_serialized_data_length(),
+            calculator.calculate_serialized_size(pmr_value, current_alignment));
+
+    pmr_cdr.reset();
+    std::pmr::vector<bool> decoded_value(&arena);
+    pmr_cdr >> decoded_value;
+    ASSERT_TRUE(std::equal(std_value.begin(), std_value.end(), decoded_value.begin(), decoded_value.end()));
+
+    // A byte which is neither 0 nor 1 is rejected.
+    pmr_buffer[6] = 2;
+    pmr_cdr.reset();
+    ASSERT_THROW(pmr_cdr >> decoded_value, exception::BadParamException);
+}
+
+/*!
+ * @test Decoding an external without a memory resource uses the global heap.
+ */
+TEST(PmrExternalTests, no_memory_resource)
+{
+    std::vector<int32_t> std_external {1, 2, 3, 4};
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    CountingResource arena;
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2, &arena);
+    ASSERT_EQ(&arena, cdr.get_memory_resource());
+    cdr << std_external;
+
+    cdr.reset();
+    cdr.set_memory_resource(nullptr);
+    external<std::vector<int32_t>> value;
+    cdr >> value;
+    ASSERT_EQ(std_external, *value);
+    ASSERT_EQ(0u, arena.allocations);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PmrTests,
+    PmrTests,
+    ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2));
+
+#endif // if FASTCDR_HAVE_PMR
@@ -0,0 +1,296 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+
+using namespace eprosima::fastcdr;
+
+struct ProjectedNested
+{
+    double double_value {0.5};
+
+    std::vector<uint32_t> sequence_value = std::vector<uint32_t>(20, 7u);
+
+    char char_value {'n'};
+};
+
+struct ProjectedOuter
+{
+    std::string first {"first"};
+
+    uint16_t uint16_value {1};
+
+    ProjectedNested nested;
+
+    uint64_t uint64_value {3};
+
+    std::string last {"last"};
+};
+
+namespace eprosima {
+namespace fastcdr {
+
+template<>
+void serialize(
+        Cdr& cdr,
+        const ProjectedNested& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, cdr.get_encoding_flag());
+    cdr << MemberId(0) << data.double_value << MemberId(1) << data.sequence_value << MemberId(2) << data.char_value;
+    cdr.end_serialize_type(current_state);
+}
+
+template<>
+void serialize(
+        Cdr& cdr,
+        const ProjectedOuter& data)
+{
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, cdr.get_encoding_flag());
+    cdr << MemberId(0) << data.first << MemberId(1) << data.uint16_value << MemberId(2) << data.nested;
+    cdr << MemberId(3) << data.uint64_value << MemberId(4) << data.last;
+    cdr.end_serialize_type(current_state);
+}
+
+} // namespace fastcdr
+} // namespace eprosima
+
+class ProjectionTests : public ::testing::TestWithParam<std::tuple<CdrVersion, EncodingAlgorithmFlag>>
+{
+public:
+
+    //! Encodes a ProjectedOuter followed by a trailing uint32_t.
+    size_t encode(
+            Cdr& cdr)
+    {
+        cdr.set_encoding_flag(std::get<1>(GetParam()));
+        cdr << ProjectedOuter() << static_cast<uint32_t>(0xCAFE);
+        return cdr.get_serialized_data_length();
+    }
+
+    //! Decodes a member of ProjectedOuter, selecting member 2 of the nested type.
+    bool decode_member(
+            Cdr& cdr,
+            const MemberId& member_id)
+    {
+        switch (member_id.id)
+        {
+            case 0:
+                cdr >> string_value;
+                break;
+            case 1:
+                cdr >> uint16_value;
+                break;
+            case 2:
+                cdr.deserialize_type(std::get<1>(GetParam()), {2}, [this](Cdr& cdr_inner, const MemberId& mid)
+                        {
+                            switch (mid.id)
+                            {
+                                case 0:
+                                    cdr_inner >> double_value;
+                                    break;
+                                case 1:
+                                    cdr_inner >> sequence_value;
+                                    break;
+                                case 2:
+                                    cdr_inner >> char_value;
+                                    break;
+                                default:
+                                    return false;
+                            }
+                            nested_called_ids.push_back(mid.id);
+                            return true;
+                        });
+                break;
+            case 3:
+                cdr >> uint64_value;
+                break;
+            case 4:
+                cdr >> string_value;
+                break;
+            default:
+                return false;
+        }
+
+        called_ids.push_back(member_id.id);
+        return true;
+    }
+
+    std::vector<uint32_t> called_ids;
+
+    std::vector<uint32_t> nested_called_ids;
+
+    std::string string_value;
+
+    uint16_t uint16_value {0};
+
+    double double_value {0};
+
+    std::vector<uint32_t> sequence_value;
+
+    char char_value {0};
+
+    uint64_t uint64_value {0};
+};
+
+/*!
+ * @test Only the selected members are decoded when the encoding allows skipping the rest, and the decoder ends
+ * after the type.
+ */
+TEST_P(ProjectionTests, selected_members)
+{
+    const EncodingAlgorithmFlag encoding {std::get<1>(GetParam())};
+    char buffer[512] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, std::get<0>(GetParam()));
+    const size_t length {encode(cdr)};
+
+    cdr.reset();
+    cdr.deserialize_type(encoding, {3, 2}, [this](Cdr& cdr_inner, const MemberId& mid)
+            {
+                return decode_member(cdr_inner, mid);
+            });
+    uint32_t trailing {0};
+    cdr >> trailing;
+    ASSERT_EQ(0xCAFEu, trailing);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+
+    ASSERT_EQ(3u, uint64_value);
+    ASSERT_EQ('n', char_value);
+
+    switch (encoding)
+    {
+        case EncodingAlgorithmFlag::PL_CDR:
+        case EncodingAlgorithmFlag::PL_CDR2:
+        {
+            const std::vector<uint32_t> expected_ids {2, 3};
+            const std::vector<uint32_t> expected_nested_ids {2};
+            ASSERT_EQ(expected_ids, called_ids);
+            ASSERT_EQ(expected_nested_ids, nested_called_ids);
+            ASSERT_TRUE(string_value.empty());
+            ASSERT_TRUE(sequence_value.empty());
+            break;
+        }
+        case EncodingAlgorithmFlag::DELIMIT_CDR2:
+        {
+            // Members are decoded up to the last selected one.
+            const std::vector<uint32_t> expected_ids {0, 1, 2, 3};
+            const std::vector<uint32_t> expected_nested_ids {0, 1, 2};
+            ASSERT_EQ(expected_ids, called_ids);
+            ASSERT_EQ(expected_nested_ids, nested_called_ids);
+            ASSERT_EQ("first", string_value);
+            break;
+        }
+        default:
+        {
+            // Every member is decoded.
+            const std::vector<uint32_t> expected_ids {0, 1, 2, 3, 4};
+            ASSERT_EQ(expected_ids, called_ids);
+            ASSERT_EQ("last", string_value);
+            break;
+        }
+    }
+}
+
+/*!
+ * @test Selecting no member skips the whole type.
+ */
+TEST_P(ProjectionTests, no_member)
+{
+    const EncodingAlgorithmFlag encoding {std::get<1>(GetParam())};
+    if (EncodingAlgorithmFlag::PLAIN_CDR == encoding || EncodingAlgorithmFlag::PLAIN_CDR2 == encoding)
+    {
+        // Members without member header nor DHEADER cannot be skipped.
+        return;
+    }
+
+    char buffer[512] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, std::get<0>(GetParam()));
+    const size_t length {encode(cdr)};
+
+    cdr.reset();
+    cdr.deserialize_type(encoding, {}, [this](Cdr& cdr_inner, const MemberId& mid)
+            {
+                return decode_member(cdr_inner, mid);
+            });
+    uint32_t trailing {0};
+    cdr >> trailing;
+    ASSERT_EQ(0xCAFEu, trailing);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+    ASSERT_TRUE(called_ids.empty());
+}
+
+/*!
+ * @test A selected member which the functor doesn't decode is skipped from its member header, whatever the functor
+ * read of it, and it is refused when it must be understood.
+ */
+TEST_P(ProjectionTests, member_not_decoded)
+{
+    const EncodingAlgorithmFlag encoding {std::get<1>(GetParam())};
+    if (EncodingAlgorithmFlag::PL_CDR != encoding && EncodingAlgorithmFlag::PL_CDR2 != encoding)
+    {
+        // Only members with member header can be refused.
+        return;
+    }
+
+    char buffer[512] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, std::get<0>(GetParam()));
+    const size_t length {encode(cdr)};
+
+    cdr.reset();
+    cdr.deserialize_type(encoding, {3}, [](Cdr& cdr_inner, const MemberId&)
+            {
+                uint32_t half {0};
+                cdr_inner >> half;
+                return false;
+            });
+    uint32_t trailing {0};
+    cdr >> trailing;
+    ASSERT_EQ(0xCAFEu, trailing);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+
+    cdr.reset();
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, encoding);
+    MemberId must_understand_id {1};
+    must_understand_id.must_understand = true;
+    cdr << MemberId(0) << uint32_t(1) << must_understand_id << uint32_t(2);
+    cdr.end_serialize_type(current_state);
+
+    cdr.reset();
+    EXPECT_THROW(cdr.deserialize_type(encoding, {1}, [](Cdr&, const MemberId&)
+            {
+                return false;
+            }), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ProjectionTests,
+    ProjectionTests,
+    ::testing::Values(
+        std::make_tuple(CdrVersion::CORBA_CDR, EncodingAlgorithmFlag::PLAIN_CDR),
+        std::make_tuple(CdrVersion::XCDRv1, EncodingAlgorithmFlag::PLAIN_CDR),
+        std::make_tuple(CdrVersion::XCDRv1, EncodingAlgorithmFlag::PL_CDR),
+        std::make_tuple(CdrVersion::XCDRv2, EncodingAlgorithmFlag::PLAIN_CDR2),
+        std::make_tuple(CdrVersion::XCDRv2, EncodingAlgorithmFlag::DELIMIT_CDR2),
+        std::make_tuple(CdrVersion::XCDRv2, EncodingAlgorithmFlag::PL_CDR2)));
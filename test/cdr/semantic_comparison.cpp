@@ -0,0 +1,203 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/Comparison.hpp>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class SemanticComparisonTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    SemanticComparisonTests()
+        : interpreter_(described())
+    {
+    }
+
+    //! Encodes the sample with its encapsulation over a buffer filled with a byte, returning the encoded length.
+    size_t encode(
+            const DescribedSample& sample,
+            CdrVersion cdr_version,
+            Cdr::Endianness endianness,
+            char filling,
+            char* buffer)
+    {
+        memset(buffer, filling, 1024);
+        return encode_sample(sample, cdr_version, endianness, buffer, 1024);
+    }
+
+    DescribedSample sample() const
+    {
+        DescribedSample sample;
+        sample.extensibility = std::get<1>(GetParam());
+        return sample;
+    }
+
+    const TypeDescription& described()
+    {
+        types_ = describe_sample(description_, std::get<1>(GetParam()));
+        return description_;
+    }
+
+    TypeDescription description_;
+
+    DescribedSampleTypes types_;
+
+    TypeInterpreter interpreter_;
+
+    char first_[1024] {};
+
+    char second_[1024] {};
+};
+
+/*!
+ * @test Payloads of the same value are equal and have the same hash, whatever their padding bytes, endianness and
+ * CDR version.
+ */
+TEST_P(SemanticComparisonTests, same_value)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const CdrVersion other_version {CdrVersion::XCDRv1 == version ? CdrVersion::XCDRv2 : CdrVersion::XCDRv1};
+    const size_t first_length {encode(sample(), version, Cdr::BIG_ENDIANNESS, 0x00, first_)};
+    const uint64_t first_hash {hash(first_, first_length, interpreter_, types_.sample)};
+
+    size_t second_length {encode(sample(), version, Cdr::BIG_ENDIANNESS, 0x55, second_)};
+    ASSERT_EQ(first_length, second_length);
+    ASSERT_NE(0, memcmp(first_, second_, first_length));
+    EXPECT_TRUE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_EQ(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+
+    second_length = encode(sample(), version, Cdr::LITTLE_ENDIANNESS, 0x00, second_);
+    EXPECT_TRUE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_EQ(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+
+    second_length = encode(sample(), other_version, Cdr::LITTLE_ENDIANNESS, 0x00, second_);
+    EXPECT_TRUE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_EQ(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+}
+
+/*!
+ * @test Payloads of different values are not equal.
+ */
+TEST_P(SemanticComparisonTests, different_value)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const size_t first_length {encode(sample(), version, Cdr::DEFAULT_ENDIAN, 0x00, first_)};
+    const uint64_t first_hash {hash(first_, first_length, interpreter_, types_.sample)};
+
+    DescribedSample other {sample()};
+    other.nested_value.string_value = "other";
+    size_t second_length {encode(other, version, Cdr::DEFAULT_ENDIAN, 0x00, second_)};
+    EXPECT_FALSE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_NE(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+
+    other = sample();
+    other.absent_value = 0u;
+    second_length = encode(other, version, Cdr::DEFAULT_ENDIAN, 0x00, second_);
+    EXPECT_FALSE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_FALSE(equals(second_, second_length, first_, first_length, interpreter_, types_.sample));
+    EXPECT_NE(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+
+    other = sample();
+    other.map_value[3] = "three";
+    second_length = encode(other, version, Cdr::DEFAULT_ENDIAN, 0x00, second_);
+    EXPECT_FALSE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_NE(first_hash, hash(second_, second_length, interpreter_, types_.sample));
+
+    EXPECT_THROW(equals(first_, first_length / 2, second_, second_length, interpreter_, types_.sample),
+            exception::Exception);
+}
+
+/*!
+ * @test Payloads of mutable types are equal whatever the order of their members.
+ */
+TEST_P(SemanticComparisonTests, member_order)
+{
+    if (Extensibility::MUTABLE != std::get<1>(GetParam()))
+    {
+        // Members of other types are always encoded in order.
+        return;
+    }
+
+    const CdrVersion version {std::get<0>(GetParam())};
+    const DescribedSample data {sample()};
+    const size_t first_length {encode(data, version, Cdr::DEFAULT_ENDIAN, 0x00, first_)};
+
+    FastBuffer fast_buffer(second_, sizeof(second_));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr.set_encoding_flag(TypeDescription::encoding(version, Extensibility::MUTABLE));
+    cdr.serialize_encapsulation();
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, TypeDescription::encoding(version, Extensibility::MUTABLE));
+    cdr << MemberId(13) << data.bounded_string_value << MemberId(12) << data.absent_value;
+    cdr << MemberId(11) << data.optional_value << MemberId(10) << data.nested_value;
+    cdr << MemberId(9) << data.map_value << MemberId(8) << data.string_array_value;
+    cdr << MemberId(7) << data.array_value << MemberId(6) << data.string_sequence_value;
+    cdr << MemberId(5) << data.sequence_value << MemberId(4) << data.wstring_value;
+    cdr << MemberId(3) << data.string_value << MemberId(2) << data.long_long_value;
+    cdr << MemberId(1) << data.bool_value << MemberId(0) << data.octet_value;
+    cdr.end_serialize_type(current_state);
+    const size_t second_length {cdr.get_serialized_data_length()};
+
+    ASSERT_NE(0, memcmp(first_, second_, first_length));
+    EXPECT_TRUE(equals(first_, first_length, second_, second_length, interpreter_, types_.sample));
+    EXPECT_EQ(hash(first_, first_length, interpreter_, types_.sample),
+            hash(second_, second_length, interpreter_, types_.sample));
+}
+
+/*!
+ * @test Payloads nesting a recursive type without end are refused once the maximum nesting depth is exceeded,
+ * instead of exhausting the stack.
+ */
+TEST(SemanticComparisonRecursiveTests, nesting_depth)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    const TypeDescription::TypeIndex recursive {description.declare_structure(Extensibility::FINAL)};
+    Member next {MemberId(0), recursive};
+    next.optional = true;
+    description.set_members(recursive, {next});
+    const TypeInterpreter interpreter(description);
+
+    std::vector<char> buffer(200000, 1);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+    cdr.serialize_encapsulation();
+
+    // Three nested values.
+    buffer[6] = 0;
+    EXPECT_TRUE(equals(buffer.data(), 7, buffer.data(), 7, interpreter, recursive));
+    EXPECT_EQ(hash(buffer.data(), 7, interpreter, recursive), hash(buffer.data(), 7, interpreter, recursive));
+    buffer[6] = 1;
+
+    EXPECT_THROW(equals(buffer.data(), buffer.size(), buffer.data(), buffer.size(), interpreter, recursive),
+            exception::BadParamException);
+    EXPECT_THROW(hash(buffer.data(), buffer.size(), interpreter, recursive), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SemanticComparisonTests,
+    SemanticComparisonTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
@@ -0,0 +1,246 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <array>
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+#include <fastcdr/SerializationPlan.hpp>
+
+using namespace eprosima::fastcdr;
+
+enum class Mode : uint16_t
+{
+    IDLE,
+    ACTIVE
+};
+
+struct FixedSample
+{
+    uint8_t octet_value;
+    bool bool_value;
+    int16_t short_value;
+    uint16_t ushort_value;
+    int32_t long_value;
+    std::array<int32_t, 3> long_array;
+    uint64_t ulonglong_value;
+    double double_value;
+    Mode enum_value;
+    std::array<std::array<float, 2>, 2> float_matrix;
+    std::array<char, 3> char_array;
+};
+
+SerializationPlan make_plan(
+        CdrVersion version,
+        size_t initial_alignment)
+{
+    SerializationPlan plan(version, initial_alignment);
+    plan.add_member<uint8_t>(offsetof(FixedSample, octet_value))
+            .add_member<bool>(offsetof(FixedSample, bool_value))
+            .add_member<int16_t>(offsetof(FixedSample, short_value))
+            .add_member<uint16_t>(offsetof(FixedSample, ushort_value))
+            .add_member<int32_t>(offsetof(FixedSample, long_value))
+            .add_member<std::array<int32_t, 3>>(offsetof(FixedSample, long_array))
+            .add_member<uint64_t>(offsetof(FixedSample, ulonglong_value))
+            .add_member<double>(offsetof(FixedSample, double_value))
+            .add_member<Mode>(offsetof(FixedSample, enum_value))
+            .add_member<std::array<std::array<float, 2>, 2>>(offsetof(FixedSample, float_matrix))
+            .add_member<std::array<char, 3>>(offsetof(FixedSample, char_array));
+    return plan;
+}
+
+FixedSample make_sample()
+{
+    FixedSample sample {};
+    sample.octet_value = 0xCD;
+    sample.bool_value = true;
+    sample.short_value = -1234;
+    sample.ushort_value = 0xABCD;
+    sample.long_value = -123456;
+    sample.long_array = {{1, -2, 3}};
+    sample.ulonglong_value = 0x0123456789ABCDEF;
+    sample.double_value = -1.25;
+    sample.enum_value = Mode::ACTIVE;
+    sample.float_matrix = {{{{0.5f, 1.5f}}, {{2.5f, 3.5f}}}};
+    sample.char_array = {{'a', 'b', 'c'}};
+    return sample;
+}
+
+void serialize_members(
+        Cdr& cdr,
+        const FixedSample& sample)
+{
+    cdr << sample.octet_value << sample.bool_value << sample.short_value << sample.ushort_value << sample.long_value;
+    cdr.serialize_array(sample.long_array.data(), sample.long_array.size());
+    cdr << sample.ulonglong_value << sample.double_value << sample.enum_value;
+    cdr.serialize_array(sample.float_matrix[0].data(), 4);
+    cdr.serialize_array(sample.char_array.data(), sample.char_array.size());
+}
+
+class SerializationPlanTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Cdr::Endianness>>
+{
+};
+
+/*!
+ * @test Objects encoded with a plan are the same as the ones encoded member by member, and can be decoded back.
+ */
+TEST_P(SerializationPlanTests, same_as_cdr)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const Cdr::Endianness endianness {std::get<1>(GetParam())};
+    const FixedSample sample {make_sample()};
+
+    // Start unaligned.
+    const SerializationPlan plan {make_plan(version, 1)};
+
+    char expected_buffer[128] {};
+    FastBuffer expected_fast_buffer(expected_buffer, sizeof(expected_buffer));
+    Cdr expected_cdr(expected_fast_buffer, endianness, version);
+    expected_cdr << char(0);
+    serialize_members(expected_cdr, sample);
+    expected_cdr << uint64_t(0x1122334455667788);
+
+    // The plan size is the one calculated for its members.
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {1};
+    size_t calculated_size {0};
+    calculated_size += calculator.calculate_serialized_size(sample.octet_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.bool_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.short_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.ushort_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.long_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.long_array, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.ulonglong_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.double_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.enum_value, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.float_matrix, current_alignment);
+    calculated_size += calculator.calculate_serialized_size(sample.char_array, current_alignment);
+    ASSERT_EQ(calculated_size, plan.serialized_size());
+
+    // Encode with the plan into an exact-size buffer, followed by a value aligned after it.
+    char buffer[128] {};
+    FastBuffer fast_buffer(buffer, expected_cdr.get_serialized_data_length());
+    Cdr cdr(fast_buffer, endianness, version);
+    cdr << char(0);
+    cdr.serialize_with_plan(plan, &sample);
+    cdr << uint64_t(0x1122334455667788);
+    ASSERT_EQ(expected_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(expected_buffer, buffer, cdr.get_serialized_data_length()));
+
+    // Decode with the plan.
+    cdr.reset();
+    char dummy {0};
+    cdr >> dummy;
+    FixedSample decoded {};
+    cdr.deserialize_with_plan(plan, &decoded);
+    uint64_t trailing {0};
+    cdr >> trailing;
+    ASSERT_EQ(sample.octet_value, decoded.octet_value);
+    ASSERT_EQ(sample.bool_value, decoded.bool_value);
+    ASSERT_EQ(sample.short_value, decoded.short_value);
+    ASSERT_EQ(sample.ushort_value, decoded.ushort_value);
+    ASSERT_EQ(sample.long_value, decoded.long_value);
+    ASSERT_EQ(sample.long_array, decoded.long_array);
+    ASSERT_EQ(sample.ulonglong_value, decoded.ulonglong_value);
+    ASSERT_EQ(sample.double_value, decoded.double_value);
+    ASSERT_EQ(sample.enum_value, decoded.enum_value);
+    ASSERT_EQ(sample.float_matrix, decoded.float_matrix);
+    ASSERT_EQ(sample.char_array, decoded.char_array);
+    ASSERT_EQ(0x1122334455667788u, trailing);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SerializationPlanTests,
+    SerializationPlanTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Cdr::Endianness::LITTLE_ENDIANNESS, Cdr::Endianness::BIG_ENDIANNESS)));
+
+/*!
+ * @test Adjacent members of the same width without padding between them are copied in a single operation.
+ */
+TEST(SerializationPlanBuildTests, coalescing)
+{
+    const SerializationPlan plan {make_plan(CdrVersion::XCDRv2, 0)};
+
+    // octet, bool, (short, ushort), (long, long[3]), (ulonglong, double), enum, float[2][2], char[3]
+    ASSERT_EQ(8u, plan.operations().size());
+    ASSERT_EQ(2u, plan.operations()[2].num_elements);
+    ASSERT_EQ(4u, plan.operations()[3].num_elements);
+    ASSERT_EQ(2u, plan.operations()[4].num_elements);
+    ASSERT_EQ(4u, plan.operations()[6].num_elements);
+    ASSERT_EQ(4u, plan.max_alignment());
+
+    const SerializationPlan xcdrv1_plan {make_plan(CdrVersion::XCDRv1, 0)};
+    ASSERT_EQ(8u, xcdrv1_plan.operations().size());
+    ASSERT_EQ(8u, xcdrv1_plan.max_alignment());
+
+    // 64 bits members are aligned to 4 in XCDRv2 and to 8 in XCDRv1.
+    SerializationPlan xcdrv2_wide_plan(CdrVersion::XCDRv2);
+    xcdrv2_wide_plan.add_member<uint32_t>(0).add_member<uint64_t>(8);
+    ASSERT_EQ(4u, xcdrv2_wide_plan.operations()[1].wire_offset);
+    ASSERT_EQ(12u, xcdrv2_wide_plan.serialized_size());
+    SerializationPlan xcdrv1_wide_plan(CdrVersion::XCDRv1);
+    xcdrv1_wide_plan.add_member<uint32_t>(0).add_member<uint64_t>(8);
+    ASSERT_EQ(8u, xcdrv1_wide_plan.operations()[1].wire_offset);
+    ASSERT_EQ(16u, xcdrv1_wide_plan.serialized_size());
+
+    // Empty arrays are ignored.
+    SerializationPlan empty_plan(CdrVersion::XCDRv2);
+    empty_plan.add_member<std::array<uint64_t, 0>>(0);
+    ASSERT_TRUE(empty_plan.operations().empty());
+    ASSERT_EQ(0u, empty_plan.serialized_size());
+}
+
+/*!
+ * @test A plan not matching the state of the encoder, a buffer too small or a wrong boolean report an error.
+ */
+TEST(SerializationPlanBuildTests, errors)
+{
+    const FixedSample sample {make_sample()};
+    const SerializationPlan plan {make_plan(CdrVersion::XCDRv2, 0)};
+
+    char buffer[128] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+
+    // Wrong CDR version.
+    Cdr xcdrv1_cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv1);
+    EXPECT_THROW(xcdrv1_cdr.serialize_with_plan(plan, &sample), exception::BadParamException);
+
+    // Wrong alignment.
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr << char(0);
+    EXPECT_THROW(cdr.serialize_with_plan(plan, &sample), exception::BadParamException);
+    ASSERT_EQ(1u, cdr.get_serialized_data_length());
+
+    // Buffer too small.
+    FastBuffer small_fast_buffer(buffer, plan.serialized_size() - 1);
+    Cdr small_cdr(small_fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    EXPECT_THROW(small_cdr.serialize_with_plan(plan, &sample), exception::NotEnoughMemoryException);
+    FixedSample decoded {};
+    EXPECT_THROW(small_cdr.deserialize_with_plan(plan, &decoded), exception::NotEnoughMemoryException);
+    ASSERT_EQ(0u, small_cdr.get_serialized_data_length());
+
+    // Wrong boolean.
+    cdr.reset();
+    cdr.serialize_with_plan(plan, &sample);
+    buffer[plan.operations()[1].wire_offset] = 2;
+    cdr.reset();
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+    cdr.deserialize_with_plan(plan, &decoded);
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_BAD_PARAM, cdr.get_error());
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+}
@@ -0,0 +1,130 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+class StringLengthTests : public ::testing::TestWithParam<CdrVersion>
+{
+};
+
+/*!
+ * @test Strings serialized through their known length have the same encoding as the ones serialized from a C string.
+ */
+TEST_P(StringLengthTests, same_encoding_as_c_string)
+{
+    const CdrVersion version {GetParam()};
+    const std::string long_value(1000, 'x');
+    const std::string empty_value;
+    const fixed_string<16> fixed_value {"fixed"};
+
+    char expected_buffer[2048] {};
+    FastBuffer expected_fast_buffer(expected_buffer, sizeof(expected_buffer));
+    Cdr expected_cdr(expected_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    expected_cdr << long_value.c_str() << empty_value.c_str() << fixed_value.c_str() << "part";
+
+    char buffer[2048] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    cdr << long_value << empty_value << fixed_value;
+    // Not null-terminated characters.
+    cdr.serialize_string("partial", 4);
+
+    ASSERT_EQ(expected_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(expected_buffer, buffer, cdr.get_serialized_data_length()));
+
+    std::string dlong_value;
+    std::string dempty_value {"stale"};
+    fixed_string<16> dfixed_value;
+    std::string dpart_value;
+    cdr.reset();
+    cdr >> dlong_value >> dempty_value >> dfixed_value >> dpart_value;
+    ASSERT_EQ(long_value, dlong_value);
+    ASSERT_EQ(empty_value, dempty_value);
+    ASSERT_EQ(fixed_value, dfixed_value);
+    ASSERT_EQ("part", dpart_value);
+
+#if FASTCDR_HAVE_STRING_VIEW
+    const std::string_view view_value {"partial", 4};
+    char view_buffer[16] {};
+    FastBuffer view_fast_buffer(view_buffer, sizeof(view_buffer));
+    Cdr view_cdr(view_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    view_cdr << view_value;
+    char c_string_buffer[16] {};
+    FastBuffer c_string_fast_buffer(c_string_buffer, sizeof(c_string_buffer));
+    Cdr c_string_cdr(c_string_fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    c_string_cdr << "part";
+    ASSERT_EQ(c_string_cdr.get_serialized_data_length(), view_cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(c_string_buffer, view_buffer, view_cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    ASSERT_EQ(view_cdr.get_serialized_data_length(), calculator.calculate_serialized_size(view_value,
+            current_alignment));
+#endif // if FASTCDR_HAVE_STRING_VIEW
+}
+
+/*!
+ * @test Strings with null characters are refused unless the check is skipped.
+ */
+TEST_P(StringLengthTests, null_characters)
+{
+    const CdrVersion version {GetParam()};
+    const std::string value {"null\0inside", 11};
+    fixed_string<16> fixed_value;
+    fixed_value.assign(value.c_str(), value.size());
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    EXPECT_THROW(cdr << value, exception::BadParamException);
+    EXPECT_THROW(cdr << fixed_value, exception::BadParamException);
+    EXPECT_THROW(cdr.serialize_string(value.c_str(), value.size()), exception::BadParamException);
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+
+    cdr.serialize_string(value.c_str(), value.size(), false);
+    ASSERT_EQ(16u, cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(buffer + 4, value.c_str(), value.size() + 1));
+}
+
+/*!
+ * @test Strings whose length with the null terminator doesn't fit in 32 bits are refused before being read.
+ */
+TEST_P(StringLengthTests, too_long)
+{
+    const CdrVersion version {GetParam()};
+    const char value[] {"too long"};
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, version);
+    EXPECT_THROW(cdr.serialize_string(value, 0xFFFFFFFFu, false), exception::BadParamException);
+    if (sizeof(size_t) > sizeof(uint32_t))
+    {
+        EXPECT_THROW(cdr.serialize_string(value, static_cast<size_t>(0x100000001ull), false),
+                exception::BadParamException);
+    }
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    StringLengthTests,
+    StringLengthTests,
+    ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2));
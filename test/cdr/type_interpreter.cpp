@@ -0,0 +1,272 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+#include <fastcdr/dynamic/TypeInterpreter.hpp>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class TypeInterpreterTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    TypeInterpreterTests()
+        : types(describe_sample(description, std::get<1>(GetParam())))
+        , interpreter(description)
+    {
+        sample.extensibility = std::get<1>(GetParam());
+    }
+
+    //! Builds the dynamic value equivalent to the sample.
+    DynamicValue make_sample_value() const
+    {
+        DynamicValue value {interpreter.make_value(types.sample)};
+        value.elements[0].set(sample.octet_value);
+        value.elements[1].set(sample.bool_value);
+        value.elements[2].set(sample.long_long_value);
+        value.elements[3].string8 = sample.string_value;
+        value.elements[4].string16 = sample.wstring_value;
+        value.elements[5].assign_primitives(sample.sequence_value.data(), sample.sequence_value.size());
+        for (const std::string& element : sample.string_sequence_value)
+        {
+            value.elements[6].elements.emplace_back(TypeKind::STRING8);
+            value.elements[6].elements.back().string8 = element;
+        }
+        value.elements[7].assign_primitives(sample.array_value[0].data(), 6);
+        value.elements[8].elements[0].string8 = sample.string_array_value[0];
+        value.elements[8].elements[1].string8 = sample.string_array_value[1];
+        for (const auto& pair : sample.map_value)
+        {
+            value.elements[9].elements.emplace_back(TypeKind::INT32);
+            value.elements[9].elements.back().set(pair.first);
+            value.elements[9].elements.emplace_back(TypeKind::STRING8);
+            value.elements[9].elements.back().string8 = pair.second;
+        }
+        value.elements[10].elements[0].set(sample.nested_value.short_value);
+        value.elements[10].elements[1].string8 = sample.nested_value.string_value;
+        value.elements[11].present = true;
+        value.elements[11].set(*sample.optional_value);
+        value.elements[13].string8 = sample.bounded_string_value;
+        return value;
+    }
+
+    //! Encodes a value tree through the interpreter with its encapsulation, returning the encoded length.
+    size_t encode(
+            char* buffer,
+            size_t size,
+            const DynamicValue& value)
+    {
+        FastBuffer fast_buffer(buffer, size);
+        return encode_payload(fast_buffer, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, sample.extensibility,
+                       [this, &value](Cdr& cdr)
+                       {
+                           interpreter.serialize(cdr, types.sample, value);
+                       });
+    }
+
+    TypeDescription description;
+
+    DescribedSampleTypes types;
+
+    TypeInterpreter interpreter;
+
+    DescribedSample sample;
+};
+
+/*!
+ * @test The interpreter encodes exactly as the generated code, and its calculated size is the encoded size.
+ */
+TEST_P(TypeInterpreterTests, serialize)
+{
+    char buffer[1024] {};
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+
+    const DynamicValue value {make_sample_value()};
+    char dynamic_buffer[1024] {};
+    const size_t dynamic_length {encode(dynamic_buffer, sizeof(dynamic_buffer), value)};
+    ASSERT_EQ(length, dynamic_length);
+    ASSERT_EQ(0, memcmp(buffer, dynamic_buffer, length));
+
+    CdrSizeCalculator calculator(std::get<0>(GetParam()));
+    size_t current_alignment {0};
+    ASSERT_EQ(length - 4, interpreter.calculate_serialized_size(calculator, types.sample, value, current_alignment));
+}
+
+/*!
+ * @test The interpreter decodes the encoding of the generated code into a value tree, and skips it.
+ */
+TEST_P(TypeInterpreterTests, deserialize)
+{
+    char buffer[1024] {};
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+
+    DynamicValue value;
+    {
+        FastBuffer fast_buffer(buffer, length);
+        Cdr cdr(fast_buffer);
+        cdr.read_encapsulation();
+        interpreter.deserialize(cdr, types.sample, value);
+        ASSERT_EQ(length, cdr.get_serialized_data_length());
+    }
+
+    ASSERT_EQ(TypeKind::STRUCTURE, value.kind);
+    ASSERT_EQ(14u, value.elements.size());
+    ASSERT_EQ(sample.long_long_value, value.elements[2].get<int64_t>());
+    ASSERT_EQ(sample.wstring_value, value.elements[4].string16);
+    ASSERT_EQ(3u, value.elements[5].primitive_count<uint16_t>());
+    ASSERT_EQ(6, value.elements[7].primitives<int32_t>()[5]);
+    ASSERT_EQ(4u, value.elements[9].elements.size());
+    ASSERT_EQ("two", value.elements[9].elements[3].string8);
+    ASSERT_EQ("nested", value.elements[10].elements[1].string8);
+    ASSERT_TRUE(value.elements[11].present);
+    ASSERT_EQ(2.5, value.elements[11].get<double>());
+    ASSERT_FALSE(value.elements[12].present);
+
+    // The decoded tree encodes back to the same bytes.
+    char dynamic_buffer[1024] {};
+    const size_t dynamic_length {encode(dynamic_buffer, sizeof(dynamic_buffer), value)};
+    ASSERT_EQ(length, dynamic_length);
+    ASSERT_EQ(0, memcmp(buffer, dynamic_buffer, length));
+
+    FastBuffer fast_buffer(buffer, length);
+    Cdr cdr(fast_buffer);
+    cdr.read_encapsulation();
+    interpreter.skip(cdr, types.sample);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test Values not matching their type are rejected.
+ */
+TEST_P(TypeInterpreterTests, wrong_values)
+{
+    char buffer[1024] {};
+    DynamicValue value {make_sample_value()};
+
+    value.elements[7].resize_primitives<int32_t>(5);
+    EXPECT_THROW(encode(buffer, sizeof(buffer), value), exception::BadParamException);
+    value.elements[7].resize_primitives<int32_t>(6);
+
+    value.elements[13].string8 = "bounds";
+    EXPECT_THROW(encode(buffer, sizeof(buffer), value), exception::BadParamException);
+    CdrSizeCalculator calculator(std::get<0>(GetParam()));
+    size_t current_alignment {0};
+    EXPECT_THROW(interpreter.calculate_serialized_size(calculator, types.sample, value, current_alignment),
+            exception::BadParamException);
+    value.elements[13].string8 = "bound";
+
+    value.elements.pop_back();
+    EXPECT_THROW(encode(buffer, sizeof(buffer), value), exception::BadParamException);
+
+    // A sequence exceeding its bound is not decoded.
+    sample.sequence_value.push_back(4);
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+    FastBuffer fast_buffer(buffer, length);
+    Cdr cdr(fast_buffer);
+    cdr.read_encapsulation();
+    EXPECT_THROW(interpreter.deserialize(cdr, types.sample, value), exception::BadParamException);
+}
+
+/*!
+ * @test An optional member whose XCDRv1 member header exceeds the buffer is reported, instead of being jumped over.
+ */
+TEST(TypeInterpreterXcdrv1Tests, corrupted_optional_member_header)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    Member optional_member {MemberId(0), TypeDescription::predefined(TypeKind::UINT32)};
+    optional_member.optional = true;
+    const TypeDescription::TypeIndex type {description.add_structure(Extensibility::FINAL, {
+        optional_member,
+        Member{MemberId(1), TypeDescription::predefined(TypeKind::UINT32)}
+    })};
+    TypeInterpreter interpreter(description);
+
+    DynamicValue value {interpreter.make_value(type)};
+    value.elements[0].present = true;
+    value.elements[0].set(static_cast<uint32_t>(1));
+    value.elements[1].set(static_cast<uint32_t>(2));
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::BIG_ENDIANNESS, CdrVersion::XCDRv1);
+    interpreter.serialize(cdr, type, value);
+    const size_t length {cdr.get_serialized_data_length()};
+    ASSERT_EQ(12u, length);
+
+    // Size of the member header bigger than the rest of the buffer.
+    buffer[2] = 0x7F;
+    buffer[3] = static_cast<char>(0xF0);
+
+    FastBuffer truncated_buffer(buffer, length);
+    Cdr dcdr(truncated_buffer, Cdr::BIG_ENDIANNESS, CdrVersion::XCDRv1);
+    DynamicValue decoded_value;
+    EXPECT_THROW(interpreter.deserialize(dcdr, type, decoded_value), exception::NotEnoughMemoryException);
+
+    dcdr.reset();
+    EXPECT_THROW(interpreter.hash(dcdr, type), exception::NotEnoughMemoryException);
+}
+
+/*!
+ * @test A payload nesting a recursive type without end is refused once the maximum nesting depth is exceeded,
+ * instead of exhausting the stack.
+ */
+TEST(TypeInterpreterXcdrv2Tests, nesting_depth)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    const TypeDescription::TypeIndex recursive {description.declare_structure(Extensibility::FINAL)};
+    Member next {MemberId(0), recursive};
+    next.optional = true;
+    description.set_members(recursive, {next});
+    TypeInterpreter interpreter(description);
+
+    std::vector<char> buffer(200000, 1);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+
+    // Three nested values.
+    buffer[2] = 0;
+    cdr.set_max_nesting_depth(3);
+    DynamicValue value;
+    interpreter.deserialize(cdr, recursive, value);
+    ASSERT_EQ(3u, cdr.get_serialized_data_length());
+    ASSERT_TRUE(value.elements[0].elements[0].present);
+    ASSERT_FALSE(value.elements[0].elements[0].elements[0].present);
+
+    cdr.reset();
+    cdr.set_max_nesting_depth(2);
+    EXPECT_THROW(interpreter.deserialize(cdr, recursive, value), exception::BadParamException);
+    buffer[2] = 1;
+
+    cdr.reset();
+    cdr.set_max_nesting_depth(Cdr::DEFAULT_MAX_NESTING_DEPTH);
+    EXPECT_THROW(interpreter.deserialize(cdr, recursive, value), exception::BadParamException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TypeInterpreterTests,
+    TypeInterpreterTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
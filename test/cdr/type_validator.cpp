@@ -0,0 +1,255 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/dynamic/Validator.hpp>
+#include "described_sample.hpp"
+
+using namespace eprosima::fastcdr;
+using namespace eprosima::fastcdr::test;
+
+class TypeValidatorTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Extensibility>>
+{
+public:
+
+    char buffer[1024] {};
+};
+
+/*!
+ * @test A valid payload is validated and skipped, consuming exactly its length.
+ */
+TEST_P(TypeValidatorTests, valid_payload)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+
+    const ValidationResult result {validate(buffer, length, description, types.sample)};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error) << result.message;
+    ASSERT_EQ(length, result.length);
+
+    // Skipping without validating gives the same length.
+    FastBuffer fast_buffer(buffer, length);
+    Cdr cdr(fast_buffer);
+    cdr.read_encapsulation();
+    cdr.skip(description, types.sample);
+    ASSERT_EQ(length, cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test Truncated payloads are reported as not enough memory, without throwing.
+ */
+TEST_P(TypeValidatorTests, truncated_payload)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+
+    for (size_t truncated_length {5}; truncated_length < length; truncated_length += 3)
+    {
+        const ValidationResult result {validate(buffer, truncated_length, description, types.sample)};
+        ASSERT_NE(Cdr::CDR_ERROR_NONE, result.error) << truncated_length;
+        ASSERT_LE(result.length, truncated_length);
+    }
+}
+
+/*!
+ * @test Invalid values are reported as bad parameters at their position.
+ */
+TEST_P(TypeValidatorTests, invalid_values)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = std::get<1>(GetParam());
+    sample.bool_value = false;
+    sample.string_value = "@@@@";
+    encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer));
+    char false_buffer[sizeof(buffer)];
+    memcpy(false_buffer, buffer, sizeof(buffer));
+    sample.bool_value = true;
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+    char* const end {buffer + length};
+
+    // Boolean which is not 0 or 1.
+    char* bool_position {std::mismatch(buffer, end, false_buffer).first};
+    ++(*bool_position);
+    ValidationResult result {validate(buffer, length, description, types.sample)};
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+    --(*bool_position);
+
+    // String without terminator.
+    char* string_position {std::search_n(buffer, end, 4, '@')};
+    string_position[4] = '@';
+    result = validate(buffer, length, description, types.sample);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+    string_position[4] = '\0';
+
+    // String exceeding its bound.
+    sample.bounded_string_value = "bounds";
+    const size_t bounded_length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer,
+            sizeof(buffer))};
+    result = validate(buffer, bounded_length, description, types.sample);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+
+    // Sequence exceeding its bound.
+    sample.bounded_string_value = "bound";
+    sample.sequence_value.push_back(4);
+    const size_t sequence_length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer,
+            sizeof(buffer))};
+    result = validate(buffer, sequence_length, description, types.sample);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+}
+
+/*!
+ * @test The encapsulation has to match the extensibility of the type.
+ */
+TEST_P(TypeValidatorTests, wrong_encapsulation)
+{
+    TypeDescription description;
+    const DescribedSampleTypes types {describe_sample(description, std::get<1>(GetParam()))};
+    DescribedSample sample;
+    sample.extensibility = Extensibility::MUTABLE == std::get<1>(GetParam()) ?
+            Extensibility::FINAL : Extensibility::MUTABLE;
+    const size_t length {encode_sample(sample, std::get<0>(GetParam()), Cdr::DEFAULT_ENDIAN, buffer, sizeof(buffer))};
+
+    const ValidationResult result {validate(buffer, length, description, types.sample)};
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TypeValidatorTests,
+    TypeValidatorTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Extensibility::FINAL, Extensibility::APPENDABLE, Extensibility::MUTABLE)));
+
+/*!
+ * @test Unknown members of mutable types are skipped unless they have to be understood, and DHEADERs have to match
+ * the decoded size.
+ */
+TEST(TypeValidatorXcdrv2Tests, mutable_members)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    const TypeDescription::TypeIndex known {description.add_structure(Extensibility::MUTABLE, {
+        Member{MemberId(1), TypeDescription::predefined(TypeKind::UINT32)}
+    })};
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PL_CDR2);
+    cdr.serialize_encapsulation();
+    Cdr::state current_state(cdr);
+    cdr.begin_serialize_type(current_state, EncodingAlgorithmFlag::PL_CDR2);
+    cdr << MemberId(1) << static_cast<uint32_t>(1);
+    cdr << MemberId(2) << std::string("unknown");
+    cdr.end_serialize_type(current_state);
+    const size_t length {cdr.get_serialized_data_length()};
+
+    ValidationResult result {validate(buffer, length, description, known)};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error);
+    ASSERT_EQ(length, result.length);
+
+    // Flag must_understand in the unknown member.
+    buffer[4 + 4 + 8 + 3] = static_cast<char>(buffer[4 + 4 + 8 + 3] | 0x80);
+    result = validate(buffer, length, description, known);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+    buffer[4 + 4 + 8 + 3] = static_cast<char>(buffer[4 + 4 + 8 + 3] & 0x7F);
+
+    // DHEADER bigger than the members.
+    ++buffer[4];
+    result = validate(buffer, length + 1, description, known);
+    ASSERT_NE(Cdr::CDR_ERROR_NONE, result.error);
+}
+
+/*!
+ * @test Sequence lengths are bounded by their DHEADER, and only empty sequences of values encoded in zero bytes are
+ * accepted, so an untrusted length can't make the validator loop without consuming the payload.
+ */
+TEST(TypeValidatorXcdrv2Tests, untrusted_lengths)
+{
+    TypeDescription description;
+    const TypeDescription::TypeIndex empty_sequence {description.add_sequence(
+        description.add_structure(Extensibility::FINAL, {}))};
+    const TypeDescription::TypeIndex string_sequence {description.add_sequence(
+        TypeDescription::predefined(TypeKind::STRING8))};
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+    cdr.serialize_encapsulation();
+    cdr << static_cast<uint32_t>(4) << static_cast<uint32_t>(0);
+    const size_t length {cdr.get_serialized_data_length()};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, validate(buffer, length, description, empty_sequence).error);
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, validate(buffer, length, description, string_sequence).error);
+
+    // Length near 2^32 within a DHEADER of four bytes.
+    buffer[8] = buffer[9] = buffer[10] = buffer[11] = static_cast<char>(0xFF);
+    EXPECT_EQ(Cdr::CDR_ERROR_BAD_PARAM, validate(buffer, length, description, empty_sequence).error);
+    EXPECT_EQ(Cdr::CDR_ERROR_BAD_PARAM, validate(buffer, length, description, string_sequence).error);
+}
+
+/*!
+ * @test A recursive type is walked up to the maximum nesting depth, so a payload nesting it without end is reported
+ * instead of exhausting the stack.
+ */
+TEST(TypeValidatorXcdrv2Tests, nesting_depth)
+{
+    using Member = TypeDescription::Member;
+    TypeDescription description;
+    const TypeDescription::TypeIndex recursive {description.declare_structure(Extensibility::FINAL)};
+    Member next {MemberId(0), recursive};
+    next.optional = true;
+    description.set_members(recursive, {next});
+
+    std::vector<char> buffer(200000, 1);
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+    cdr.set_encoding_flag(EncodingAlgorithmFlag::PLAIN_CDR2);
+    cdr.serialize_encapsulation();
+    ASSERT_EQ(4u, cdr.get_serialized_data_length());
+
+    // Three nested values.
+    buffer[6] = 0;
+    ValidationResult result {validate(buffer.data(), 7, description, recursive)};
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, result.error) << result.message;
+    ASSERT_EQ(7u, result.length);
+    ASSERT_EQ(Cdr::CDR_ERROR_NONE, validate(buffer.data(), 7, description, recursive, 3).error);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, validate(buffer.data(), 7, description, recursive, 2).error);
+    buffer[6] = 1;
+
+    result = validate(buffer.data(), buffer.size(), description, recursive);
+    ASSERT_EQ(Cdr::CDR_ERROR_BAD_PARAM, result.error);
+    ASSERT_EQ(4u + Cdr::DEFAULT_MAX_NESTING_DEPTH, result.length);
+
+    cdr.reset();
+    cdr.read_encapsulation();
+    ASSERT_EQ(Cdr::DEFAULT_MAX_NESTING_DEPTH, cdr.get_max_nesting_depth());
+    cdr.set_max_nesting_depth(1000);
+    EXPECT_THROW(cdr.skip(description, recursive, true), exception::BadParamException);
+}
@@ -0,0 +1,198 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+enum class Color : uint32_t
+{
+    RED,
+    GREEN,
+    BLUE
+};
+
+class UncheckedRegionTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Cdr::Endianness>>
+{
+};
+
+/*!
+ * @test Values encoded through an unchecked_writer are the same as the ones encoded by Cdr and can be decoded by
+ * an unchecked_reader.
+ */
+TEST_P(UncheckedRegionTests, same_as_cdr)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const Cdr::Endianness endianness {std::get<1>(GetParam())};
+
+    const uint8_t octet_value {0xCD};
+    const int16_t short_value {-1234};
+    const uint64_t ulonglong_value {0x0123456789ABCDEF};
+    const float float_value {3.5f};
+    const double double_value {-1.25};
+    const Color enum_value {Color::BLUE};
+    const std::array<uint16_t, 3> array_value {{1, 2, 3}};
+
+    // Calculate the size of the region.
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {1}; // Start unaligned.
+    size_t region_size {calculator.calculate_serialized_size(octet_value, current_alignment)};
+    region_size += calculator.calculate_serialized_size(short_value, current_alignment);
+    region_size += calculator.calculate_serialized_size(ulonglong_value, current_alignment);
+    region_size += calculator.calculate_serialized_size(float_value, current_alignment);
+    region_size += calculator.calculate_serialized_size(double_value, current_alignment);
+    region_size += calculator.calculate_serialized_size(enum_value, current_alignment);
+    region_size += calculator.calculate_array_serialized_size(array_value.data(), array_value.size(),
+                    current_alignment);
+
+    // Encode using Cdr.
+    char expected_buffer[64] {};
+    FastBuffer expected_fast_buffer(expected_buffer, sizeof(expected_buffer));
+    Cdr expected_cdr(expected_fast_buffer, endianness, version);
+    expected_cdr << char(0);
+    expected_cdr << octet_value << short_value << ulonglong_value << float_value << double_value << enum_value;
+    expected_cdr.serialize_array(array_value.data(), array_value.size());
+
+    // Encode using an unchecked_writer over an exact-size buffer.
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, expected_cdr.get_serialized_data_length());
+    Cdr cdr(fast_buffer, endianness, version);
+    cdr << char(0);
+    {
+        Cdr::unchecked_writer writer(cdr, region_size);
+        ASSERT_TRUE(static_cast<bool>(writer));
+        writer << octet_value << short_value << ulonglong_value << float_value << double_value << enum_value;
+        writer.serialize_array(array_value.data(), array_value.size());
+    }
+    ASSERT_EQ(expected_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(expected_buffer, buffer, cdr.get_serialized_data_length()));
+
+    // Decode using an unchecked_reader.
+    cdr.reset();
+    char dummy {0};
+    cdr >> dummy;
+    uint8_t doctet_value {0};
+    int16_t dshort_value {0};
+    uint64_t dulonglong_value {0};
+    float dfloat_value {0};
+    double ddouble_value {0};
+    Color denum_value {Color::RED};
+    std::array<uint16_t, 3> darray_value {{0, 0, 0}};
+    {
+        Cdr::unchecked_reader reader(cdr, region_size);
+        ASSERT_TRUE(static_cast<bool>(reader));
+        reader >> doctet_value >> dshort_value >> dulonglong_value >> dfloat_value >> ddouble_value >> denum_value;
+        reader.deserialize_array(darray_value.data(), darray_value.size());
+    }
+    ASSERT_EQ(octet_value, doctet_value);
+    ASSERT_EQ(short_value, dshort_value);
+    ASSERT_EQ(ulonglong_value, dulonglong_value);
+    ASSERT_EQ(float_value, dfloat_value);
+    ASSERT_EQ(double_value, ddouble_value);
+    ASSERT_EQ(enum_value, denum_value);
+    ASSERT_EQ(array_value, darray_value);
+    ASSERT_EQ(expected_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    UncheckedRegionTests,
+    UncheckedRegionTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Cdr::Endianness::BIG_ENDIANNESS, Cdr::Endianness::LITTLE_ENDIANNESS)));
+
+/*!
+ * @test The region is reserved once, growing an internal buffer if needed.
+ */
+TEST(UncheckedRegionResizeTests, writer_resizes_buffer)
+{
+    FastBuffer fast_buffer;
+    Cdr cdr(fast_buffer);
+
+    {
+        Cdr::unchecked_writer writer(cdr, 1024);
+        ASSERT_TRUE(static_cast<bool>(writer));
+        for (uint32_t count {0}; count < 256; ++count)
+        {
+            writer << count;
+        }
+    }
+    ASSERT_EQ(1024u, cdr.get_serialized_data_length());
+
+    cdr.reset();
+    Cdr::unchecked_reader reader(cdr, 1024);
+    ASSERT_TRUE(static_cast<bool>(reader));
+    for (uint32_t count {0}; count < 256; ++count)
+    {
+        uint32_t value {0};
+        reader >> value;
+        ASSERT_EQ(count, value);
+    }
+}
+
+/*!
+ * @test A region that doesn't fit in the buffer reports an error.
+ */
+TEST(UncheckedRegionResizeTests, region_not_fitting)
+{
+    char buffer[8];
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer);
+
+    EXPECT_THROW(Cdr::unchecked_writer(cdr, 16), exception::NotEnoughMemoryException);
+    EXPECT_THROW(Cdr::unchecked_reader(cdr, 16), exception::NotEnoughMemoryException);
+
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+    Cdr::unchecked_writer writer(cdr, 16);
+    ASSERT_FALSE(static_cast<bool>(writer));
+    ASSERT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+    ASSERT_EQ(0u, cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test Nothing is encoded nor decoded through a region which could not be reserved.
+ */
+TEST(UncheckedRegionResizeTests, invalid_region_is_noop)
+{
+    std::array<char, 8> buffer;
+    buffer.fill(0x5A);
+    const std::array<char, 8> expected {buffer};
+    FastBuffer fast_buffer(buffer.data(), buffer.size());
+    Cdr cdr(fast_buffer);
+    cdr.set_error_mode(Cdr::ErrorMode::STICKY_ERROR);
+
+    const std::array<uint32_t, 4> values {{1, 2, 3, 4}};
+    Cdr::unchecked_writer writer(cdr, 32);
+    ASSERT_FALSE(static_cast<bool>(writer));
+    writer << uint64_t(0x0123456789ABCDEF) << 'a';
+    writer.serialize_array(values.data(), values.size());
+    EXPECT_EQ(expected, buffer);
+    EXPECT_EQ(0u, cdr.get_serialized_data_length());
+
+    std::array<uint32_t, 4> decoded {{9, 9, 9, 9}};
+    uint64_t decoded_value {7};
+    Cdr::unchecked_reader reader(cdr, 32);
+    ASSERT_FALSE(static_cast<bool>(reader));
+    reader >> decoded_value;
+    reader.deserialize_array(decoded.data(), decoded.size());
+    EXPECT_EQ(7u, decoded_value);
+    EXPECT_EQ(9u, decoded[3]);
+    EXPECT_EQ(0u, cdr.get_serialized_data_length());
+    EXPECT_EQ(Cdr::ErrorCode::CDR_ERROR_NOT_ENOUGH_MEMORY, cdr.get_error());
+}
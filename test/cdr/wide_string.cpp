@@ -0,0 +1,121 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+
+using namespace eprosima::fastcdr;
+
+class WideStringTests : public ::testing::TestWithParam<std::tuple<CdrVersion, Cdr::Endianness>>
+{
+};
+
+/*!
+ * @test Wide strings, wide-char arrays and std::u16string share the same encoding, which is the one of a sequence of
+ * 2-byte characters.
+ */
+TEST_P(WideStringTests, same_encoding)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const Cdr::Endianness endianness {std::get<1>(GetParam())};
+
+    // Long enough to use the vectorized kernels, with characters using the higher bit.
+    std::wstring wstring_value;
+    std::u16string u16string_value;
+    for (uint16_t count {0}; count < 37; ++count)
+    {
+        const uint16_t character {static_cast<uint16_t>(0x20 + count * 1777)};
+        wstring_value.push_back(static_cast<wchar_t>(character));
+        u16string_value.push_back(static_cast<char16_t>(character));
+    }
+
+    char expected_buffer[256] {};
+    FastBuffer expected_fast_buffer(expected_buffer, sizeof(expected_buffer));
+    Cdr expected_cdr(expected_fast_buffer, endianness, version);
+    expected_cdr << static_cast<uint8_t>(1) << static_cast<uint32_t>(wstring_value.size());
+    for (char16_t character : u16string_value)
+    {
+        expected_cdr << static_cast<uint16_t>(character);
+    }
+    expected_cdr << static_cast<uint8_t>(1) << static_cast<uint32_t>(wstring_value.size());
+    for (char16_t character : u16string_value)
+    {
+        expected_cdr << static_cast<uint16_t>(character);
+    }
+    expected_cdr << static_cast<uint8_t>(1);
+    expected_cdr.serialize_array(u16string_value.data(), u16string_value.size());
+
+    char buffer[256] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, endianness, version);
+    cdr << static_cast<uint8_t>(1) << wstring_value << static_cast<uint8_t>(1) << u16string_value;
+    cdr << static_cast<uint8_t>(1);
+    cdr.serialize_array(wstring_value.data(), wstring_value.size());
+
+    ASSERT_EQ(expected_cdr.get_serialized_data_length(), cdr.get_serialized_data_length());
+    ASSERT_EQ(0, memcmp(expected_buffer, buffer, cdr.get_serialized_data_length()));
+
+    CdrSizeCalculator calculator(version);
+    size_t current_alignment {0};
+    const size_t wstring_size {calculator.calculate_serialized_size(wstring_value, current_alignment)};
+    current_alignment = 0;
+    ASSERT_EQ(wstring_size, calculator.calculate_serialized_size(u16string_value, current_alignment));
+
+    // Decode crossing the types.
+    uint8_t dummy {0};
+    std::u16string du16string_value {u"stale"};
+    std::wstring dwstring_value {L"stale"};
+    wchar_t dwchar_array[37] {};
+    cdr.reset();
+    cdr >> dummy >> du16string_value >> dummy >> dwstring_value >> dummy;
+    cdr.deserialize_array(dwchar_array, 37);
+    ASSERT_EQ(u16string_value, du16string_value);
+    ASSERT_EQ(wstring_value, dwstring_value);
+    ASSERT_EQ(wstring_value, std::wstring(dwchar_array, 37));
+    ASSERT_EQ(cdr.get_serialized_data_length(), expected_cdr.get_serialized_data_length());
+}
+
+/*!
+ * @test A terminating zero sent by other implementations is not decoded.
+ */
+TEST_P(WideStringTests, terminating_zero)
+{
+    const CdrVersion version {std::get<0>(GetParam())};
+    const Cdr::Endianness endianness {std::get<1>(GetParam())};
+
+    char buffer[64] {};
+    FastBuffer fast_buffer(buffer, sizeof(buffer));
+    Cdr cdr(fast_buffer, endianness, version);
+    cdr << std::u16string(u"wide\0", 5) << std::u16string(u"\0", 1) << static_cast<uint16_t>(7);
+
+    std::wstring dwstring_value;
+    std::u16string du16string_value {u"stale"};
+    uint16_t short_value {0};
+    cdr.reset();
+    cdr >> dwstring_value >> du16string_value >> short_value;
+    ASSERT_EQ(L"wide", dwstring_value);
+    ASSERT_TRUE(du16string_value.empty());
+    ASSERT_EQ(7u, short_value);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    WideStringTests,
+    WideStringTests,
+    ::testing::Combine(
+        ::testing::Values(CdrVersion::CORBA_CDR, CdrVersion::XCDRv1, CdrVersion::XCDRv2),
+        ::testing::Values(Cdr::Endianness::BIG_ENDIANNESS, Cdr::Endianness::LITTLE_ENDIANNESS)));